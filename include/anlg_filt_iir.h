@@ -41,6 +41,13 @@ public:
    // Used instead of 'Execute' for subordinate form
    T ProcessSample(T input_val);
 
+   // Access to the discretized coefficients (valid after
+   // Initialize) for kernels that run the recursion inline
+   int GetFiltOrder(void);
+   double* GetACoefs(void);
+   double* GetBCoefs(void);
+   bool BypassIsEnabled(void);
+
 protected:
 
    // Implements functionality common to both ctors
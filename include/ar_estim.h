@@ -0,0 +1,86 @@
+//
+//  File = ar_estim.h
+//
+
+#ifndef _AR_ESTIM_H_
+#define _AR_ESTIM_H_
+
+#include <complex>
+#include "ar_methods.h"
+
+//======================================================
+//  Reusable autoregressive model estimator.  All work
+//  storage is allocated by the constructor, so Estimate()
+//  and ComputeSpectrum() can be called once per segment
+//  of a long record without touching the heap.
+//
+//  For the Yule-Walker method the autocorrelation lags
+//  are computed with a zero-padded FFT when the order is
+//  large enough for that to beat the direct sums.  The
+//  PSD is evaluated as a single zero-padded FFT of the
+//  coefficient vector, so the number of frequency points
+//  is rounded up to (power of 2)/2 + 1 points spanning
+//  zero to half the sample rate.
+
+class ArEstimator
+{
+public:
+  ArEstimator( AR_METHOD_T ar_method,
+               int seg_len,
+               int ar_order,
+               int num_freq_pts );
+
+  ~ArEstimator(void);
+
+  // fits the model to seg_len samples; returns nonzero
+  // if the segment does not give a stable estimate
+  int Estimate( double *signal );
+
+  // PSD of the most recent model at GetNumFreqPts() points
+  void ComputeSpectrum( double samp_intvl );
+
+  double* GetArCoeffs(void){return A_Coeffs;};
+  double GetDrivingVariance(void){return Drv_Var;};
+  double* GetSpectrum(void){return Psd_Buf;};
+  int GetNumFreqPts(void){return Num_Freq_Pts;};
+
+private:
+  void DirectAutocorr( double *signal );
+  void FftAutocorr( double *signal );
+  int YuleWalker( double *signal );
+  int Burg( double *signal );
+  int Covariance( double *signal );
+
+  AR_METHOD_T Ar_Method;
+  int Seg_Len;
+  int Ar_Order;
+  int Num_Freq_Pts;
+  double *A_Coeffs;
+  double Drv_Var;
+  double *Psd_Buf;
+
+  //  Yule-Walker
+  double *Autocorr;
+  bool Using_Fft_Autocorr;
+  int Corr_Fft_Len;
+  std::complex<double> *Corr_Packed;
+  std::complex<double> *Corr_Spect;
+  std::complex<double> *Corr_Twiddles;
+
+  //  Burg forward and backward prediction errors
+  double *Fwd_Err;
+  double *Bwd_Err;
+
+  //  covariance method normal equations
+  double *Cov_Mtx;
+  double *Chol_Fact;
+  double *Rhs_Vec;
+
+  //  spectrum evaluation
+  int Spec_Fft_Len;
+  std::complex<double> *Spec_Packed;
+  std::complex<double> *Spec_Freq;
+  std::complex<double> *Spec_Twiddles;
+};
+
+#endif
@@ -0,0 +1,20 @@
+//
+// file = ar_methods.h
+//
+
+#ifndef _AR_METHODS_H_
+#define _AR_METHODS_H_ 
+
+#include <iostream>
+
+typedef enum {
+  AR_METHOD_YULE_WALKER,
+  AR_METHOD_BURG,
+  AR_METHOD_COVARIANCE,
+  sizeof_AR_METHOD_T
+  } AR_METHOD_T;
+
+AR_METHOD_T GetArMethodParm(const char* parm_nam);
+std::ostream& operator<<( std::ostream& s, const AR_METHOD_T& ar_method_val);
+
+#endif
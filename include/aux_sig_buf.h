@@ -5,6 +5,22 @@
 #ifndef _AUX_SIG_BUF_H_
 #define _AUX_SIG_BUF_H_
 
+//======================================================
+//  Staging buffer for models that must accumulate
+//  variable-size input blocks before they can process a
+//  fixed-size frame.
+//
+//  Samples are kept in a ring whose storage is mirrored:
+//  each sample is written both at its ring position and
+//  Capacity positions later.  Any run of up to Capacity
+//  unreleased samples is therefore contiguous in memory,
+//  so the pointer returned by Load() or GetView() can be
+//  handed straight to an FFT with no copy, and Release()
+//  only advances the read index.
+//
+//  For overlapping frames, process the frame at the read
+//  pointer and then Release() only the hop between frame
+//  starts; the remaining samples stay in view.
 
 template <class T>
 class AuxSignalBuffer
@@ -14,15 +30,26 @@ public:
 
   ~AuxSignalBuffer(void);
 
+   //  appends a block and returns the oldest unreleased
+   //  sample; *in_sig_buf_count is set to the number of
+   //  unreleased samples
    T* Load(  T *in_sig_ptr,
                int in_sig_block_size,
                int *in_sig_buf_count);
 
    void Release(  int num_samps_to_release);
 
+   //  unreleased samples starting offset samples past the
+   //  oldest one, contiguous through the newest
+   T* GetView( int offset );
+
+   int GetSampleCount(void){return Sample_Count;};
+
 private:
   T* Buffer_Start;
-  T* Write_Ptr;
+  int Capacity;
+  int Read_Idx;
+  int Write_Idx;
   int Sample_Count;
   int Max_Sample_Count;
 
@@ -8,6 +8,12 @@
 #include "psmodel.h"
 #include "signal_T.h"
 
+//======================================================
+//  Real-valued input is written straight into the packed
+//  buffer of a real-input FFT; complex input goes through
+//  Cmpx_Seg and the full complex FFT.  The overloads of
+//  StoreSamples() and AccumSegment() select the path.
+
 template <class T>
 class BartlettPeriodogram : public PracSimModel
 {
@@ -21,12 +27,19 @@ public:
   int Execute(void);
 
 private:
+  void StoreSamples( float *in_sig_ptr, int num_samps );
+  void StoreSamples( std::complex<float> *in_sig_ptr, int num_samps );
+  void AccumSegment( float *seg_type );
+  void AccumSegment( std::complex<float> *seg_type );
+
   int Block_Size;
   Signal<T> *In_Sig;
   std::complex<double> *Freq_Seg;
+  std::complex<double> *Packed_Seg;
+  std::complex<double> *Fft_Twiddles;
   double *Sample_Spectrum;
   double Samp_Intvl;
-  T *Time_Seg;
+  std::complex<float> *Cmpx_Seg;
   double *Psd_Est;
   int Num_Segs_To_Avg;
   int Segs_In_Est;
@@ -43,6 +56,7 @@ private:
   double Delta_F;
   double Norm_Factor;
   double Freq_Norm_Factor;
+  double Psd_Scale;
 
 };
 
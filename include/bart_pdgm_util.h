@@ -18,6 +18,12 @@ public:
                   double samp_intvl );
 
    void Calculate(  T* time_signal );
+protected:
+   // members of the dependent base class
+   using SpectrumEstimator<T>::Num_Samps;
+   using SpectrumEstimator<T>::Fft_Len;
+   using SpectrumEstimator<T>::Samp_Intvl;
+   using SpectrumEstimator<T>::Psd_Estimate;
 private:
    complex<double>* Freq_Signal;
    //int Num_Samps;
@@ -7,9 +7,14 @@
 
 #include "psmodel.h"
 #include "signal_T.h"
-#include "gen_win.h"
+#include "win_cache.h"
 #include "window_shapes.h"
 
+//======================================================
+//  Windowed Bartlett periodogram of a real-valued signal.
+//  Samples are windowed as they are written into the
+//  packed buffer of a real-input FFT.
+
 template <class T>
 class BartlettPeriodogramWindowed : public PracSimModel
 {
@@ -26,10 +31,10 @@ private:
   int Block_Size;
   Signal<T> *In_Sig;
   std::complex<double> *Freq_Seg;
+  std::complex<double> *Packed_Seg;
+  std::complex<double> *Fft_Twiddles;
   double *Sample_Spectrum;
   double Samp_Intvl;
-  T *Time_Seg;
-  T *Win_Time_Seg;
   double *Psd_Est;
   int Num_Segs_To_Avg;
   int Segs_In_Est;
@@ -44,12 +49,13 @@ private:
   bool Output_In_Decibels;
   bool Plot_Two_Sided;
   bool Using_Window;
-  GenericWindow* Data_Window;
-  double *Window_Taps;
+  WindowTable *Data_Window;
   WINDOW_SHAPE_T Window_Shape;
+  double Kaiser_Beta;
   double Delta_F;
   double Norm_Factor;
   double Freq_Norm_Factor;
-  double Window_Power;
+  double Window_Enbw;
+  double Psd_Scale;
 };
 #endif //_BART_PDGM_WIND_H_
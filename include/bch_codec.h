@@ -0,0 +1,80 @@
+//
+//  File = bch_codec.h
+//
+
+#ifndef _BCH_CODEC_H_
+#define _BCH_CODEC_H_
+
+#include <vector>
+#include "typedefs.h"
+#include "gf2m_field.h"
+#include "gf_synd_dec.h"
+#include "packed_gf2.h"
+using namespace std;
+
+//======================================================
+//  Systematic binary BCH code of length n <= 2**m - 1
+//  (shortened when less) correcting num_corr bit errors.
+//  The generator is the least common multiple of the
+//  minimal polynomials of alpha thru alpha**(2*num_corr),
+//  and the message length is n minus its degree.
+//  Codewords hold the message bits followed by the parity
+//  bits, highest-degree coefficient first.
+
+class BchCodec
+{
+public:
+  BchCodec( Gf2mField *field,
+            int code_len,
+            int num_corr );
+  ~BchCodec(void);
+
+  void Encode( const bit_t *msg, bit_t *codeword );
+
+  //  encodes num_cws messages stored back to back
+  void EncodeBlock( const bit_t *msgs,
+                    bit_t *codewords,
+                    int num_cws );
+
+  //  corrects num_cws codewords in place; num_corr[iw] is
+  //  set to the number of bits corrected in codeword iw,
+  //  or -1 if it could not be decoded (left as is)
+  void DecodeBlock( bit_t *codewords,
+                    int num_cws,
+                    int *num_corr );
+
+  int GetCodeLen(void){return Code_Len;};
+  int GetMsgLen(void){return Msg_Len;};
+  int GetMaxCorr(void){return Max_Corr;};
+  const PackedPolyOvrGF2& GetGenerator(void){return Gen_Poly;};
+
+private:
+  void FeedBit( gf2_word_t *reg, int bit_val );
+  void FeedByte( gf2_word_t *reg, int byte_val );
+
+  Gf2mField *Field;
+  GfSyndromeDecoder *Synd_Decoder;
+  PackedPolyOvrGF2 Gen_Poly;
+  int Code_Len;
+  int Msg_Len;
+  int Num_Parity;
+  int Max_Corr;
+
+  //  parity register of Num_Parity bits, coefficient of
+  //  x**i in bit i
+  int Reg_Words;
+  gf2_word_t Top_Word_Mask;
+  gf2_word_t *Gen_Low;
+
+  //  Byte_Table[v*Reg_Words ...] = v(x) * x**Num_Parity
+  //  mod g(x), for eight message bits at a time
+  gf2_word_t *Byte_Table;
+
+  vector<gf2_word_t> Parity_Reg;
+  vector<gf_elem_t> Sym_Buf;
+  vector<gf_elem_t> Synd_Buf;
+  vector<gf_elem_t> Locator;
+  vector<int> Err_Pos;
+};
+
+#endif
@@ -0,0 +1,51 @@
+//
+//  File = bch_decoder.h
+//
+
+#ifndef _BCH_DECODER_H_
+#define _BCH_DECODER_H_
+
+#include <vector>
+#include "psmodel.h"
+#include "signal_T.h"
+#include "bch_codec.h"
+
+//  BCH decoder matching BchEncoder.  Every Code_Len
+//  input bits are corrected and their Msg_Len message
+//  bits output; codeword-level statistics are reported
+//  like the BER counters.
+
+class BchDecoder : public PracSimModel
+{
+public:
+  BchDecoder( char* instance_name,
+             PracSimModel* outer_model,
+             Signal<bit_t>* in_signal,
+             Signal<bit_t>* out_signal );
+
+  ~BchDecoder(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Num_Codewords;
+  int Gf_Degree;
+  int Code_Len;
+  int Msg_Len;
+  int Num_Corr;
+  int Num_Holdoff_Passes;
+  int Report_Intvl_In_Blocks;
+  Signal<bit_t> *In_Sig;
+  Signal<bit_t> *Out_Sig;
+  Gf2mField *Field;
+  BchCodec *Codec;
+  std::vector<bit_t> Code_Buf;
+  std::vector<int> Cw_Num_Corr;
+  long long Codewords_Decoded;
+  long long Codewords_Corrected;
+  long long Bits_Corrected;
+  long long Decoder_Failures;
+};
+
+#endif
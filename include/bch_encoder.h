@@ -0,0 +1,45 @@
+//
+//  File = bch_encoder.h
+//
+
+#ifndef _BCH_ENCODER_H_
+#define _BCH_ENCODER_H_
+
+#include <vector>
+#include "psmodel.h"
+#include "signal_T.h"
+#include "bch_codec.h"
+
+//  Systematic binary BCH encoder over GF(2**Gf_Degree)
+//  correcting Num_Corr errors; every Msg_Len input bits
+//  become Code_Len output bits, with Msg_Len set by the
+//  generator degree.
+
+class BchEncoder : public PracSimModel
+{
+public:
+  BchEncoder( char* instance_name,
+             PracSimModel* outer_model,
+             Signal<bit_t>* in_signal,
+             Signal<bit_t>* out_signal );
+
+  ~BchEncoder(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Num_Codewords;
+  int Gf_Degree;
+  int Code_Len;
+  int Msg_Len;
+  int Num_Corr;
+  Signal<bit_t> *In_Sig;
+  Signal<bit_t> *Out_Sig;
+  Gf2mField *Field;
+  BchCodec *Codec;
+  std::vector<bit_t> Msg_Buf;
+  std::vector<bit_t> Code_Buf;
+};
+
+#endif
@@ -30,6 +30,11 @@ private:
   Signal<bit_t> *Ref_Sig;
   int Num_Holdoff_Passes;
   int Report_Intvl_In_Blocks;
+  int Max_Lag;
+  int Sync_Window_Len;
+  int Max_Window_Errs;
+  double Conf_Level;
+  double Target_Rel_Precision;
   k_BerCounter *Kernel;
   //int *Histogram;
   
@@ -26,6 +26,12 @@ public:
 //                    bool bypass_enabled);
   ~BesselFilterByIir(void);
   //virtual void Initialize(void);
+protected:
+  // members of the dependent base class
+  using AnalogFilterByIir<T>::Model_Name;
+  using AnalogFilterByIir<T>::Bypass_Enabled;
+  using AnalogFilterByIir<T>::Lowpass_Proto_Filt;
+  using AnalogFilterByIir<T>::Prototype_Order;
 private:
   bool Delay_Norm_Enabled;
   
@@ -0,0 +1,33 @@
+//
+//  File = binom_conf.h
+//
+
+#ifndef _BINOM_CONF_H_
+#define _BINOM_CONF_H_
+
+//  two-sided standard normal quantile for a confidence
+//  level such as 0.95
+double NormalConfQuantile( double conf_level );
+
+//  regularized incomplete beta function I_x(a,b)
+double IncompleteBetaRatio( double a, double b, double x );
+
+//  Confidence intervals for a binomial proportion from
+//  num_events successes in num_trials trials.  Wilson's
+//  score interval is closed form; the Clopper-Pearson
+//  interval is exact (never undercovers) and is found by
+//  bisection on the binomial tail.
+
+void WilsonInterval( long long num_events,
+                     long long num_trials,
+                     double conf_level,
+                     double *lower,
+                     double *upper );
+
+void ClopperPearsonInterval( long long num_events,
+                             long long num_trials,
+                             double conf_level,
+                             double *lower,
+                             double *upper );
+
+#endif
@@ -0,0 +1,19 @@
+//
+//  File = blk_harr.h
+//
+
+#ifndef _BLK_HARR_H_
+#define _BLK_HARR_H_
+
+#include "gen_win.h"
+//======================================================
+//  4-term Blackman-Harris window (-92 dB sidelobes)
+
+class BlackmanHarrisWindow : public GenericWindow
+{
+public:
+   BlackmanHarrisWindow( int length );
+   void GenerateWindow( int length );
+};
+
+#endif
@@ -0,0 +1,45 @@
+//
+//  File = bursterrorgen.h
+//
+
+#ifndef _BURSTERRORGEN_H_
+#define _BURSTERRORGEN_H_
+
+#include "signal_T.h"
+#include "psmodel.h"
+#include "gap_err_sampler.h"
+
+//  Binary channel error generator for very low error
+//  rates.  Like BscErrorGener, but the bits are copied
+//  through and only the errored ones touched, with the
+//  gaps between errors drawn by GapErrorSampler.  With
+//  Two_State_Chan it is a Gilbert-Elliott burst channel.
+
+class BurstErrorGener : public PracSimModel
+{
+public:
+   BurstErrorGener( char* instance_nam,
+                    PracSimModel* outer_model,
+                    Signal<bit_t> *in_signal,
+                    Signal<bit_t> *out_signal );
+
+   ~BurstErrorGener(void);
+   void Initialize(void);
+   int Execute(void);
+
+private:
+   int Block_Size;
+   bool Two_State_Chan;
+   double Bit_Error_Probability;
+   double Good_Error_Prob;
+   double Bad_Error_Prob;
+   double Good_To_Bad_Prob;
+   double Bad_To_Good_Prob;
+   long Initial_Seed;
+   GapErrorSampler *Err_Sampler;
+
+   Signal<bit_t> *In_Sig;
+   Signal<bit_t> *Out_Sig;  
+};
+
+#endif
@@ -0,0 +1,88 @@
+//
+//  File = cmpx_kernels.h
+//
+
+#ifndef _CMPX_KERNELS_H_
+#define _CMPX_KERNELS_H_
+
+#include <complex>
+
+typedef enum {
+  CMPX_ISA_SCALAR,
+  CMPX_ISA_AVX2,
+  CMPX_ISA_AVX512
+  } CMPX_ISA_T;
+
+//======================================================
+//  Elementwise kernels for arrays of std::complex<float>.
+//
+//  Each kernel works on the interleaved real/imag floats
+//  directly.  That keeps std::complex operator* (and its
+//  NaN/inf recovery, which stops the loop vectorizing)
+//  out of the per-sample path.  On the first call the
+//  widest of AVX-512, AVX2+FMA or portable C++ that the
+//  CPU supports is picked.  An output may be the same
+//  array as an input.
+
+//  out = in_1 * in_2
+void CmpxMultiply( const std::complex<float> *in_1,
+                   const std::complex<float> *in_2,
+                   std::complex<float> *out,
+                   int num_samps );
+
+//  out = in_1 * conj(in_2)
+void CmpxConjMultiply( const std::complex<float> *in_1,
+                       const std::complex<float> *in_2,
+                       std::complex<float> *out,
+                       int num_samps );
+
+//  out = factor * in, i.e. gain and phase rotation
+void CmpxScaleRotate( const std::complex<float> *in,
+                      std::complex<float> factor,
+                      std::complex<float> *out,
+                      int num_samps );
+
+//  out = complex(real_in, imag_in)
+void CmpxInterleave( const float *real_in,
+                     const float *imag_in,
+                     std::complex<float> *out,
+                     int num_samps );
+
+//  real_out = real(in), imag_out = imag(in)
+void CmpxDeinterleave( const std::complex<float> *in,
+                       float *real_out,
+                       float *imag_out,
+                       int num_samps );
+
+//  std::norm and std::abs (without hypot's overflow
+//  guard)
+void CmpxMagSquared( const std::complex<float> *in,
+                     float *mag_sq_out,
+                     int num_samps );
+void CmpxMagnitude( const std::complex<float> *in,
+                    float *mag_out,
+                    int num_samps );
+
+//  std::arg in radians, from a polynomial arctangent; the
+//  result is within 4e-7 rad of the exact angle.  All
+//  instruction sets use the same approximation so results
+//  do not depend on the CPU
+void CmpxPhase( const std::complex<float> *in,
+                float *phase_out,
+                int num_samps );
+
+//  out = in_1 * in_2 for real arrays
+void FloatMultiply( const float *in_1,
+                    const float *in_2,
+                    float *out,
+                    int num_samps );
+
+//  instruction set in use
+CMPX_ISA_T GetCmpxKernelIsa(void);
+const char* CmpxIsaName( CMPX_ISA_T isa );
+
+//  caps the instruction set, for example to compare paths;
+//  a request above what the CPU supports is lowered
+void SetCmpxKernelIsa( CMPX_ISA_T max_isa );
+
+#endif
@@ -0,0 +1,41 @@
+//
+//  File = conv_encoder.h
+//
+
+#ifndef _CONV_ENCODER_H_
+#define _CONV_ENCODER_H_
+
+#include "psmodel.h"
+#include "signal_T.h"
+#include "bitenctab.h"
+#include "k_viterbi.h"
+
+//  Rate 1/Num_Outputs convolutional encoder.  Gen_Polys
+//  are given in decimal with the current input in bit
+//  Constr_Len-1 (octal 171,133 is 121 91).  The encoder
+//  state carries across blocks.
+
+class ConvEncoder : public PracSimModel
+{
+public:
+  ConvEncoder( char* instance_name,
+               PracSimModel* outer_model,
+               Signal<bit_t>* in_signal,
+               Signal<bit_t>* out_signal );
+
+  ~ConvEncoder(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Constr_Len;
+  int Num_Outputs;
+  int *Gen_Polys;
+  int Enc_State;
+  Signal<bit_t> *In_Sig;
+  Signal<bit_t> *Out_Sig;
+  BitEncodingTable *Enc_Table[VIT_MAX_OUTPUTS];
+};
+
+#endif
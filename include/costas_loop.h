@@ -7,6 +7,7 @@
 
 #include "signal_T.h"
 #include "anlg_filt_iir.h"
+#include "k_pll_engine.h"
 
 class CostasLoop : public PracSimModel
 {
@@ -26,6 +27,9 @@ CostasLoop( char* instance_nam,
    int Execute(void);
 
 private:
+   template <int Diag_Mask> void RunLoop(int block_size);
+   typedef void (CostasLoop::*LoopFnPtr)(int);
+
    double Samp_Intvl;
 
    Signal<float> *fsig_Input;
@@ -41,8 +45,6 @@ private:
    double K_Sub_0;
    double I_OscOutput;
    double Q_OscOutput;
-   double Phi_Sub_2;
-   double Phi_Divided;
    double Omega_Sub_0;
    double Center_Freq_Hz;
    float Osc_Output_Prev_Val;
@@ -50,6 +52,13 @@ private:
    AnalogFilterByIir<float> *I_Filter_Core;
    AnalogFilterByIir<float> *Q_Filter_Core;
    AnalogFilterByIir<float> *Prod_Filter_Core;
+   k_StateSpaceLoopFilter *I_Filter;
+   k_StateSpaceLoopFilter *Q_Filter;
+   k_StateSpaceLoopFilter *Prod_Filter;
+   k_Nco *Osc;
+   k_Nco *Divided_Osc;
+   int Diag_Mask;
+   LoopFnPtr Run_Loop;
   
 };
 
@@ -0,0 +1,44 @@
+//
+//  File = crc_checker.h
+//
+
+#ifndef _CRC_CHECKER_H_
+#define _CRC_CHECKER_H_
+
+#include "psmodel.h"
+#include "signal_T.h"
+#include "crc_engine.h"
+
+//  Checks the frames built by CrcGenerator, passes on
+//  the Frame_Len data bits of each, and reports the
+//  frame error rate from the CRC failures.
+
+class CrcChecker : public PracSimModel
+{
+public:
+  CrcChecker( char* instance_name,
+              PracSimModel* outer_model,
+              Signal<bit_t>* in_signal,
+              Signal<bit_t>* out_signal );
+
+  ~CrcChecker(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Num_Frames;
+  int Frame_Len;
+  int Crc_Len;
+  crc_word_t Crc_Poly;
+  bool Invert_Crc;
+  int Num_Holdoff_Passes;
+  int Report_Intvl_In_Blocks;
+  Signal<bit_t> *In_Sig;
+  Signal<bit_t> *Out_Sig;
+  CrcEngine *Crc_Engine;
+  long long Frame_Count;
+  long long Frame_Error_Count;
+};
+
+#endif
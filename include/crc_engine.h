@@ -0,0 +1,53 @@
+//
+//  File = crc_engine.h
+//
+
+#ifndef _CRC_ENGINE_H_
+#define _CRC_ENGINE_H_
+
+#include "typedefs.h"
+
+typedef unsigned long long crc_word_t;
+
+#define CRC_MAX_LEN 64
+
+//======================================================
+//  CRC of a bit stream, first bit as the highest-degree
+//  coefficient.  crc_poly holds the generator without
+//  its x**crc_len term (CRC-32 is 0x04c11db7).  With
+//  invert set the register starts as all ones and the
+//  result is complemented.
+//
+//  Bits are packed eight to a byte and the register is
+//  kept in the top crc_len bits of a 64-bit word, so
+//  eight bytes at a time are folded in with one lookup
+//  in each of eight tables (slicing-by-8).
+
+class CrcEngine
+{
+public:
+  CrcEngine( int crc_len,
+             crc_word_t crc_poly,
+             bool invert );
+
+  crc_word_t Compute( const bit_t *bits_in, int num_bits );
+
+  //  writes the CRC of num_bits bits as the crc_len bits
+  //  that follow them, highest-degree first
+  void Append( bit_t *frame, int num_bits );
+
+  //  true if the crc_len bits after the first num_bits
+  //  match the CRC of those bits
+  bool Check( const bit_t *frame, int num_bits );
+
+  int GetCrcLen(void){return Crc_Len;};
+
+private:
+  int Crc_Len;
+  crc_word_t Poly_Aligned;
+  crc_word_t Init_Reg;
+  crc_word_t Final_Xor;
+  crc_word_t Slice_Table[8][256];
+};
+
+#endif
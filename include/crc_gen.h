@@ -0,0 +1,40 @@
+//
+//  File = crc_gen.h
+//
+
+#ifndef _CRC_GEN_H_
+#define _CRC_GEN_H_
+
+#include "psmodel.h"
+#include "signal_T.h"
+#include "crc_engine.h"
+
+//  Appends a Crc_Len-bit CRC to every Frame_Len input
+//  bits.  Crc_Poly is the generator without its
+//  x**Crc_Len term, in hex (CRC-32 is 0x04c11db7).
+
+class CrcGenerator : public PracSimModel
+{
+public:
+  CrcGenerator( char* instance_name,
+                PracSimModel* outer_model,
+                Signal<bit_t>* in_signal,
+                Signal<bit_t>* out_signal );
+
+  ~CrcGenerator(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Num_Frames;
+  int Frame_Len;
+  int Crc_Len;
+  crc_word_t Crc_Poly;
+  bool Invert_Crc;
+  Signal<bit_t> *In_Sig;
+  Signal<bit_t> *Out_Sig;
+  CrcEngine *Crc_Engine;
+};
+
+#endif
@@ -0,0 +1,95 @@
+//
+//  File = cross_corr_T.h
+//
+
+#ifndef _CROSS_CORR_T_H_
+#define _CROSS_CORR_T_H_
+
+#include <complex>
+#include "fft_plan_T.h"
+#include "peak_interp.h"
+
+//  samples on each side of the peak used by sinc
+//  interpolation
+#define CORR_SINC_HALF_LEN 8
+
+//======================================================
+//  FFT cross-correlation engine for real signals.
+//
+//  Segments of Seg_Len samples are zero padded to Fft_Len,
+//  the smallest power of 2 that is at least 2*Seg_Len, so
+//  the circular correlation equals the linear one for lags
+//  of magnitude less than Fft_Len/2.  When both signals
+//  change, they are transformed together as the real and
+//  imaginary parts of one complex FFT.  When the reference
+//  is static, its spectrum is cached by SetReference() and
+//  each input segment costs one half-length FFT.  The
+//  correlation is recovered with a half-length inverse
+//  FFT, so the result is real with no wasted work.
+//
+//  The cross spectrum is X(k) * conj(Y(k)) / Fft_Len, held
+//  at all Fft_Len bins.  The correlation is
+//  r(m) = sum over n of x(n+m) * y(n), with lag m stored at
+//  index m for m >= 0 and at index Fft_Len+m for m < 0.
+
+template <class T>
+class CrossCorrelator
+{
+public:
+  CrossCorrelator( int seg_len );
+  ~CrossCorrelator(void);
+
+  //  negates the input signal before correlating
+  void SetInputInversion( bool invert_input );
+
+  //  caches the spectrum of a static reference segment
+  void SetReference( const T* ref_seg );
+
+  //  cross spectrum only
+  void CrossSpectrum( const T* in_seg, const T* ref_seg );
+  void CrossSpectrum( const T* in_seg );
+
+  //  cross spectrum followed by the correlation
+  void Correlate( const T* in_seg, const T* ref_seg );
+  void Correlate( const T* in_seg );
+
+  //  Overlap-save correlation of a continuous stream with
+  //  the cached reference.  out_sig[i] is the correlation
+  //  of the reference with the Seg_Len input samples
+  //  ending at in_sig[i].  Any num_samps may be passed.
+  void Filter( const T* in_sig, T* out_sig, int num_samps );
+
+  std::complex<T>* GetCrossSpectrum(void){return Cross_Spect;};
+  T* GetCorrelation(void){return Corr;};
+  int GetFftLen(void){return Fft_Len;};
+  int GetSegLen(void){return Seg_Len;};
+
+  //  lag in [min_lag, max_lag] of the largest correlation
+  int FindPeak( int min_lag, int max_lag );
+
+  //  fractional lag of the peak nearest peak_lag
+  double InterpolatePeak( int peak_lag, PEAK_INTERP_T interp_mode );
+
+private:
+  void RealSpectrum( const T* seg,
+                     int num_samps,
+                     T scale,
+                     std::complex<T>* spect );
+  void MirrorSpectrum(void);
+  void InverseToCorrelation(void);
+  double SincInterp( int peak_lag, double offset );
+
+  int Seg_Len;
+  int Fft_Len;
+  int Half_Len;
+  T In_Sign;
+  FftPlan<T> *Full_Plan;
+  FftPlan<T> *Half_Plan;
+  std::complex<T> *Work;
+  std::complex<T> *Cross_Spect;
+  std::complex<T> *Ref_Spect;
+  T *Corr;
+  T *Stream_Buf;
+};
+
+#endif
@@ -29,6 +29,7 @@ private:
   int* Coset_Start;
   int* Coset_Size;
   int* Element_Vector;
+  int* Coset_Index;
   int Num_Cosets;
   int Modulus;
 };
@@ -7,7 +7,7 @@
 
 #include "signal_T.h"
 #include "psmodel.h"
-//#include "k_berctr.h"
+#include "ngram_stats.h"
 
 
 class DiceAnalyzer : public PracSimModel
@@ -23,11 +23,13 @@ DiceAnalyzer( char* instance_name,
 
 private:
   int Block_Size;
-  int *Symb_Count;
-  int *Double_Count;
   Signal<byte_t> *In_Sig;
   int Report_Intvl_In_Blocks;
   int Faces_Per_Die;
+  int Ngram_Order;
+  bool Continuous_Run;
+  int Num_Threads;
+  NgramStats *Stats;
   //int Num_Diff_Symbs;
   //int *Histogram;
   
@@ -7,6 +7,7 @@
 
 #include "signal_T.h"
 #include "anlg_filt_iir.h"
+#include "k_pll_engine.h"
 
 class DigitalPLL : public PracSimModel
 {
@@ -24,6 +25,9 @@ public:
    int Execute(void);
 
 private:
+   template <int Diag_Mask> void RunLoop(int block_size);
+   typedef void (DigitalPLL::*LoopFnPtr)(int);
+
    double Samp_Intvl;
    Signal<float> *fsig_Input;
    Signal<float> *fsig_Filtered_Error;
@@ -49,6 +53,9 @@ private:
    double Center_Freq_Hz;
    float Osc_Output_Prev_Val;
    AnalogFilterByIir<float> *Filter_Core;
+   k_Nco *Osc;
+   int Diag_Mask;
+   LoopFnPtr Run_Loop;
 };
 
 #endif
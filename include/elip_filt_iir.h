@@ -26,6 +26,14 @@ public:
 //                    bool bypass_enabled);
   ~EllipticalFilterByIir(void);
   //virtual void Initialize(void);
+protected:
+  // members of the dependent base class
+  using AnalogFilterByIir<T>::Model_Name;
+  using AnalogFilterByIir<T>::Bypass_Enabled;
+  using AnalogFilterByIir<T>::Lowpass_Proto_Filt;
+  using AnalogFilterByIir<T>::Prototype_Order;
+  using AnalogFilterByIir<T>::Norm_Hz_Pass_Edge;
+  using AnalogFilterByIir<T>::Norm_Hz_Stop_Edge;
 private:
   double Passband_Ripple_In_Db;
   double Stopband_Ripple_In_Db;
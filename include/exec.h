@@ -5,14 +5,24 @@
 #ifndef _EXEC_H_
 #define _EXEC_H_
 
+// range of block size scalings tried by the tuner,
+// as powers of two relative to the SignalAnchor sizes
+#define BLOCK_TUNE_MIN_LOG2 -3
+#define BLOCK_TUNE_MAX_LOG2 3
+
 class Executive
 {
 public:
   Executive(void);
   ~Executive(void);
   void MultirateSetup(void);
+  void EnableBlockSizeTuning(int num_tuning_passes);
 private:
-  
+  void TuneBlockSize(void);
+  double TimeBlockSizeCandidate( int scale_numer,
+                                 int scale_denom );
+  bool Block_Tuning_Enabled;
+  int Num_Tuning_Passes;
 };
 
 #endif //_EXEC_H_
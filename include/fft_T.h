@@ -43,4 +43,21 @@ void FFT( std::complex<double>* input, std::complex<T>* output,
 template< class T>
 void FFT( std::complex<T>* signal, int size );  
 
+//  Real-input FFT.  The fft_len real samples are packed two
+//  per complex value (even samples in the real parts, odd
+//  samples in the imaginary parts), transformed with an
+//  fft_len/2 point complex FFT, and then split into bins
+//  0 through fft_len/2 of the real signal's spectrum.  The
+//  packed signal is overwritten.  Twiddles come from a
+//  table of fft_len/2 values built by RealFftTwiddles().
+
+template <class T>
+void RealFftTwiddles( std::complex<T>* twiddles, int fft_len );
+
+template <class T>
+void RealFFT( std::complex<T>* packed_signal,
+              std::complex<T>* twiddles,
+              std::complex<T>* sample_spectrum,
+              int fft_len );
+
 #endif // _FFT_T_H_
\ No newline at end of file
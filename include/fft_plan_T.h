@@ -0,0 +1,45 @@
+//
+// File = fft_plan_T.h
+//
+#ifndef _FFT_PLAN_T_H_
+#define _FFT_PLAN_T_H_
+
+#include <complex>
+
+//======================================================
+//  Precomputed twiddle and bit-reversal tables for an
+//  in-place radix-2 FFT of one length.  Plans are built
+//  by GetFftPlan() and shared for the rest of the run, so
+//  models that transform blocks of the same size every
+//  pass never recompute sines and cosines.
+
+template <class T>
+class FftPlan
+{
+public:
+  FftPlan( int fft_len );
+  ~FftPlan(void);
+
+  //  natural order in, natural order out; the inverse
+  //  is not scaled by 1/fft_len
+  void Forward( std::complex<T>* array );
+  void Inverse( std::complex<T>* array );
+
+  //  Twiddles[k] = exp(-j*2*pi*k/fft_len), k < fft_len/2
+  const std::complex<T>* GetTwiddles(void){return Twiddles;};
+  int GetFftLen(void){return Fft_Len;};
+
+private:
+  void Transform( std::complex<T>* array, bool inverse );
+
+  int Fft_Len;
+  std::complex<T> *Twiddles;
+  int *Bit_Rev;
+};
+
+//  returns the shared plan for fft_len (a power of 2),
+//  building it on first use
+template <class T>
+FftPlan<T>* GetFftPlan( int fft_len );
+
+#endif // _FFT_PLAN_T_H_
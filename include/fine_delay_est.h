@@ -10,6 +10,7 @@
 #include "control_T.h"
 #include "psmodel.h"
 #include "aux_sig_buf.h"
+#include "cross_corr_T.h"
 
 class FineDelayEstimator : public PracSimModel
 {
@@ -31,17 +32,8 @@ private:
   int Proc_Block_Size;
   double Samp_Intvl;
 
-  // correlation array - contains In_Sig
-  // values and is padded out with zeros
-  std::complex<float> *X;
-
-  // correlation array - contains Ref_Sig
-  // values and is padded out with zeros
-  std::complex<float> *Y;
-
-  // an array of zeros used to quickly
-  // pad the ends of X and Y with zeros
-  std::complex<float> *Zero_Array;
+  // FFT correlation engine sized for Proc_Block_Size
+  CrossCorrelator<float> *Corr_Engine;
 
   std::complex<float> Max_Corr;
   float Max_Corr_Angle;
@@ -50,10 +42,6 @@ private:
   int Full_Corr_Size;
 //  int Search_Window_Beg;
 //  int Search_Window_End;
-//  int Neg_Window_Beg;
-//  int Neg_Window_End;
-//  int Pos_Window_Beg;
-//  int Pos_Window_End;
   bool Invert_Input_Sig_Enab;
 //  bool Limited_Search_Window_Enab;
 //  int Smoothing_Sidelobe_Len;
@@ -62,9 +50,6 @@ private:
   AuxSignalBuffer<float> *In_Sig_Buf;
   AuxSignalBuffer<float> *Ref_Sig_Buf;
 
-  int Size_Of_FComplex;
-
-  double Ns_Exp;
   Signal<float> *In_Sig;
  // Signal<float> *Out_Sig;
   Signal<float> *Ref_Sig;
@@ -0,0 +1,20 @@
+//
+//  File = flat_top.h
+//
+
+#ifndef _FLAT_TOP_H_
+#define _FLAT_TOP_H_
+
+#include "gen_win.h"
+//======================================================
+//  5-term flat-top window, for amplitude accuracy of
+//  tones that fall between bins
+
+class FlatTopWindow : public GenericWindow
+{
+public:
+   FlatTopWindow( int length );
+   void GenerateWindow( int length );
+};
+
+#endif
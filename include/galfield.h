@@ -7,15 +7,21 @@
 
 #include "poly_pf.h"
 #include "xfelem.h"
+#include "gf2m_field.h"
 
 class GaloisField
 {
 public:
 
   GaloisField( int base, int order, PolyOvrPrimeField *prim_poly );
+  ~GaloisField( void );
   int GetDegree( void );
   int GetBase( void );
   ExtenFieldElem GetElement(int expon);
+
+  // table-driven arithmetic for base 2 and degree up to
+  // GF2M_MAX_DEGREE; NULL for other fields
+  Gf2mField* GetFastField( void ){return Fast_Field;};
   friend class ExtFieldElem;
   friend ExtenFieldElem operator*( const ExtenFieldElem,
                                const ExtenFieldElem);
@@ -26,6 +32,7 @@ private:
   int Degree;
   PolyOvrPrimeField *Prim_Poly;
   PrimeFieldElem *Reduc_Poly;
+  Gf2mField *Fast_Field;
   long dummy1;
 };
 
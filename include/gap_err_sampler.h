@@ -0,0 +1,83 @@
+//
+//  File = gap_err_sampler.h
+//
+
+#ifndef _GAP_ERR_SAMPLER_H_
+#define _GAP_ERR_SAMPLER_H_
+
+#include <vector>
+#include "typedefs.h"
+
+//======================================================
+//  Error pattern generator for binary channels that draws
+//  the number of correct bits before the next error from
+//  a geometric distribution, so the work per block is
+//  proportional to the number of errors rather than the
+//  number of bits.
+//
+//  The two-state form is a Gilbert-Elliott channel: each
+//  state has its own error probability, and the state
+//  changes after each bit with probability good_to_bad
+//  or bad_to_good.  Dwell times in a state are geometric
+//  too and are drawn the same way.
+
+class GapErrorSampler
+{
+public:
+  //  memoryless binary symmetric channel
+  GapErrorSampler( double error_prob,
+                   long seed );
+
+  //  Gilbert-Elliott channel, starting in the good state
+  GapErrorSampler( double good_error_prob,
+                   double bad_error_prob,
+                   double good_to_bad_prob,
+                   double bad_to_good_prob,
+                   long seed );
+
+  //  complements the bits in error; returns the number
+  int Inject( bit_t *bits, int num_bits );
+
+  //  same for bits packed 64 to a word, bit i in bit i%64
+  //  of word i/64
+  int InjectPacked( unsigned long long *words, int num_bits );
+
+  long long GetErrorCount(void){return Error_Count;};
+  long long GetBitCount(void){return Bit_Count;};
+  bool IsInBadState(void){return In_Bad_State;};
+
+  //  long-run error probability
+  double GetMeanErrorProb(void);
+
+private:
+  void Setup( double good_error_prob,
+              double bad_error_prob,
+              double good_to_bad_prob,
+              double bad_to_good_prob,
+              bool two_state,
+              long seed );
+  long long DrawGap( double log_keep_prob );
+  void FindErrors( int num_bits );
+
+  bool Two_State;
+  bool In_Bad_State;
+  double Error_Prob[2];
+  double Switch_Prob[2];
+
+  //  log(1-p) for the error and switch probabilities
+  double Log_No_Error[2];
+  double Log_No_Switch[2];
+
+  long Seed;
+
+  //  correct bits before the next error, and bits left in
+  //  the current state
+  long long Gap_To_Error;
+  long long Bits_In_State;
+
+  long long Error_Count;
+  long long Bit_Count;
+  std::vector<int> Err_Pos;
+};
+
+#endif
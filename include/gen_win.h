@@ -12,11 +12,13 @@ class GenericWindow
 {
 public:
   GenericWindow( int length );
+  virtual ~GenericWindow( void );
   double GetDataWinCoeff( int samp_indx);
   void NormalizeWindow( void );
   double* GetDataWindow( void );
   double* GetHalfLagWindow( void );
   int GetNumTaps( void );
+  double GetEnbw( void );
 protected:
   void Initialize( int length );
   int Length;
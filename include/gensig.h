@@ -26,7 +26,19 @@ public:
    double GetSampIntvl(void);
    void SetSampIntvl(double samp_intvl);
    void SetAllocMemDepth( int req_mem_depth );
-   virtual void AllocateSignalBuffer(void){};
+   int GetAllocMemDepth(void);
+   bool HasConsumers(void);
+   bool PlottingIsEnabled(void);
+   void SetProducer( PracSimModel* model );
+   PracSimModel* GetProducer(void);
+   int GetNumConsumers(void);
+   PracSimModel* GetConsumer(int conn_num);
+   void SetAliasSource( GenericSignal* src_sig );
+   bool IsAliased(void);
+   GenericSignal* GetAliasRoot(void);
+   virtual int GetSampleSize(void){return(0);};
+   virtual void AllocateSignalBuffer(char* phys_buf_beg){};
+   virtual void AliasSignalBuffer(void){};
    GenericSignal* GetId();
    virtual void InitializeReadPtrs(void){};
    virtual void SetupPlotSignal(void){};
@@ -40,6 +52,8 @@ public:
    virtual void PassUpdate(void){};
    double GetTimeAtBeg(void);
    void SetTimeAtBeg(double time_at_beg);
+   void SetBlockGranularity( int samps_per_frame );
+   int GetBlockGranularity(void);
    void SetEnclave(int enclave_num);
    int GetEnclave(void);
 protected:
@@ -49,6 +63,7 @@ protected:
    int Prev_Block_Size;
    long Cumul_Samps_Thru_Prev_Block;
    int Alloc_Mem_Depth;
+   int Block_Granularity;
    double Samp_Intvl;
    char* Name;
    PracSimModel* Owning_Model;
@@ -68,7 +83,10 @@ protected:
    int Cumul_Samp_Cnt;
    double Time_At_Beg;
    int Enclave_Num;
+   GenericSignal* Alias_Src;
+   PracSimModel* Producer_Model;
    std::vector<GenericSignal*> *Connected_Sigs;
+   std::vector<GenericSignal*> *Alias_Sigs;
 };
 
 #endif //_GENSIG_H_
@@ -0,0 +1,88 @@
+//
+//  File = gf2m_field.h
+//
+
+#ifndef _GF2M_FIELD_H_
+#define _GF2M_FIELD_H_
+
+typedef unsigned short gf_elem_t;
+
+#define GF2M_MAX_DEGREE 16
+
+//  below this many elements the bulk routines use the
+//  log tables rather than building split tables
+#define GF2M_SPLIT_MIN_LEN 32
+
+//======================================================
+//  Arithmetic in GF(2**m), m <= 16, with each element
+//  held as the integer whose bit i is the coefficient of
+//  alpha**i.  Log and antilog tables are built once by
+//  the constructor; the antilog table is stored twice
+//  over so a product needs no modulo.
+//
+//  The bulk routines multiply a whole vector by one
+//  constant.  When built with _GF_SSSE3 (or -mssse3) they
+//  use nibble-indexed split tables and PSHUFB; otherwise
+//  they use the log tables.
+
+class Gf2mField
+{
+public:
+  //  prim_poly_bits includes the x**degree term; zero
+  //  selects the simplest primitive polynomial
+  Gf2mField( int degree, unsigned long prim_poly_bits = 0 );
+  ~Gf2mField(void);
+
+  int GetDegree(void){return Degree;};
+  int GetOrder(void){return Order;};
+  unsigned long GetPrimPoly(void){return Prim_Poly;};
+
+  static gf_elem_t Add( gf_elem_t a, gf_elem_t b ){return(a ^ b);};
+  gf_elem_t Mul( gf_elem_t a, gf_elem_t b )
+    { return( (a == 0 || b == 0) ? 0 : Exp_Table[Log_Table[a] + Log_Table[b]] ); };
+  gf_elem_t Div( gf_elem_t a, gf_elem_t b );
+  gf_elem_t Inverse( gf_elem_t a );
+  gf_elem_t Power( gf_elem_t a, int expon );
+
+  //  alpha**expon for any integer expon
+  gf_elem_t Exp( int expon );
+
+  //  log to the base alpha; a must be nonzero
+  int Log( gf_elem_t a ){return Log_Table[a];};
+
+  //  dest[i] = coeff * src[i]
+  void MulVector( gf_elem_t coeff,
+                  const gf_elem_t *src,
+                  gf_elem_t *dest,
+                  int num_elems );
+
+  //  dest[i] += coeff * src[i]
+  void MulAccumVector( gf_elem_t coeff,
+                       const gf_elem_t *src,
+                       gf_elem_t *dest,
+                       int num_elems );
+
+  //  minimal polynomial over GF(2) of alpha**expon, as a
+  //  bit mask of its coefficients
+  unsigned long MinimalPolyBits( int expon );
+
+private:
+  //  coeff * (d << 4k) split into low and high bytes,
+  //  16 entries for each nibble position k
+  void BuildSplitTables( gf_elem_t coeff,
+                         unsigned char split_lo[4][16],
+                         unsigned char split_hi[4][16] );
+  void SplitMulVector( gf_elem_t coeff,
+                       const gf_elem_t *src,
+                       gf_elem_t *dest,
+                       int num_elems,
+                       bool accumulate );
+
+  int Degree;
+  int Order;
+  unsigned long Prim_Poly;
+  int *Log_Table;
+  gf_elem_t *Exp_Table;
+};
+
+#endif
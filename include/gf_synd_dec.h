@@ -0,0 +1,73 @@
+//
+//  File = gf_synd_dec.h
+//
+
+#ifndef _GF_SYND_DEC_H_
+#define _GF_SYND_DEC_H_
+
+#include <vector>
+#include "gf2m_field.h"
+using namespace std;
+
+//  codewords whose syndromes are formed together
+#define GF_SYND_BATCH 64
+
+//======================================================
+//  Syndrome, error-locator and Chien-search stages shared
+//  by the Reed-Solomon and BCH decoders.  A codeword is
+//  code_len symbols, highest-degree coefficient first;
+//  syndrome j is the codeword evaluated at
+//  alpha**(first_root + j), j = 0 thru num_synd-1.
+
+class GfSyndromeDecoder
+{
+public:
+  GfSyndromeDecoder( Gf2mField *field,
+                     int code_len,
+                     int num_synd,
+                     int first_root );
+  ~GfSyndromeDecoder(void);
+
+  //  synd[iw*num_synd + j] for each of num_cws codewords
+  //  stored one after another.  Each batch of codewords is
+  //  transposed so Horner's rule steps across the batch
+  //  with one vector multiply per root and symbol.
+  void ComputeSyndromes( const gf_elem_t *cws,
+                         int num_cws,
+                         gf_elem_t *synd );
+
+  //  Berlekamp-Massey; fills locator[0..num_synd/2] and
+  //  returns its degree, or -1 if that exceeds num_synd/2
+  int FindErrorLocator( const gf_elem_t *synd,
+                        gf_elem_t *locator );
+
+  //  positions p (error in the coefficient of x**p) of the
+  //  roots alpha**(-p) of the locator; returns the count,
+  //  or -1 if it does not equal the locator's degree
+  int FindErrorPositions( const gf_elem_t *locator,
+                          int num_errs,
+                          int *err_pos );
+
+  int GetNumSynd(void){return Num_Synd;};
+
+private:
+  Gf2mField *Field;
+  int Code_Len;
+  int Num_Synd;
+  int Max_Errs;
+  int First_Root;
+
+  //  alpha**(first_root + j) for each syndrome
+  gf_elem_t *Synd_Roots;
+
+  //  Chien_Table[(j-1)*Code_Len + p] = alpha**(-j*p)
+  gf_elem_t *Chien_Table;
+
+  vector<gf_elem_t> Batch_Syms;
+  vector<gf_elem_t> Batch_Synd;
+  vector<gf_elem_t> Chien_Sum;
+  vector<gf_elem_t> Prev_Locator;
+  vector<gf_elem_t> Temp_Locator;
+};
+
+#endif
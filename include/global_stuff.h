@@ -19,6 +19,7 @@
 #include "reports.h"
 #include "exec.h"
 #include "psstream.h"
+#include "spect_result.h"
    
 ofstream LongReport;
 ofstream ShortReport;
@@ -35,8 +36,12 @@ Executive Exec;
 PracSimModel *PrevModelConstr;
 PracSimModel *ActiveModel;
 SignalPlotter SigPlot;
+SpectrumRegistry SpectRegistry;
 int PassNumber;
 int MaxPassNumber;
+bool SimStopRequested;
+int SimStopVoters;  // models that may ask to end the run
+int SimStopVotes;   // those that have asked
 int EnclaveNumber;
 int EnclaveOffset[10];
 
@@ -7,6 +7,16 @@
 
 #include "psmodel.h"
 #include "signal_T.h"
+#include "stats_accum.h"
+
+//======================================================
+//  Tallies a histogram plus the mean, variance and
+//  (optionally) skewness and kurtosis of the input.
+//  If Num_Segs_To_Tally is positive, the results are
+//  written once after that many blocks.  If it is zero,
+//  tallying continues for the whole run and the results
+//  are rewritten every Report_Intvl_In_Blocks blocks and
+//  again when the model is destroyed.
 
 template <class T>
 class HistogramBuilder : public PracSimModel
@@ -21,6 +31,8 @@ public:
    int Execute(void);
 
 private:
+   void WriteReport(void);
+
    int Block_Size;
    int Num_Segs_To_Tally;
    int Segs_In_Tally;
@@ -28,18 +40,18 @@ private:
    double Samp_Intvl;
    double *Hist_Bins;
    double Bin_Width;
+   double Left_Edge;
    int Num_Bins;
-   int Pts_In_Tally;
-   int Out_Of_Range_Count;
    int Ctr_Bin;
+   int Report_Intvl_In_Blocks;
    int Hold_Off;
    char *Hist_File_Name;
    ofstream *Hist_File;
    bool Halt_When_Completed;
    bool Processing_Completed;
    bool Positive_Only;
-   double Sum;
-   double Sum_Sqrs;
+   bool Higher_Moments_Enab;
+   StatsAccumulator *Stats;
 };
 
 #endif //_HISTOGRAM_H_
@@ -8,6 +8,7 @@
 #include "typedefs.h"
 #include "signal_T.h"
 #include "psmodel.h"
+#include "k_integ_dump_T.h"
 
 
 class IntegrateDumpAndSlice : public PracSimModel
@@ -36,7 +37,8 @@ private:
   double Symb_Width;
   double In_Samp_Intvl;
   double Out_Samp_Intvl;
-  double Integ_Val;
+  k_IntegrateAndDump<float> *Kernel;
+  float *Dump_Val;
   
 };
 
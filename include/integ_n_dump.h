@@ -8,6 +8,7 @@
 #include "typedefs.h"
 #include "signal_T.h"
 #include "psmodel.h"
+#include "k_integ_dump_T.h"
 
 
 class IntegrateAndDump : public PracSimModel
@@ -32,9 +33,9 @@ private:
   double Symb_Width;
   double In_Samp_Intvl;
   double Out_Samp_Intvl;
-  double Integ_Val;
-  double Integ_Gain;
-  
+  k_IntegrateAndDump<float> *Kernel;
+  int *Dump_Len;
+
 };
 
 #endif
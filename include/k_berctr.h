@@ -5,10 +5,13 @@
 #ifndef _K_BERCTR_H_
 #define _K_BERCTR_H_
 
+#include <vector>
 #include "typedefs.h"
 #include "signal_T.h"
 #include "psmodel.h"
 
+typedef unsigned long long ber_word_t;
+#define BER_WORD_BITS 64
 
 class k_BerCounter
 {
@@ -24,20 +27,80 @@ public:
                 bit_t * ref_sig,
                 int block_size);
 
+  //  With max_lag > 0 the decisions may lag the reference
+  //  by an unknown 0 thru max_lag bits.  The first
+  //  sync_window_len counted bits are correlated against
+  //  the reference at every lag and the best lag is kept
+  //  if it has no more than max_window_errs errors.  While
+  //  in sync, any later window with more errors than that
+  //  declares sync lost and the delay is acquired again;
+  //  the window's errors remain counted.  Bits received
+  //  while acquiring are not counted.
+  void SetDelaySearch( int max_lag,
+                       int sync_window_len,
+                       int max_window_errs );
+
+  //  conf_level > 0 adds Wilson and Clopper-Pearson
+  //  intervals to each report.  If target_rel_precision
+  //  is > 0, the counter votes to stop the run once the
+  //  interval half-width falls to that fraction of the
+  //  measured BER; the run stops when every counter with
+  //  a target has voted.
+  void SetConfidence( double conf_level,
+                      double target_rel_precision );
+
+  long long GetBitCount(void){return Bit_Count;};
+  long long GetErrorCount(void){return Error_Count;};
+  int GetCurrentLag(void){return Curr_Lag;};
+  bool IsInSync(void){return In_Sync;};
+
 private:
+  void Tally( const bit_t *in_bits,
+              const bit_t *ref_bits,
+              int num_bits );
+  int Acquire( const bit_t *in_bits,
+               int blk_pos,
+               int num_bits );
+  void SearchLag(void);
+  void WriteReport(void);
+  bool PrecisionReached(void);
+
   int Block_Size;
-  int Bit_Count;
-  int Bit_0_Count;
-  int Bit_1_Count;
-  int Error_Count;
-  int Error_0_Count;
-  int Error_1_Count;
+  long long Bit_Count;
+  long long Bit_0_Count;
+  long long Bit_1_Count;
+  long long Error_Count;
+  long long Error_0_Count;
+  long long Error_1_Count;
   Signal<bit_t> *In_Sig;
   Signal<bit_t> *Ref_Sig;
   int Num_Holdoff_Passes;
   int Report_Intvl_In_Blocks;
   char *Instance_Name;
-  
+
+  // delay search and sync tracking
+  int Max_Lag;
+  int Sync_Window_Len;
+  int Max_Window_Errs;
+  bool In_Sync;
+  int Curr_Lag;
+  int Num_Sync_Losses;
+  long long Window_Bits;
+  long long Window_Errs;
+
+  // last Max_Lag reference bits followed by current block
+  std::vector<bit_t> Ref_Hist;
+
+  // packed bits collected while acquiring
+  std::vector<ber_word_t> Acq_In;
+  std::vector<ber_word_t> Acq_Ref;
+  int Acq_Count;
+  int Acq_Ref_Count;
+
+  double Conf_Level;
+  double Target_Rel_Precision;
+  bool Stop_Voter;
+  bool Stop_Vote_Cast;
 };
 
 #endif
@@ -0,0 +1,71 @@
+//
+//  File = k_integ_dump_T.h
+//
+
+#ifndef _K_INTEG_DUMP_T_H_
+#define _K_INTEG_DUMP_T_H_
+
+#include <complex>
+#include "typedefs.h"
+
+// number of independent strips used when forming the
+// prefix sum, so that the additions are not one long
+// serial dependency chain
+#define INTEG_DUMP_NUM_LANES 4
+
+//======================================================
+//  Running sums are carried in double precision (or
+//  complex<double>) regardless of the sample type so that
+//  differences of prefix sums are as accurate as the
+//  sample-by-sample accumulation they replace.
+
+template <class T>
+struct IntegDumpAccum
+{
+  typedef double acc_t;
+};
+
+template <>
+struct IntegDumpAccum< std::complex<float> >
+{
+  typedef std::complex<double> acc_t;
+};
+
+//======================================================
+//  Block-wise integrate-and-dump kernel.
+//
+//  Execute() forms the prefix sum of the input block, then
+//  produces one integrated value per nonzero symbol clock
+//  sample by differencing the prefix sum at the strobe
+//  positions.  The partial symbol at the end of each block
+//  is carried into the next block the same way a signal's
+//  Alloc_Mem_Depth region carries samples across passes.
+
+template <class T>
+class k_IntegrateAndDump
+{
+public:
+  typedef typename IntegDumpAccum<T>::acc_t acc_t;
+
+  k_IntegrateAndDump( int max_block_size );
+  ~k_IntegrateAndDump(void);
+  void Initialize(void);
+  int Execute(  T *in_sig_ptr,
+                bit_t *symb_clock_ptr,
+                int block_size,
+                T *dump_val_ptr,
+                int *dump_len_ptr );
+  void GetPartialSums( T *partial_sum_ptr );
+
+private:
+  void PrefixSum( T *in_sig_ptr, int block_size );
+
+  int Max_Block_Size;
+  int Block_Size;
+  acc_t *Prefix_Sum;
+  bit_t *Symb_Clock_Ptr;
+  acc_t Carry_Sum;
+  int Carry_Count;
+};
+
+#endif
@@ -0,0 +1,139 @@
+//
+//  File = k_pll_engine.h
+//
+//  Building blocks shared by the carrier-recovery loops
+//  (CostasLoop, LinearPLL, DigitalPLL, BandpassSquaringPLL)
+//
+
+#ifndef _K_PLL_ENGINE_H_
+#define _K_PLL_ENGINE_H_
+
+#include "anlg_filt_iir.h"
+
+//======================================================
+//  Bits identifying the diagnostic outputs of a loop.
+//  Each loop model runs a version of its sample loop that
+//  is compiled for exactly the set of diagnostic outputs
+//  that have consumers, so unused outputs cost nothing.
+
+#define LOOP_DIAG_PHASE_ERROR   1
+#define LOOP_DIAG_FILT_ERROR    2
+#define LOOP_DIAG_OSC_OUTPUT    4
+#define LOOP_DIAG_OSC_FREQ      8
+#define LOOP_DIAG_OSC_PHASE     16
+#define LOOP_DIAG_NUM_MASKS     32
+
+// table of the LOOP_DIAG_NUM_MASKS instantiations of a
+// loop model's RunLoop<Diag_Mask> member template
+#define LOOP_DIAG_TABLE_8(C,B) \
+   &C::RunLoop<B+0>, &C::RunLoop<B+1>, &C::RunLoop<B+2>, \
+   &C::RunLoop<B+3>, &C::RunLoop<B+4>, &C::RunLoop<B+5>, \
+   &C::RunLoop<B+6>, &C::RunLoop<B+7>
+#define LOOP_DIAG_TABLE(C) { \
+   LOOP_DIAG_TABLE_8(C,0), LOOP_DIAG_TABLE_8(C,8), \
+   LOOP_DIAG_TABLE_8(C,16), LOOP_DIAG_TABLE_8(C,24) }
+
+// sets the bit for a diagnostic output if it has consumers
+#define LOOP_DIAG_IF_USED(SIG,BIT) \
+   ( ((SIG)->HasConsumers()) ? (BIT) : 0 )
+
+//======================================================
+//  Loop filter realized in transposed direct form II
+//  (i.e. a state-space form with one state per pole).
+//  The coefficients are taken from a subordinate
+//  AnalogFilterByIir after it has been initialized, and
+//  ProcessSample() is inline so the per-sample cost is
+//  just the multiply-adds of the recursion.
+
+class k_StateSpaceLoopFilter
+{
+public:
+   k_StateSpaceLoopFilter( AnalogFilterByIir<float> *filter_core );
+   ~k_StateSpaceLoopFilter(void);
+   void Reset(void);
+
+   inline double ProcessSample(double input_val)
+   {
+      double output_val;
+      int idx;
+
+      output_val = B_Coefs[0] * input_val + State[0];
+      for(idx=1; idx<Filt_Order; idx++){
+         State[idx-1] = B_Coefs[idx] * input_val
+                        + A_Coefs[idx] * output_val
+                        + State[idx];
+      }
+      if(Filt_Order > 0){
+         State[Filt_Order-1] = B_Coefs[Filt_Order] * input_val
+                               + A_Coefs[Filt_Order] * output_val;
+      }
+      return(output_val);
+   };
+
+private:
+   int Filt_Order;
+   double *A_Coefs;
+   double *B_Coefs;
+   double *State;
+};
+
+//======================================================
+//  Numerically controlled oscillator.  Phase is held in a
+//  32-bit accumulator that wraps naturally at 2*pi, and
+//  sin/cos come from a shared table with linear
+//  interpolation instead of calls to the math library.
+
+#define NCO_TABLE_BITS 10
+#define NCO_TABLE_SIZE (1<<NCO_TABLE_BITS)
+
+class k_Nco
+{
+public:
+   k_Nco(void);
+   ~k_Nco(void);
+   void Reset(void);
+
+   // advance the phase by phase_incr radians
+   inline void Advance(double phase_incr)
+   {
+      Phase_Word += (unsigned int)(long long)(phase_incr * Words_Per_Rad);
+   };
+
+   // phase in radians, in the range [-pi, pi)
+   inline double GetPhase(void)
+   {
+      return( int(Phase_Word) * Rad_Per_Word );
+   };
+
+   inline float Sin(void)
+   {
+      return( TableLookup(Phase_Word) );
+   };
+
+   inline float Cos(void)
+   {
+      return( TableLookup(Phase_Word + (1u<<30)) );
+   };
+
+   // table sine of an arbitrary phase given in radians
+   inline float SinOfPhase(double phase)
+   {
+      return( TableLookup( (unsigned int)(long long)(phase * Words_Per_Rad) ));
+   };
+
+private:
+   inline float TableLookup(unsigned int phase_word)
+   {
+      unsigned int idx = phase_word >> (32-NCO_TABLE_BITS);
+      float frac = float(phase_word << NCO_TABLE_BITS) * Frac_Scale;
+      return( Sine_Table[idx] + frac * (Sine_Table[idx+1] - Sine_Table[idx]) );
+   };
+
+   unsigned int Phase_Word;
+   static float *Sine_Table;
+   static const double Words_Per_Rad;
+   static const double Rad_Per_Word;
+   static const float Frac_Scale;
+};
+
+#endif
@@ -0,0 +1,90 @@
+//
+//  File = k_viterbi.h
+//
+
+#ifndef _K_VITERBI_H_
+#define _K_VITERBI_H_
+
+#include <vector>
+#include "typedefs.h"
+
+#define VIT_MIN_CONSTR_LEN 3
+#define VIT_MAX_CONSTR_LEN 9
+#define VIT_MAX_OUTPUTS 4
+
+//  soft values are quantized to +/- VIT_MAX_SOFT
+#define VIT_MAX_SOFT 127
+
+//  steps between path-metric renormalizations
+#define VIT_RENORM_INTVL 16
+
+//======================================================
+//  Soft-decision Viterbi decoder for rate 1/n
+//  convolutional codes.  Generator polynomials have the
+//  current input bit in bit constr_len-1, as used by
+//  BitEncodingTable.  Soft values are positive for a 1.
+//
+//  Each call decodes as many bits as it is given, delayed
+//  by traceback_depth bits.  Soft values from the end of
+//  one call are kept to warm up and terminate the
+//  traceback of the next, so block boundaries are not
+//  seen in the output.  Within a call the bits are split
+//  into equal overlapping segments, one per SIMD lane,
+//  and all lanes run add-compare-select together with
+//  16-bit saturating path metrics (AVX2 with _VIT_AVX2 or
+//  -mavx2, SSE2 with _VIT_SSE2 or -msse2, else scalar).
+
+class k_ViterbiDecoder
+{
+public:
+  k_ViterbiDecoder( int constr_len,
+                    int num_outputs,
+                    const int *gen_polys,
+                    int traceback_depth,
+                    float soft_scale );
+  ~k_ViterbiDecoder(void);
+
+  //  num_bits*num_outputs soft values in, num_bits
+  //  decisions out
+  void Execute( const float *soft_in,
+                bit_t *bits_out,
+                int num_bits );
+
+  int GetDelay(void){return Traceback_Depth;};
+  static int GetNumLanes(void);
+
+private:
+  void DecodeLanes( int num_steps );
+  void TraceBack( int lane,
+                  int num_steps,
+                  bit_t *lane_out,
+                  int num_out );
+
+  int Constr_Len;
+  int Num_Outputs;
+  int Num_States;
+  int Num_Lanes;
+  int Traceback_Depth;
+  int Warmup_Len;
+  float Soft_Scale;
+
+  //  output pattern of the branch into state s from
+  //  predecessor choice d is Branch_Out[2*s + d]
+  std::vector<int> Branch_Out;
+
+  //  quantized soft values, Warmup_Len + Traceback_Depth
+  //  bits carried from the previous call followed by
+  //  the new ones
+  std::vector<short> Soft_Hist;
+
+  //  per-step soft values, lanes innermost
+  std::vector<short> Lane_Soft;
+  std::vector<short> Branch_Metric;
+  std::vector<short> Path_Metric;
+  std::vector<short> New_Metric;
+
+  //  one bit per lane for each step and state
+  std::vector<unsigned short> Decisions;
+};
+
+#endif
@@ -0,0 +1,17 @@
+//
+//  File = kaiser.h
+//
+
+#ifndef _KAISER_H_
+#define _KAISER_H_
+
+#include "gen_win.h"
+//======================================================
+class KaiserWindow : public GenericWindow
+{
+public:
+   KaiserWindow( int length, double beta );
+   void GenerateWindow( int length, double beta );
+};
+
+#endif
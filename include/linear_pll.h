@@ -7,6 +7,7 @@
 
 #include "signal_T.h"
 #include "anlg_filt_iir.h"
+#include "k_pll_engine.h"
 
 class LinearPLL : public PracSimModel
 {
@@ -26,6 +27,9 @@ LinearPLL( char* instance_nam,
    int Execute(void);
 
 private:
+   template <int Diag_Mask> void RunLoop(int block_size);
+   typedef void (LinearPLL::*LoopFnPtr)(int);
+
    double Samp_Intvl;
 
    Signal<float> *fsig_Input;
@@ -40,13 +44,16 @@ private:
    double K_Sub_D;
    double K_Sub_0;
    double OscOutput;
-   double Phi_Sub_2;
-   double Phi_Divided;
    double Omega_Sub_0;
    double Center_Freq_Hz;
    float Osc_Output_Prev_Val;
    double Scaler_Divisor;
   AnalogFilterByIir<float> *Filter_Core;
+  k_StateSpaceLoopFilter *Filter;
+  k_Nco *Osc;
+  k_Nco *Divided_Osc;
+  int Diag_Mask;
+  LoopFnPtr Run_Loop;
   
 };
 
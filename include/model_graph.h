@@ -53,6 +53,9 @@ public:
    double GetSampIntvl(int vtx_num);
   void SetBlockSize( GenericSignal* sig_id,
                      int block_size);
+  void SetTunableBlockSize( GenericSignal* sig_id,
+                            int block_size);
+  bool BlockSizeIsTunable(int vtx_num);
   bool ConnIsFeedback(int vtx_num);
   void DumpSigDepGraph(void);
   PracSimModel* GetOwningModel(void);
@@ -67,6 +70,7 @@ private:
   std::vector<SignalKinds_type> *Vertex_Kind;
   std::vector<bool> *Node_Is_Feedback;
   std::vector<int> *Block_Size;
+  std::vector<bool> *Block_Size_Is_Tunable;
   std::vector<double> *Samp_Intvl;
   std::vector<double> *Delta_Delay;
   std::vector<double> *Resamp_Rate;
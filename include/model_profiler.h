@@ -0,0 +1,98 @@
+//
+//  File = model_profiler.h
+//
+
+#ifndef _MODEL_PROFILER_H_
+#define _MODEL_PROFILER_H_
+
+#include <fstream>
+#include <vector>
+#include "psmodel.h"
+#include "gensig.h"
+using namespace std;
+
+typedef enum {
+  PROFILE_MODE_OFF,
+  PROFILE_MODE_FULL,     // every pass is timed
+  PROFILE_MODE_SAMPLED   // one pass in Sample_Intvl is timed
+  } PROFILE_MODE_T;
+
+//======================================================
+//  Times each system-level model's Execute() and counts
+//  the samples it handles, so that the end-of-run report
+//  shows where the time goes by model instance.  Samples
+//  are the valid block sizes of the model's output
+//  signals, or of its input signals for a sink.
+//
+//  Timed passes can also be written to a trace file in
+//  the Chrome trace event (JSON) format, with one span per
+//  model per pass, for viewing in chrome://tracing or
+//  Perfetto.
+
+class ModelProfiler
+{
+public:
+  ModelProfiler( PROFILE_MODE_T profile_mode,
+                 int sample_intvl );
+  ~ModelProfiler(void);
+
+  //  trace the first max_trace_passes timed passes
+  void EnableTrace( const char *trace_file_name,
+                    int max_trace_passes );
+
+  void AddModel( PracSimModel *model );
+  void AddCountedSignal( int model_num,
+                         GenericSignal *sig_id );
+
+  bool PassIsTimed( int pass_number );
+
+  //  nanoseconds from an arbitrary origin
+  static long long ReadClock(void);
+
+  void RecordExec( int model_num,
+                   long long start_ns,
+                   long long stop_ns );
+
+  //  wall time of a whole timed pass, signal updates
+  //  included, for end-to-end throughput
+  void RecordPass( long long start_ns,
+                   long long stop_ns );
+
+  //  discards everything measured (and traced) so far
+  void Reset(void);
+
+  void WriteReport( ofstream &report_file );
+
+  //  same figures as WriteReport(), as a JSON object so
+  //  runs can be compared mechanically
+  void WriteJson( const char *json_file_name,
+                  const char *sim_name );
+
+private:
+  typedef struct{
+    PracSimModel *model_id;
+    std::vector<GenericSignal*> counted_sigs;
+    long long exec_ns;
+    long long num_samps;
+    long num_calls;
+    } model_prof_type;
+
+  void CloseTrace(void);
+
+  PROFILE_MODE_T Profile_Mode;
+  int Sample_Intvl;
+  std::vector<model_prof_type*> Model_Prof;
+  int Timed_Pass;
+  long Num_Timed_Passes;
+  long long Pass_Ns;
+  long long Clock_Origin;
+
+  ofstream *Trace_File;
+  char *Trace_File_Name;
+  int Max_Trace_Passes;
+  int Num_Traced_Passes;
+  bool Trace_Pass;
+  bool First_Trace_Event;
+};
+
+#endif
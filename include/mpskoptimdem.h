@@ -7,6 +7,7 @@
 
 #include "signal_T.h"
 #include "psmodel.h"
+#include "k_integ_dump_T.h"
 
 class MpskOptimalDemod : public PracSimModel
 {
@@ -32,6 +33,8 @@ private:
   byte_t Num_Diff_Symbs;
   double *Integ_Val;
   std::complex<float> *Conj_Ref;
+  k_IntegrateAndDump< std::complex<float> > *Kernel;
+  std::complex<float> *Dump_Val;
 };
 
 #endif
@@ -0,0 +1,148 @@
+//
+//  File = ngram_stats.h
+//
+
+#ifndef _NGRAM_STATS_H_
+#define _NGRAM_STATS_H_
+
+#include <vector>
+#include "typedefs.h"
+
+#define NGRAM_MAX_ORDER 8
+
+//  largest n-gram table, in entries
+#define NGRAM_MAX_TABLE_ENTRIES (1<<24)
+
+//  tables up to this size get interleaved partial tables
+//  so repeated n-grams do not serialize on one counter
+#define NGRAM_LANES 4
+#define NGRAM_LANE_MAX_ENTRIES 16384
+
+//  larger tables are counted a slice of this many entries
+//  at a time, from chunks of NGRAM_SLICE_CHUNK symbols
+//  (see NgramCounter::PartitionCount)
+#define NGRAM_SLICE_LOG2 16
+#define NGRAM_SLICE_CHUNK 65536
+
+//  32-bit partial counts are folded into the 64-bit
+//  totals before this many n-grams have been added
+#define NGRAM_FLUSH_LIMIT 0x7fffffffLL
+
+//  each worker thread gets at least this many symbols
+#define NGRAM_MIN_THREAD_SYMBS 32768
+
+//======================================================
+//  Counts overlapping n-grams of symbols first_symb thru
+//  first_symb+num_symbs-1 (range checked by the caller).
+//  Only the max_order table is updated per symbol; each
+//  lower order is its marginal over the oldest symbols,
+//  plus the few short grams seen while the history was
+//  still filling, which are tallied directly.
+//  Counters with the same shape (for example, one per
+//  thread) can be combined with Merge().
+
+class NgramCounter
+{
+public:
+  NgramCounter( int num_symbs,
+                int first_symb,
+                int max_order );
+  ~NgramCounter(void);
+
+  //  counts the grams ending at symbs[0] thru
+  //  symbs[num_in-1]; the lead_len symbols before
+  //  symbs[0] are valid history (lead_len < max_order-1
+  //  marks a stream start)
+  void Tally( const byte_t *symbs, int num_in, int lead_len );
+
+  void Merge( NgramCounter *other );
+  void Reset(void);
+
+  //  num_symbs**order counts, most recent symbol as the
+  //  least significant digit of the index
+  void GetCounts( int order, long long *counts );
+
+private:
+  void Flush(void);
+  void PartitionCount( int num_idx );
+
+  int Num_Symbs;
+  int First_Symb;
+  int Max_Order;
+  int Table_Size;
+  int Num_Lanes;
+  int Num_Slices;
+  long long Pending_Count;
+  unsigned int *Lane_Counts;
+  long long *Total_Counts;
+
+  //  Lead_Counts[k] holds order k+1 grams that ended
+  //  before max_order symbols of history were available
+  std::vector<long long> Lead_Counts[NGRAM_MAX_ORDER];
+
+  //  scratch for slice-partitioned counting
+  std::vector<unsigned int> Idx_Buf;
+  std::vector<unsigned int> Sorted_Buf;
+};
+
+//======================================================
+//  Symbol-stream statistics built on NgramCounter.
+//
+//  Symbols first_symb thru first_symb+num_symbs-1 are
+//  accepted.  With continuous_run the stream is carried
+//  across calls to Tally(); otherwise each call starts a
+//  new sequence.  A call of at least
+//  num_threads*NGRAM_MIN_THREAD_SYMBS symbols is split
+//  among num_threads threads, each with its own partial
+//  counter; partials are merged when statistics are read.
+
+class NgramStats
+{
+public:
+  NgramStats( int num_symbs,
+              int first_symb,
+              int max_order,
+              bool continuous_run,
+              int num_threads );
+  ~NgramStats(void);
+
+  void Tally( const byte_t *symbs, int num_in );
+  void Reset(void);
+
+  int GetMaxOrder(void){return Max_Order;};
+  long long GetGramCount( int order );
+  void GetCounts( int order, long long *counts );
+
+  //  Pearson statistic against equiprobable independent
+  //  symbols: plain chi-square for order 1 and, since
+  //  overlapping counts are not independent, Good's
+  //  serial difference psi2(k) - psi2(k-1) above that.
+  //  The p-value uses the Wilson-Hilferty approximation.
+  double GetChiSquare( int order, int *deg_freedom );
+  double GetChiSquarePValue( int order );
+
+  //  block entropy of the order-k grams, in bits
+  double GetEntropy( int order );
+
+  //  writes the order-1 and order-2 frequencies and the
+  //  per-order statistics to BasicResults
+  void Report( const char *instance_name, int pass_number );
+
+private:
+  void MergePartials(void);
+  double PsiSquare( int order );
+
+  int Num_Symbs;
+  int First_Symb;
+  int Max_Order;
+  bool Continuous_Run;
+  int Num_Threads;
+  std::vector<NgramCounter*> Partials;
+
+  //  carried history followed by the first symbols of
+  //  the block
+  byte_t Stitch[2*NGRAM_MAX_ORDER];
+  int Hist_Len;
+};
+
+#endif
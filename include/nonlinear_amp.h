@@ -5,6 +5,7 @@
 #ifndef _NONLINEAR_AMP_H_
 #define _NONLINEAR_AMP_H_
 
+#include <vector>
 #include "signal_T.h"
 #include "samp_curve.h"
 using std::complex;
@@ -37,6 +38,8 @@ private:
   SampledCurve *Am_Pm_Curve;
   char *Am_Am_Fname;
   char *Am_Pm_Fname;
+  std::vector<float> Amp_Sqrd_Buf;
+  std::vector<float> Phase_Buf;
   
 };
 
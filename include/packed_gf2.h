@@ -0,0 +1,124 @@
+//
+//  File = packed_gf2.h
+//
+
+#ifndef _PACKED_GF2_H_
+#define _PACKED_GF2_H_
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+typedef unsigned long long gf2_word_t;
+
+#define GF2_WORD_BITS 64
+
+//  carry-less 64 x 64 bit product; uses PCLMULQDQ when
+//  built with _GF2_CLMUL (or -mpclmul), else a 4-bit
+//  windowed shift-and-add
+void ClMulWord( gf2_word_t a,
+                gf2_word_t b,
+                gf2_word_t *prod_lo,
+                gf2_word_t *prod_hi );
+
+//======================================================
+//  Polynomial over GF(2) with the coefficients packed 64
+//  to a word, coefficient of x**i in bit i%64 of word
+//  i/64.  Unlike PolyOvrGF2 the operators return values,
+//  and sums, products and remainders are formed a word at
+//  a time.
+
+class PackedPolyOvrGF2
+{
+public:
+  PackedPolyOvrGF2(void);
+
+  //  polynomial of degree < 64 given as a bit mask
+  PackedPolyOvrGF2( gf2_word_t coeff_bits );
+
+  //  x**degree
+  static PackedPolyOvrGF2 Monomial( int degree );
+
+  //  -1 for the zero polynomial
+  int MaxDegree(void) const {return Degree;};
+  int Coefficient( int degree ) const;
+  void SetCoefficient( int degree, int value );
+  int NumberOfTerms(void) const;
+
+  //  degree of the second-highest term, or -1
+  int PenultimateDegree(void) const;
+
+  bool IsZero(void) const {return(Degree < 0);};
+  bool IsOne(void) const {return(Degree == 0);};
+  gf2_word_t LowWord(void) const;
+  const gf2_word_t* GetWords(void) const {return(&Words[0]);};
+  int GetNumWords(void) const {return(int(Words.size()));};
+
+  PackedPolyOvrGF2 operator+ ( const PackedPolyOvrGF2 &right ) const;
+  PackedPolyOvrGF2& operator+= ( const PackedPolyOvrGF2 &right );
+  PackedPolyOvrGF2 operator* ( const PackedPolyOvrGF2 &right ) const;
+  PackedPolyOvrGF2& operator*= ( const PackedPolyOvrGF2 &right );
+  PackedPolyOvrGF2 operator/ ( const PackedPolyOvrGF2 &divisor ) const;
+  PackedPolyOvrGF2 operator% ( const PackedPolyOvrGF2 &divisor ) const;
+  bool operator== ( const PackedPolyOvrGF2 &right ) const;
+  bool operator!= ( const PackedPolyOvrGF2 &right ) const;
+
+  //  multiplies by x**shift
+  PackedPolyOvrGF2 ShiftUp( int shift ) const;
+
+  void DivMod( const PackedPolyOvrGF2 &divisor,
+               PackedPolyOvrGF2 *quotient,
+               PackedPolyOvrGF2 *remainder ) const;
+
+  PackedPolyOvrGF2 Square(void) const;
+  PackedPolyOvrGF2 Derivative(void) const;
+
+  void DumpToStream( ostream* output_stream ) const;
+
+private:
+  void Normalize(void);
+
+  int Degree;
+  vector<gf2_word_t> Words;
+};
+
+PackedPolyOvrGF2 GcdOvrGF2( PackedPolyOvrGF2 poly_a,
+                            PackedPolyOvrGF2 poly_b );
+
+//  (poly_a * poly_b) mod modulus
+PackedPolyOvrGF2 MulModOvrGF2( const PackedPolyOvrGF2 &poly_a,
+                               const PackedPolyOvrGF2 &poly_b,
+                               const PackedPolyOvrGF2 &modulus );
+
+//  x**exponent mod modulus
+PackedPolyOvrGF2 PowerOfXModOvrGF2( unsigned long long exponent,
+                                    const PackedPolyOvrGF2 &modulus );
+
+bool IsIrreducibleOvrGF2( const PackedPolyOvrGF2 &poly );
+
+//  true if x has order 2**degree - 1 modulo poly;
+//  degree must not exceed 63
+bool IsPrimitiveOvrGF2( const PackedPolyOvrGF2 &poly );
+
+//  the first max_count primitive polynomials of the given
+//  degree, in increasing numeric order of coefficients
+void FindPrimitivePolysOvrGF2( int degree,
+                               int max_count,
+                               vector<PackedPolyOvrGF2> *prim_polys );
+
+//  primitive polynomial of the given degree with the fewest
+//  terms and, among those, the lowest penultimate degree
+//  (the choice made by PrimitivePolynomialSet::GetSimplest)
+PackedPolyOvrGF2 FindSimplestPrimitiveOvrGF2( int degree );
+
+//  irreducible factors of poly, repeated according to
+//  multiplicity, found by Berlekamp's method
+void FactorOvrGF2( const PackedPolyOvrGF2 &poly,
+                   vector<PackedPolyOvrGF2> *factors );
+
+//  minimal polynomial over GF(2) of alpha**exponent, where
+//  alpha is a root of the primitive polynomial prim_poly
+PackedPolyOvrGF2 MinimalPolyOvrGF2( const PackedPolyOvrGF2 &prim_poly,
+                                    int exponent );
+
+#endif
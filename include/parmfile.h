@@ -4,40 +4,57 @@
 
 #ifndef _PARMFILE_H_
 #define _PARMFILE_H_
+#include <stdio.h>
 #include "globals.h"
 #define OPEN_PARM_BLOCK {ParmInput->FindBlock(instance_name);\
                           BasicResults << instance_name << endl;}
 #define GET_INT_PARM(X) {X = ParmInput->GetIntParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
-#define GET_INT_PARM_ARRAY(X,N) {X = ParmInput->GetIntParmArray(#X##"\0",X,N);\
-                         BasicResults << "   " << #X##" = " << X[0] << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
+#define GET_INT_PARM_ARRAY(X,N) {X = ParmInput->GetIntParmArray(#X "\0",X,N);\
+                         BasicResults << "   " << #X " = " << X[0] << endl;}
 #define GET_BOOL_PARM(X) {X = ParmInput->GetBoolParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 #define GET_LONG_PARM(X) {X = ParmInput->GetLongParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 #define GET_FLOAT_PARM(X) {X = ParmInput->GetFloatParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 #define GET_DOUBLE_PARM(X) {X = ParmInput->GetDoubleParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
-//#define GET_DOUBLE_PARM_ARRAY(X,N) {X = ParmInput->GetDoubleParmArray(#X##"\0",X,N);\
-//                         BasicResults << "   " << #X##" = " << X << endl;}
-#define GET_DOUBLE_PARM_ARRAY(X,N) {X = ParmInput->GetDoubleParmArray(#X##"\0",X,N);\
+                         BasicResults << "   " << #X " = " << X << endl;}
+//
+// hexadecimal bit masks (polynomials, taps) of up to 64 bits
+#define GET_HEX_PARM(X) {X = ParmInput->GetHexParm(#X);\
+                         char __hex[20]; sprintf(__hex, "%llx", (unsigned long long)X);\
+                         BasicResults << "   " << #X " = 0x" << __hex << endl;}
+//
+// optional parameters: if X is absent from the block it takes the default D
+#define GET_INT_PARM_OPT(X,D) {X = ParmInput->ParmIsPresent(#X) ? \
+                                    ParmInput->GetIntParm(#X) : (D);\
+                         BasicResults << "   " << #X " = " << X << endl;}
+#define GET_BOOL_PARM_OPT(X,D) {X = ParmInput->ParmIsPresent(#X) ? \
+                                     ParmInput->GetBoolParm(#X) : (D);\
+                         BasicResults << "   " << #X " = " << X << endl;}
+#define GET_DOUBLE_PARM_OPT(X,D) {X = ParmInput->ParmIsPresent(#X) ? \
+                                       ParmInput->GetDoubleParm(#X) : (D);\
+                         BasicResults << "   " << #X " = " << X << endl;}
+//#define GET_DOUBLE_PARM_ARRAY(X,N) {X = ParmInput->GetDoubleParmArray(#X "\0",X,N);\
+//                         BasicResults << "   " << #X " = " << X << endl;}
+#define GET_DOUBLE_PARM_ARRAY(X,N) {X = ParmInput->GetDoubleParmArray(#X "\0",X,N);\
                          for(int __i=0; __i<N; __i++) {\
-                         BasicResults << "   " << #X##"[" << __i << "] = " << *(((double*)X)+__i) << endl;}}
+                         BasicResults << "   " << #X "[" << __i << "] = " << *(((double*)X)+__i) << endl;}}
 
 #define GET_STRING_PARM(X) {X = ParmInput->GetStringParm(#X);\
-                           BasicResults << "   " << #X##" = " << X << endl;}
+                           BasicResults << "   " << #X " = " << X << endl;}
 
 #define GET_INT_KRNL_PARM(X) {Kernel->X = ParmInput->GetIntParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 #define GET_BOOL_KRNL_PARM(X) {Kernel->X = ParmInput->GetBoolParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 #define GET_LONG_KRNL_PARM(X) {Kernel->X = ParmInput->GetLongParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 #define GET_FLOAT_KRNL_PARM(X) {Kernel->X = ParmInput->GetFloatParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 #define GET_DOUBLE_KRNL_PARM(X) {Kernel->X = ParmInput->GetDoubleParm(#X);\
-                         BasicResults << "   " << #X##" = " << X << endl;}
+                         BasicResults << "   " << #X " = " << X << endl;}
 
 class ParmFile
 {
@@ -46,11 +63,13 @@ public:
   ~ParmFile(void);
   void FindBlock(const char* block_nam);
   void ParmFile::RestartBlock(void);
+  bool ParmIsPresent(const char* parm_nam);
   int GetParmStr(const char* parm_nam, char *ret_str);
   int GetParmArrayStr(const char* parm_nam, char* ret_str);
   char* GetStringParm(const char* parm_nam);
   int GetIntParm(const char* parm_nam);
   long GetLongParm(const char* parm_nam);
+  unsigned long long GetHexParm(const char* parm_nam);
   float GetFloatParm(const char* parm_nam);
   double GetDoubleParm(const char* parm_nam);
   bool GetBoolParm(const char* parm_nam);
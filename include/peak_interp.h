@@ -0,0 +1,17 @@
+//
+// file = peak_interp.h
+//
+
+#ifndef _PEAK_INTERP_H_
+#define _PEAK_INTERP_H_ 
+
+typedef enum {
+  PEAK_INTERP_NONE,
+  PEAK_INTERP_PARABOLIC,
+  PEAK_INTERP_SINC,
+  sizeof_PEAK_INTERP_T
+  } PEAK_INTERP_T;
+
+PEAK_INTERP_T GetPeakInterpParm(const char* parm_nam);
+
+#endif
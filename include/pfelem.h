@@ -12,6 +12,7 @@ public:
   PrimeFieldElem(void);
   PrimeFieldElem(int modulus);
   PrimeFieldElem(int modulus, int value);
+  PrimeFieldElem(const PrimeFieldElem&);
   //void operator=(const int);
   bool operator==(const int);
   bool operator!=(const int);
@@ -47,6 +48,10 @@ inline bool PrimeFieldElem::operator==(const int value)
 inline bool PrimeFieldElem::operator!=(const int value)
 {return(Value!=value);}
 
+inline PrimeFieldElem::PrimeFieldElem(const PrimeFieldElem &right)
+  {Modulus = right.Modulus;
+  Value = right.Value;}
+
 inline void PrimeFieldElem::operator=(const PrimeFieldElem &right)
   {Modulus = right.Modulus;
   Value = right.Value;}
@@ -0,0 +1,39 @@
+//
+//  File = pn_ber_ctr.h
+//
+
+#ifndef _PN_BER_CTR_H_
+#define _PN_BER_CTR_H_
+
+#include "signal_T.h"
+#include "psmodel.h"
+#include "pn_seq.h"
+
+//  Counts errors in a received PN sequence without a
+//  reference signal, by syncing a local copy of the
+//  sequence to the received bits.
+
+class PnBerCounter : public PracSimModel
+{
+public:
+  PnBerCounter( char* instance_name,
+                PracSimModel* outer_model,
+                Signal<bit_t> *in_signal );
+
+  ~PnBerCounter(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  Signal<bit_t> *In_Sig;
+  PN_POLY_T Pn_Poly;
+  int Pn_Degree;
+  int Num_Holdoff_Passes;
+  int Report_Intvl_In_Blocks;
+  int Sync_Window_Len;
+  int Max_Window_Errs;
+  PnSyncChecker *Checker;
+};
+
+#endif
@@ -0,0 +1,32 @@
+//
+//  File = pn_bitgen.h
+//
+
+#ifndef _PN_BITGEN_H_
+#define _PN_BITGEN_H_
+
+#include "psmodel.h"
+#include "signal_T.h"
+#include "pn_seq.h"
+
+class PnBitGener : public PracSimModel
+{
+public:
+  PnBitGener( char* instance_nam,
+              PracSimModel *outer_model,
+              Signal<bit_t>* out_sig );
+
+  ~PnBitGener(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  PN_POLY_T Pn_Poly;
+  int Pn_Degree;
+  long Initial_State;
+  int Block_Size;
+  PnSequence *Pn_Gen;
+  Signal<bit_t> *Out_Sig;
+};
+
+#endif //_PN_BITGEN_H_
@@ -0,0 +1,20 @@
+//
+// file = pn_poly.h
+//
+
+#ifndef _PN_POLY_H_
+#define _PN_POLY_H_ 
+
+typedef enum {
+  PN_POLY_PRBS7,      // x**7 + x**6 + 1
+  PN_POLY_PRBS15,     // x**15 + x**14 + 1
+  PN_POLY_PRBS23,     // x**23 + x**18 + 1
+  PN_POLY_PRBS31,     // x**31 + x**28 + 1
+  PN_POLY_SIMPLEST,   // fewest-term primitive polynomial of given degree
+  PN_POLY_CUSTOM,     // feedback taps given directly
+  sizeof_PN_POLY_T
+  } PN_POLY_T;
+
+PN_POLY_T GetPnPolyParm(const char* parm_nam);
+
+#endif
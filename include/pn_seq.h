@@ -0,0 +1,126 @@
+//
+//  File = pn_seq.h
+//
+
+#ifndef _PN_SEQ_H_
+#define _PN_SEQ_H_
+
+#include "typedefs.h"
+#include "pn_poly.h"
+
+typedef unsigned long long pn_word_t;
+
+#define PN_WORD_BITS 64
+#define PN_MAX_DEGREE 63
+
+//  Feedback taps for a PN polynomial: bit j-1 is set for
+//  each term x**j, j = 1 thru degree.  For PN_POLY_SIMPLEST
+//  the polynomial is the simplest primitive polynomial of
+//  the given degree; for the presets degree is set to the
+//  preset's degree.
+pn_word_t PnFeedbackTaps( PN_POLY_T pn_poly, int *degree );
+
+//  checks taps given directly (PN_POLY_CUSTOM) and sets
+//  degree from the highest one
+pn_word_t PnCustomTaps( pn_word_t fb_taps, int *degree );
+
+//======================================================
+//  Maximal-length LFSR sequence
+//
+//      s[n] = sum over taps j of s[n-j]  (mod 2)
+//
+//  generated PN_WORD_BITS bits per step.  The state is the
+//  last Degree bits produced (bit i = s[n-Degree+i]), and
+//  every output word is a fixed linear function of the
+//  state, so one step is a lookup of each state byte in a
+//  precomputed table.  Bits are packed first-out in the
+//  least significant bit.
+//
+//  Objects are plain values, so a generator can be copied
+//  and SeekAhead() used to give each thread its own
+//  disjoint stretch of the same sequence.
+
+class PnSequence
+{
+public:
+  PnSequence( int degree, pn_word_t fb_taps );
+
+  //  state is the previous Degree bits and must be nonzero
+  void SetState( pn_word_t state );
+  pn_word_t GetState(void){return State;};
+
+  pn_word_t NextWord(void);
+  void GenerateWords( pn_word_t *words_out, int num_words );
+  void GenerateBits( bit_t *bits_out, int num_bits );
+
+  //  skips num_bits bits in O(Degree**2 log(num_bits))
+  void SeekAhead( unsigned long long num_bits );
+
+  int GetDegree(void){return Degree;};
+  pn_word_t GetPeriod(void){return State_Mask;};
+
+private:
+  pn_word_t StepBit( pn_word_t state );
+  pn_word_t ApplyMatrix( const pn_word_t *mtx, pn_word_t vec );
+
+  int Degree;
+  int Num_State_Bytes;
+  pn_word_t State_Mask;
+  pn_word_t Fb_Mask;
+  pn_word_t State;
+
+  //  bits of the current word not yet handed out
+  pn_word_t Pending_Word;
+  int Pending_Bits;
+
+  pn_word_t Out_Table[8][256];
+};
+
+//======================================================
+//  Error checker for a received PN sequence.  Out of sync,
+//  the first Degree received bits are loaded as the state
+//  of a local generator; in sync, received bits are packed
+//  and compared with the local sequence a word at a time.
+//  If more than max_window_errs errors are found in a
+//  window of sync_window_bits bits, sync is declared lost
+//  and the checker reloads from the following bits.  The
+//  errors in the failed window stay in the tallies.
+
+class PnSyncChecker
+{
+public:
+  PnSyncChecker( int degree,
+                 pn_word_t fb_taps,
+                 int sync_window_bits,
+                 int max_window_errs );
+
+  void Check( const bit_t *bits_in, int num_bits );
+  void Reset(void);
+
+  bool IsInSync(void){return In_Sync;};
+
+  //  tallies are updated as each word is completed
+  long long GetBitsChecked(void){return Bits_Checked;};
+  long long GetErrorCount(void){return Error_Count;};
+  int GetNumSyncLosses(void){return Num_Sync_Losses;};
+
+private:
+  void CheckWord( pn_word_t rcvd_word );
+
+  PnSequence Ref_Gen;
+  int Degree;
+  int Sync_Window_Bits;
+  int Max_Window_Errs;
+  bool In_Sync;
+  pn_word_t Fill_State;
+  int Fill_Count;
+  pn_word_t Rcvd_Word;
+  int Rcvd_Count;
+  int Window_Bits;
+  int Window_Errs;
+  long long Bits_Checked;
+  long long Error_Count;
+  int Num_Sync_Losses;
+};
+
+#endif
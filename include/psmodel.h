@@ -4,8 +4,10 @@
 #ifndef _PSMODEL_H_
 #define _PSMODEL_H_
 
+#include <string.h>
 #include "gensig.h"
 #include "list"
+#include "vector"
 class ModelGraph;
 
 #define _MES_AOK 0
@@ -27,6 +29,19 @@ public:
    void CloseoutModelGraph(int key);
    virtual void Initialize(void){};
    virtual int Execute(void){return(-1);};
+   void DeclarePassThru( GenericSignal* in_sig,
+                         GenericSignal* out_sig );
+   int GetNumPassThrus(void);
+   GenericSignal* GetPassThruInput(int pair_num);
+   GenericSignal* GetPassThruOutput(int pair_num);
+   void DeclareBlockAlias( GenericSignal* in_sig,
+                           GenericSignal* out_sig );
+   int GetNumBlockAliases(void);
+   GenericSignal* GetBlockAliasInput(int pair_num);
+   GenericSignal* GetBlockAliasOutput(int pair_num);
+   void SetExecSkipped(bool exec_is_skipped);
+   bool ExecIsSkipped(void);
+   void PassThruUpdate(void);
 protected:
    typedef struct{
       GenericSignal *Ptr_To_Sig;
@@ -39,5 +54,10 @@ protected:
    std::list<Sig_List_Elem*> *Input_Sigs;
    ModelGraph* Curr_Mod_Graph;
    int Nest_Depth;
+   std::vector<GenericSignal*> *Pass_Thru_In_Sigs;
+   std::vector<GenericSignal*> *Pass_Thru_Out_Sigs;
+   std::vector<GenericSignal*> *Block_Alias_In_Sigs;
+   std::vector<GenericSignal*> *Block_Alias_Out_Sigs;
+   bool Exec_Is_Skipped;
 };
-#endif // _PSMODEL_H_
\ No newline at end of file
+#endif // _PSMODEL_H_
\ No newline at end of file
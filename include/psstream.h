@@ -10,6 +10,8 @@
 //#include "d_cmplx.h"
 #include "delay_modes.h"
 #include "interp_modes.h"
+#include "ar_methods.h"
+#include "scram_modes.h"
 #include <complex>
 using namespace std;
 
@@ -45,6 +47,8 @@ public:
 
   friend PracSimStream& operator<<( PracSimStream&, const DELAY_MODE_T&);
   friend PracSimStream& operator<<( PracSimStream&, const INTERP_MODE_T&);
+  friend PracSimStream& operator<<( PracSimStream&, const AR_METHOD_T&);
+  friend PracSimStream& operator<<( PracSimStream&, const SCRAM_MODE_T&);
 
   //----------------------------------------------------
   // define signature that allows overloaded << to be
@@ -7,7 +7,7 @@
 
 #include "psmodel.h"
 #include "k_pwrmtr.h"
-#include "signal_t.h"
+#include "signal_T.h"
 
 class PowerMeter : public PracSimModel
 {
@@ -7,6 +7,7 @@
 
 #include "signal_T.h"
 #include "psmodel.h"
+#include "k_integ_dump_T.h"
 
 class QamOptimalDemod : public PracSimModel
 {
@@ -34,8 +35,8 @@ private:
   int Num_Symb_Rows;
   double *I_Boundary;
   double *Q_Boundary;
-  double I_Integ_Val;
-  double Q_Integ_Val;
+  k_IntegrateAndDump< std::complex<float> > *Kernel;
+  std::complex<float> *Dump_Val;
 };
 
 #endif
@@ -7,6 +7,7 @@
 
 #include "signal_T.h"
 #include "psmodel.h"
+#include "k_integ_dump_T.h"
 
 class QpskOptimalBitDemod : public PracSimModel
 {
@@ -36,6 +37,9 @@ private:
   bool Constel_Offset_Enabled;
   double *Integ_Val;
   std::complex<float> Constel_Offset_Rot;
+  k_IntegrateAndDump< std::complex<float> > *Kernel;
+  std::complex<float> *Correl_Buf;
+  std::complex<float> *Dump_Val;
 
 };
 
@@ -5,6 +5,7 @@
 #ifndef _QUADDEM_H_
 #define _QUADDEM_H_
 
+#include <vector>
 #include "signal_T.h"
 #include "psmodel.h"
 
@@ -32,6 +33,7 @@ private:
   Signal<float> *Q_Wave_Out;
   Signal< std::complex<float> > *Carrier_Ref_Sig;  
   Signal< std::complex<float> > *In_Sig;  
+  std::vector< std::complex<float> > Mixed_Buf;
 };
 
 #endif
@@ -0,0 +1,69 @@
+//
+//  File = rs_codec.h
+//
+
+#ifndef _RS_CODEC_H_
+#define _RS_CODEC_H_
+
+#include <vector>
+#include "gf2m_field.h"
+#include "gf_synd_dec.h"
+using namespace std;
+
+//======================================================
+//  Systematic Reed-Solomon (n,k) code over GF(2**m),
+//  shortened when n < 2**m - 1.  The generator has roots
+//  alpha**first_root thru alpha**(first_root + n-k-1) and
+//  corrects up to (n-k)/2 symbol errors.  Codewords hold
+//  the k message symbols followed by the n-k parity
+//  symbols, highest-degree coefficient first.
+
+class ReedSolomonCodec
+{
+public:
+  ReedSolomonCodec( Gf2mField *field,
+                    int code_len,
+                    int msg_len,
+                    int first_root = 1 );
+  ~ReedSolomonCodec(void);
+
+  void Encode( const gf_elem_t *msg, gf_elem_t *codeword );
+
+  //  encodes num_cws messages stored back to back
+  void EncodeBlock( const gf_elem_t *msgs,
+                    gf_elem_t *codewords,
+                    int num_cws );
+
+  //  corrects num_cws codewords in place; num_corr[iw] is
+  //  set to the number of symbols corrected in codeword
+  //  iw, or -1 if it could not be decoded (left as is)
+  void DecodeBlock( gf_elem_t *codewords,
+                    int num_cws,
+                    int *num_corr );
+
+  int GetCodeLen(void){return Code_Len;};
+  int GetMsgLen(void){return Msg_Len;};
+  int GetMaxCorr(void){return Max_Corr;};
+
+private:
+  Gf2mField *Field;
+  GfSyndromeDecoder *Synd_Decoder;
+  int Code_Len;
+  int Msg_Len;
+  int Num_Parity;
+  int Max_Corr;
+  int First_Root;
+
+  //  generator coefficients, Gen_Desc[d] multiplying
+  //  x**(Num_Parity-1-d)
+  gf_elem_t *Gen_Desc;
+
+  vector<gf_elem_t> Parity_Reg;
+  vector<gf_elem_t> Synd_Buf;
+  vector<gf_elem_t> Locator;
+  vector<gf_elem_t> Evaluator;
+  vector<int> Err_Pos;
+  vector<gf_elem_t> Err_Val;
+};
+
+#endif
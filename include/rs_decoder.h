@@ -0,0 +1,50 @@
+//
+//  File = rs_decoder.h
+//
+
+#ifndef _RS_DECODER_H_
+#define _RS_DECODER_H_
+
+#include <vector>
+#include "psmodel.h"
+#include "signal_T.h"
+#include "rs_codec.h"
+
+//  Reed-Solomon decoder matching RsEncoder.  Every
+//  Code_Len input symbols are corrected and their
+//  Msg_Len message symbols output; codeword-level
+//  statistics are reported like the BER counters.
+
+class RsDecoder : public PracSimModel
+{
+public:
+  RsDecoder( char* instance_name,
+             PracSimModel* outer_model,
+             Signal<byte_t>* in_signal,
+             Signal<byte_t>* out_signal );
+
+  ~RsDecoder(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Num_Codewords;
+  int Bits_Per_Symb;
+  int Code_Len;
+  int Msg_Len;
+  int Num_Holdoff_Passes;
+  int Report_Intvl_In_Blocks;
+  Signal<byte_t> *In_Sig;
+  Signal<byte_t> *Out_Sig;
+  Gf2mField *Field;
+  ReedSolomonCodec *Codec;
+  std::vector<gf_elem_t> Code_Buf;
+  std::vector<int> Num_Corr;
+  long long Codewords_Decoded;
+  long long Codewords_Corrected;
+  long long Symbs_Corrected;
+  long long Decoder_Failures;
+};
+
+#endif
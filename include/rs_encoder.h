@@ -0,0 +1,43 @@
+//
+//  File = rs_encoder.h
+//
+
+#ifndef _RS_ENCODER_H_
+#define _RS_ENCODER_H_
+
+#include <vector>
+#include "psmodel.h"
+#include "signal_T.h"
+#include "rs_codec.h"
+
+//  Systematic Reed-Solomon encoder; each input symbol
+//  carries Bits_Per_Symb bits, and every Msg_Len input
+//  symbols become Code_Len output symbols.
+
+class RsEncoder : public PracSimModel
+{
+public:
+  RsEncoder( char* instance_name,
+             PracSimModel* outer_model,
+             Signal<byte_t>* in_signal,
+             Signal<byte_t>* out_signal );
+
+  ~RsEncoder(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Num_Codewords;
+  int Bits_Per_Symb;
+  int Code_Len;
+  int Msg_Len;
+  Signal<byte_t> *In_Sig;
+  Signal<byte_t> *Out_Sig;
+  Gf2mField *Field;
+  ReedSolomonCodec *Codec;
+  std::vector<gf_elem_t> Msg_Buf;
+  std::vector<gf_elem_t> Code_Buf;
+};
+
+#endif
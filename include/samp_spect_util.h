@@ -17,6 +17,12 @@ public:
                   double samp_intvl );
 
    void Calculate(  T* time_signal );
+protected:
+   // members of the dependent base class
+   using SpectrumEstimator<T>::Num_Samps;
+   using SpectrumEstimator<T>::Fft_Len;
+   using SpectrumEstimator<T>::Samp_Intvl;
+   using SpectrumEstimator<T>::Psd_Estimate;
 private:
    //int Num_Samps;
    //int Fft_Len;
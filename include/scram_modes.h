@@ -0,0 +1,16 @@
+//
+// file = scram_modes.h
+//
+
+#ifndef _SCRAM_MODES_H_
+#define _SCRAM_MODES_H_ 
+
+typedef enum {
+  SCRAM_MODE_SCRAMBLE,
+  SCRAM_MODE_DESCRAMBLE,
+  sizeof_SCRAM_MODE_T
+  } SCRAM_MODE_T;
+
+SCRAM_MODE_T GetScramModeParm(const char* parm_nam);
+
+#endif
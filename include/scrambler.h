@@ -0,0 +1,51 @@
+//
+//  File = scrambler.h
+//
+
+#ifndef _SCRAMBLER_H_
+#define _SCRAMBLER_H_
+
+#include "psmodel.h"
+#include "signal_T.h"
+#include "pn_poly.h"
+#include "scrambler_krnl.h"
+#include "scram_modes.h"
+
+//  Bit scrambler or, with Scram_Mode set to
+//  SCRAM_MODE_DESCRAMBLE, the matching descrambler.  With
+//  Self_Sync the scrambler is multiplicative and the
+//  descrambler needs no seed, recovering from errors
+//  after Scram_Degree bits; otherwise the bits are added
+//  to a PN sequence started from Scram_Seed and the
+//  descrambler must start in step with the scrambler.
+//  Scram_Poly selects the polynomial; PN_POLY_CUSTOM
+//  takes Scram_Taps in hex, with bit j-1 set for each
+//  term x**j (x**7+x**4+1 is 0x48).  Scram_Seed is in hex.
+
+class Scrambler : public PracSimModel
+{
+public:
+  Scrambler( char* instance_name,
+             PracSimModel* outer_model,
+             Signal<bit_t>* in_signal,
+             Signal<bit_t>* out_signal );
+
+  ~Scrambler(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  SCRAM_MODE_T Scram_Mode;
+  PN_POLY_T Scram_Poly;
+  int Scram_Degree;
+  pn_word_t Scram_Taps;
+  bool Self_Sync;
+  pn_word_t Scram_Seed;
+  Signal<bit_t> *In_Sig;
+  Signal<bit_t> *Out_Sig;
+  AdditiveScrambler *Add_Scram;
+  MultiplicativeScrambler *Mult_Scram;
+};
+
+#endif
@@ -0,0 +1,68 @@
+//
+//  File = scrambler_krnl.h
+//
+
+#ifndef _SCRAMBLER_KRNL_H_
+#define _SCRAMBLER_KRNL_H_
+
+#include <vector>
+#include "typedefs.h"
+#include "pn_seq.h"
+
+//======================================================
+//  Additive (synchronous) scrambler: the bits are added to
+//  a PN sequence, produced 64 bits per step by PnSequence.
+//  Scrambling and descrambling are the same operation and
+//  need the same starting state.
+
+class AdditiveScrambler
+{
+public:
+  AdditiveScrambler( int degree,
+                     pn_word_t fb_taps,
+                     pn_word_t init_state );
+
+  void Process( const bit_t *bits_in, bit_t *bits_out, int num_bits );
+
+private:
+  PnSequence Pn_Gen;
+  pn_word_t Pn_Word;
+  int Pn_Bits_Left;
+};
+
+//======================================================
+//  Multiplicative (self-synchronizing) scrambler
+//
+//      y[n] = x[n] + sum over taps j of y[n-j]
+//
+//  and its descrambler x[n] = y[n] + sum of y[n-j], taps
+//  as for PnFeedbackTaps.  The scrambled stream is kept
+//  packed 64 bits to a word, so each tap contributes a
+//  shifted word rather than a bit.  The descrambler works
+//  a full word at a time; the scrambler's feedback limits
+//  it to runs as long as the lowest tap.
+
+class MultiplicativeScrambler
+{
+public:
+  MultiplicativeScrambler( int degree,
+                           pn_word_t fb_taps,
+                           bool descramble );
+
+  void Process( const bit_t *bits_in, bit_t *bits_out, int num_bits );
+
+private:
+  pn_word_t ExtractBits( int bit_pos, int num_bits );
+
+  int Degree;
+  bool Descramble;
+  int Chunk_Bits;
+  std::vector<int> Tap_Delays;
+
+  //  packed scrambled stream, bit i in bit i%64 of word
+  //  i/64, starting with the last Degree bits of the
+  //  previous call
+  std::vector<pn_word_t> Packed_Hist;
+};
+
+#endif
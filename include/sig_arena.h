@@ -0,0 +1,40 @@
+//
+//  File = sig_arena.h
+//
+
+#ifndef _SIG_ARENA_H_
+#define _SIG_ARENA_H_
+
+#include <stddef.h>
+
+// every signal buffer placed in the arena starts on
+// a boundary of this many bytes (one cache line)
+#define SIG_ARENA_ALIGN 64
+
+// bytes rounded up to a whole number of alignment units
+#define SIG_ARENA_ROUND_UP(X) \
+  ((((X) + SIG_ARENA_ALIGN - 1)/SIG_ARENA_ALIGN) * SIG_ARENA_ALIGN)
+
+//======================================================
+//  One contiguous, zero-filled block of memory that holds
+//  the buffers of all the regular signals in the system.
+//  Huge pages are requested from the OS when available,
+//  otherwise ordinary pages are used.
+
+class SignalArena
+{
+public:
+  SignalArena(void);
+  ~SignalArena(void);
+  char* Allocate(size_t num_bytes);
+  void Release(void);
+  size_t GetSize(void);
+  bool UsesHugePages(void);
+private:
+  char *Arena_Beg;
+  size_t Arena_Size;
+  size_t Mapped_Size;
+  bool Huge_Pages_Used;
+};
+
+#endif //_SIG_ARENA_H_
@@ -17,8 +17,11 @@ public:
   Signal<T>( Signal<T>* root_id, char* name, PracSimModel* model );
   Signal<T>( char* name );
   ~Signal<T>(void);
-  void AllocateSignalBuffer(void);
+  int GetSampleSize(void);
+  void AllocateSignalBuffer(char* phys_buf_beg);
+  void AliasSignalBuffer(void);
   void InitializeReadPtrs(void);
+  void AliasBlock( Signal<T>* src_sig );
   T* GetRawOutputPtr(PracSimModel* model);
   T* GetRawInputPtr(PracSimModel* model);
   Signal<T>* AddConnection(  PracSimModel* model,
@@ -35,7 +38,8 @@ private:
   T *Phys_Buf_Beg;
   T *Buf_Final_Mem_Beg;
   T *Next_Loc_To_Plot;
-  
+  bool Block_Is_Aliased;
+  void SetReadPtrs( T* buf_beg );
 };
 
 #endif //_SIGNAL_T_H_
@@ -22,7 +22,8 @@
 #define GET_INPUT_PTR(X) X->GetRawInputPtr(this)
 
 #define MAKE_OUTPUT(X) {  if(Nest_Depth == 1) \
-  {Curr_Mod_Graph->InsertSignal( X, this, false);}}
+  {Curr_Mod_Graph->InsertSignal( X, this, false); \
+  X->SetProducer(this);}}
 //#define MAKE_OUTPUT(X) {  if(Nest_Depth == 1) \
 //  {this->AddOutputSignal(X, false); \
 //  Curr_Mod_Graph->InsertSignal( X, this, false);}}
@@ -40,11 +41,19 @@
 #define SAME_RATE(X,Y) Curr_Mod_Graph->ChangeRate(X->GetId(), Y, 1.0, this)
 
 #define SET_BLOCK_SIZE(X,Y) Curr_Mod_Graph->SetBlockSize(X->GetId(),Y);
+#define SET_TUNABLE_BLOCK_SIZE(X,Y) Curr_Mod_Graph->SetTunableBlockSize(X->GetId(),Y);
+#define SET_BLOCK_GRANULARITY(X,Y) X->SetBlockGranularity(Y);
 
 //define SET_SAMP_RATE(X,Y) Curr_Mod_Graph->SetSampRate(X->GetId(),Y);
 #define SET_SAMP_INTVL(X,Y) Curr_Mod_Graph->SetSampIntvl(X->GetId(),Y);
 
-#define MAKE_SIG_FILE(X) ofstream X##_file(#X##".txt", ios::out)
+#define MAKE_SIG_FILE(X) ofstream X##_file(#X ".txt", ios::out)
+
+#define DECLARE_PASS_THRU(X,Y) { if(Nest_Depth == 1) \
+  {DeclarePassThru( X->GetId(), Y);}}
+
+#define DECLARE_BLOCK_ALIAS(X,Y) { if(Nest_Depth == 1) \
+  {DeclareBlockAlias( X->GetId(), Y->GetId());}}
 
 #define ENABLE_MULTIRATE Curr_Mod_Graph->EnableMultirate();
 #define ENABLE_CONST_INTERVAL Curr_Mod_Graph->EnableConstantInterval();
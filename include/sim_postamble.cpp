@@ -1,5 +1,11 @@
   //=============================================================
   Exec.MultirateSetup();
+  #ifdef _PROFILE
+    // per-model throughput to the long report and to
+    // <SIM_NAME>_profile.json; first passes traced
+    CommSystemGraph.EnableProfiling( PROFILE_MODE_FULL, 1,
+                                     SIM_NAME, 4 );
+  #endif
   //=============================================================
   //  Execute models
 
@@ -9,6 +15,7 @@
     MaxPassNumber = Max_Pass_Number;
     if( (pass_number%10) == 0 ) cout << pass_number << endl;
     CommSystemGraph.RunSimulation();
+    if(SimStopRequested) break;
     //break;
     }
   CommSystemGraph.DeleteModels();
@@ -4,4 +4,7 @@
   GET_INT_PARM(Max_Pass_Number);
   MaxPassNumber = Max_Pass_Number;
   EnclaveNumber = 0;
+  SimStopRequested = false;
+  SimStopVoters = 0;
+  SimStopVotes = 0;
 
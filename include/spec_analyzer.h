@@ -10,7 +10,7 @@
 #include "spect_calc_kinds.h"
 #include "samp_spect_util.h"
 #include "spec_estim.h"
-#include "gen_win.h"
+#include "win_cache.h"
 
 template <class T>
 class SpectrumAnalyzer : public PracSimModel
@@ -47,7 +47,7 @@ private:
   double Delta_F;
   double Norm_Factor;
   double Freq_Norm_Factor;
-  GenericWindow* Data_Window;
+  WindowTable *Data_Window;
   SpectrumEstimator<T> *Spec_Estim;
   //void (*Spectrum_Calc)( T* time_signal,
   //                   double* psd_estimate,
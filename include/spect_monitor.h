@@ -0,0 +1,130 @@
+//
+//  File = spect_monitor.h
+//
+
+#ifndef _SPECT_MONITOR_H_
+#define _SPECT_MONITOR_H_
+
+#include <fstream>
+#include <complex>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include "psmodel.h"
+#include "signal_T.h"
+#include "win_cache.h"
+#include "window_shapes.h"
+
+//  states of a segment slot as it is handed between
+//  the simulation thread and the worker threads
+#define SEG_SLOT_FREE    0
+#define SEG_SLOT_FILLED  1
+#define SEG_SLOT_BUSY    2
+#define SEG_SLOT_DONE    3
+
+// number of segment slots per worker thread
+#define SPECT_MON_SLOTS_PER_WORKER 4
+
+//======================================================
+//  Continuously running PSD estimator.
+//
+//  Execute() only assembles (overlapped) segments of the
+//  input and hands them to a pool of worker threads, each
+//  of which has its own window/FFT work buffers.  Finished
+//  periodograms are folded, in segment order, into either
+//  an exponential or a sliding-window average.  Every
+//  Snapshot_Interval passes the current estimate is
+//  appended to a binary file along with the pass number
+//  and simulation time.
+//
+//  If every slot is taken when a segment is ready, the
+//  simulation thread harvests what it can and works on
+//  queued segments itself until the oldest slot frees up,
+//  so no segment is ever lost.  The number of segments
+//  that had to wait is reported with each snapshot.
+
+template <class T>
+class SpectrumMonitor : public PracSimModel
+{
+public:
+  SpectrumMonitor( char* instance_name,
+                   PracSimModel* outer_model,
+                   Signal<T>* in_sig );
+
+  ~SpectrumMonitor(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  typedef struct{
+    std::atomic<int> state;
+    long seq_num;
+    T *time_seg;
+    double *periodogram;
+    } seg_slot_type;
+
+  void WorkerLoop(void);
+  bool ProcessOneSegment( T *win_seg,
+                          std::complex<double> *freq_seg );
+  void SubmitSegment(void);
+  void HarvestSegments(void);
+  void WriteSnapshot(void);
+
+  Signal<T> *In_Sig;
+  double Samp_Intvl;
+  int Seg_Len;
+  int Fft_Len;
+  int Shift_Between_Segs;
+  int Overlap_Len;
+  int Hold_Off;
+  int Num_Workers;
+  bool Using_Exponential_Avg;
+  double Exp_Avg_Time_Const;
+  int Num_Segs_To_Avg;
+  int Snapshot_Interval;
+  char *Psd_File_Name;
+  ofstream *Psd_File;
+  bool Using_Window;
+  WINDOW_SHAPE_T Window_Shape;
+  WindowTable *Data_Window;
+  double Kaiser_Beta;
+  double Window_Enbw;
+  double Delta_F;
+
+  //---------------------------------------
+  //  segment assembly (simulation thread)
+
+  T *Time_Seg;
+  int Samps_Needed;
+  long Samps_Consumed;
+  long Next_Seq_To_Fill;
+  long Next_Seq_To_Harvest;
+  long Num_Segs_Waited;
+  T *Submit_Win_Seg;
+  std::complex<double> *Submit_Freq_Seg;
+
+  //---------------------------------------
+  //  handoff to the workers
+
+  int Num_Slots;
+  seg_slot_type *Seg_Slots;
+  std::vector<std::thread*> Worker_Threads;
+  std::mutex Wakeup_Mutex;
+  std::condition_variable Wakeup_Cond;
+  std::atomic<int> Num_Pending_Segs;
+  std::atomic<bool> Shutdown_Requested;
+
+  //---------------------------------------
+  //  running average (simulation thread)
+
+  double *Psd_Est;
+  double *Pdgm_Sum;
+  double **Pdgm_History;
+  int History_Idx;
+  long Segs_In_Est;
+  long Segs_Since_Snapshot;
+};
+
+#endif //_SPECT_MONITOR_H_
@@ -0,0 +1,113 @@
+//
+//  File = spect_result.h
+//
+
+#ifndef _SPECT_RESULT_H_
+#define _SPECT_RESULT_H_
+
+#include <fstream>
+#include <vector>
+using namespace std;
+
+#define SPECT_RESULT_FLOOR_DB -200.0
+
+//  converts num_pts PSD values to dB in one pass, with
+//  nonpositive values mapped to SPECT_RESULT_FLOOR_DB
+void PsdToDecibels( double *psd,
+                    double *psd_db,
+                    int num_pts );
+
+//======================================================
+//  One published PSD estimate.  The PSD is held as linear
+//  values at bins 0 thru Num_Bins-1, spaced Delta_F apart,
+//  along with how it was obtained.
+
+class SpectrumResult
+{
+public:
+  SpectrumResult( const char *source_name,
+                  int pass_number,
+                  double *psd,
+                  int num_bins,
+                  double delta_f,
+                  int num_avg,
+                  double window_enbw );
+  ~SpectrumResult(void);
+
+  const char* GetSourceName(void){return Source_Name;};
+  int GetPassNumber(void){return Pass_Number;};
+  double* GetPsd(void){return Psd;};
+  int GetNumBins(void){return Num_Bins;};
+  double GetDeltaF(void){return Delta_F;};
+  int GetNumAvg(void){return Num_Avg;};
+  double GetWindowEnbw(void){return Window_Enbw;};
+
+  // fills psd_db (Num_Bins values) with the PSD in dB
+  void GetPsdInDecibels( double *psd_db );
+
+  void WriteBinary( ofstream *out_file,
+                    bool in_decibels );
+
+private:
+  char *Source_Name;
+  int Pass_Number;
+  double *Psd;
+  int Num_Bins;
+  double Delta_F;
+  int Num_Avg;
+
+  // equivalent noise bandwidth of the data window, in bins
+  double Window_Enbw;
+};
+
+//======================================================
+//  Collects the estimates published by the spectral
+//  models so they can be queried in memory or exported
+//  in binary form.  Only the most recent History_Depth
+//  results from each source are kept (by default just the
+//  latest one); a depth of 0 keeps every result.  If an
+//  export file name has been set, each result is also
+//  appended to that file as it is published, so results
+//  survive a Halt_When_Completed exit.
+//
+//  Binary layout:  "PSDRSLT1", then for each result the
+//  source name length (int) and characters, pass number
+//  (int), number of bins (int), delta f (double), number
+//  averaged (int), window ENBW (double), dB flag (int) and
+//  the Num_Bins PSD values (double).
+
+class SpectrumRegistry
+{
+public:
+  SpectrumRegistry(void);
+  ~SpectrumRegistry(void);
+
+  void SetExportFile( const char *file_name,
+                      bool in_decibels );
+  void SetHistoryDepth( int results_per_source );
+
+  SpectrumResult* Publish( const char *source_name,
+                           double *psd,
+                           int num_bins,
+                           double delta_f,
+                           int num_avg,
+                           double window_enbw );
+
+  int GetNumResults(void);
+  SpectrumResult* GetResult( int result_idx );
+
+  // most recent result from the named source, or NULL
+  SpectrumResult* GetLatest( const char *source_name );
+
+  void ExportBinary( const char *file_name,
+                     bool in_decibels );
+
+private:
+  vector<SpectrumResult*> Results;
+  int History_Depth;
+  char *Export_File_Name;
+  ofstream *Export_File;
+  bool Export_In_Decibels;
+};
+
+#endif
@@ -7,6 +7,7 @@
 
 #include "signal_T.h"
 #include "anlg_filt_iir.h"
+#include "k_pll_engine.h"
 
 class BandpassSquaringPLL : public PracSimModel
 {
@@ -27,6 +28,9 @@ BandpassSquaringPLL( char* instance_nam,
    int Execute(void);
 
 private:
+   template <int Diag_Mask> void RunLoop(int block_size);
+   typedef void (BandpassSquaringPLL::*LoopFnPtr)(int);
+
    double Samp_Intvl;
 
    Signal<float> *fsig_Input;
@@ -42,11 +46,15 @@ private:
    double K_Sub_D;
    double K_Sub_0;
    double OscOutput;
-   double Phi_Sub_2;
    double Omega_Sub_0;
    double Center_Freq_Hz;
    float Osc_Output_Prev_Val;
   AnalogFilterByIir<float> *Filter_Core;
+  k_StateSpaceLoopFilter *Filter;
+  k_Nco *Osc;
+  int Diag_Mask;
+  bool Square_Is_Used;
+  LoopFnPtr Run_Loop;
   
 };
 
@@ -0,0 +1,93 @@
+//
+//  File = stats_accum.h
+//
+
+#ifndef _STATS_ACCUM_H_
+#define _STATS_ACCUM_H_
+
+//  number of interleaved partial histograms; consecutive
+//  samples go to different partials so repeated hits on
+//  one bin do not serialize on a single counter
+#define STATS_ACCUM_LANES 4
+
+//======================================================
+//  Streaming histogram and moment accumulator.
+//
+//  Bins are Bin_Width wide starting at Left_Edge.  The
+//  bin index is found with a multiply by the reciprocal
+//  width, and out-of-range samples are clamped into two
+//  extra tally slots instead of being branched around.
+//
+//  Moments are computed per block about the block mean
+//  and then combined with the running moments using the
+//  pairwise update formulas, so the mean and central
+//  moments stay accurate over billions of samples.
+//  Accumulators with the same binning (for example, one
+//  per thread) can be combined with Merge().
+
+class StatsAccumulator
+{
+public:
+  StatsAccumulator( int num_bins,
+                    double left_edge,
+                    double bin_width,
+                    bool higher_moments_enab );
+  ~StatsAccumulator(void);
+
+  void Tally( const float *samps, int num_samps );
+  void Tally( const double *samps, int num_samps );
+  void Merge( StatsAccumulator *other );
+  void Reset(void);
+
+  long long GetCount(void){return Count;};
+  double GetMean(void){return Mean;};
+  double GetVariance(void);
+  double GetMin(void){return Min_Val;};
+  double GetMax(void){return Max_Val;};
+
+  //  only meaningful when higher moments are enabled;
+  //  kurtosis is the excess over a Gaussian
+  double GetSkewness(void);
+  double GetKurtosis(void);
+
+  //  sums the partial histograms into num_bins counts
+  void GetHistogram( double *bin_counts );
+  long long GetInRangeCount(void);
+  long long GetBelowRangeCount(void);
+  long long GetAboveRangeCount(void);
+
+  //  value below which the fraction prob of all samples
+  //  fall, interpolated within the histogram bins
+  double GetQuantile( double prob );
+
+private:
+  template <class S>
+  void TallyBlock( const S *samps, int num_samps );
+  void MergeMoments( long long count_b,
+                     double mean_b,
+                     double m2_b,
+                     double m3_b,
+                     double m4_b );
+  long long SlotTotal( int slot );
+
+  int Num_Bins;
+  int Num_Slots;
+  double Left_Edge;
+  double Bin_Width;
+  double Inv_Bin_Width;
+  bool Higher_Moments_Enab;
+
+  //  STATS_ACCUM_LANES partials of Num_Slots tallies;
+  //  slot 0 is below range, slot Num_Bins+1 is above
+  long long *Lane_Counts;
+
+  long long Count;
+  double Mean;
+  double M2;
+  double M3;
+  double M4;
+  double Min_Val;
+  double Max_Val;
+};
+
+#endif
@@ -7,7 +7,7 @@
 
 #include "signal_T.h"
 #include "psmodel.h"
-//#include "k_berctr.h"
+#include "ngram_stats.h"
 
 
 class SymbSeqAnalyzer : public PracSimModel
@@ -23,12 +23,14 @@ SymbSeqAnalyzer( char* instance_name,
 
 private:
   int Block_Size;
-  int *Symb_Count;
-  int *Double_Count;
   Signal<byte_t> *In_Sig;
   int Report_Intvl_In_Blocks;
   int Bits_Per_Symb;
   int Num_Diff_Symbs;
+  int Ngram_Order;
+  bool Continuous_Run;
+  int Num_Threads;
+  NgramStats *Stats;
   //int *Histogram;
   
 };
@@ -7,12 +7,16 @@
 
 #include "model_graph.h"
 #include "digraph.h"
+#include "sig_arena.h"
+#include "model_profiler.h"
 
 typedef struct{
   GenericSignal*     signal_id;
   int                block_size;
   double             samp_intvl;
   SignalKinds_type   kind_of_signal;
+  bool               block_size_is_tunable;
+  bool               block_size_is_pinned;
   } sdg_sig_desc_type;
 
 typedef struct{
@@ -22,6 +26,14 @@ typedef struct{
   bool              is_const_intvl;
   } sdg_edge_desc_type;
 
+typedef struct{
+  GenericSignal*    signal_id;
+  size_t            num_bytes;
+  int               first_use;
+  int               last_use;
+  size_t            arena_offset;
+  } sig_buf_plan_type;
+
 class SystemGraph
 {
 public:
@@ -32,22 +44,38 @@ public:
   void MergeCurrModelGraph( ModelGraph* cmsg );
   void DumpSDGraph(void);
   void ResolveSignalParms(void);
+  bool ScaleBlockSizes( int scale_numer, int scale_denom );
+  GenericSignal* GetTunableSignal(void);
   void TopoSortSDG(void);
   void Propagate( int base_sig_num,
                   int edge_num,
                   int sig_num,
                   bool is_forward);
   void DistributeSignalParms(void);
+  void AliasPassThruSignals(void);
   void AllocateStorageBuffers(void);
   void InitializeReadPtrs(void);
   void DeleteModels(void);
   void InitializeModels(void);
   void RunSimulation(void);
   void RegisterModel(PracSimModel* model);
+  void EnableProfiling( PROFILE_MODE_T profile_mode,
+                        int sample_intvl,
+                        const char* output_base_name = NULL,
+                        int max_trace_passes = 0 );
+  void ResetProfiler(void);
   void AllocatePlotPointers(void);
   GenericSignal* GetSignalId( char* sig_name);
 
 private:
+  int GetExecPosition( PracSimModel* model );
+  void GetSignalLifetime( GenericSignal* sig_id,
+                          int* first_use,
+                          int* last_use );
+  size_t PackSignalBuffers(
+                  std::vector<sig_buf_plan_type*> *buf_plan );
+  void SetupProfiler(void);
+
   std::vector<sdg_sig_desc_type*> *Sdg_Vert_Descr;
   std::vector<sdg_edge_desc_type*> *Sdg_Edge_Descr;
   std::vector<double> *Samp_Intvl;
@@ -57,7 +85,13 @@ private:
   int *Sorted_Sig_Nodes;
   std::vector<PracSimModel*> *Syst_Lev_Models;
   int Num_Sys_Lev_Models;
-  
+  SignalArena *Sig_Arena;
+  bool Signal_Parms_Resolved;
+  std::vector<int> *Base_Block_Size;
+  ModelProfiler *Profiler;
+  char *Profile_Base_Name;
+  bool Profiler_Is_Setup;
+
 };
 
 #endif //_SYSGRAPH_H_
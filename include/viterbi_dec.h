@@ -0,0 +1,44 @@
+//
+//  File = viterbi_dec.h
+//
+
+#ifndef _VITERBI_DEC_H_
+#define _VITERBI_DEC_H_
+
+#include "psmodel.h"
+#include "signal_T.h"
+#include "k_viterbi.h"
+
+//  Soft-decision Viterbi decoder matching ConvEncoder.
+//  Takes Num_Outputs soft values per bit (positive for
+//  a 1, scaled by Soft_Scale before quantizing) and puts
+//  out one bit per Num_Outputs inputs.  The output lags
+//  the encoder input by Traceback_Depth bits, so the BER
+//  reference must be delayed by the same amount.
+
+class ViterbiDecoder : public PracSimModel
+{
+public:
+  ViterbiDecoder( char* instance_name,
+                  PracSimModel* outer_model,
+                  Signal<float>* in_signal,
+                  Signal<bit_t>* out_signal );
+
+  ~ViterbiDecoder(void);
+  void Initialize(void);
+  int Execute(void);
+
+private:
+  int Block_Size;
+  int Num_Bits;
+  int Constr_Len;
+  int Num_Outputs;
+  int *Gen_Polys;
+  int Traceback_Depth;
+  float Soft_Scale;
+  Signal<float> *In_Sig;
+  Signal<bit_t> *Out_Sig;
+  k_ViterbiDecoder *Kernel;
+};
+
+#endif
@@ -7,7 +7,7 @@
 
 #include "psmodel.h"
 #include "signal_T.h"
-#include "gen_win.h"
+#include "win_cache.h"
 #include "window_shapes.h"
 //#include "spect_calc_kinds.h"
 //#include "samp_spect.h"
@@ -15,6 +15,12 @@
 //#include "dirform1.h"
 //using namespace std;
 
+//======================================================
+//  Welch periodogram of a real-valued signal.  Time_Seg is
+//  a circular buffer, so overlapping segments are read in
+//  place rather than shifted down, and windowing is done
+//  while the segment is packed for the real-input FFT.
+
 template <class T>
 class WelchPeriodogram : public PracSimModel
 {
@@ -31,12 +37,13 @@ private:
   int Block_Size;
   Signal<T> *In_Sig;
   std::complex<double> *Freq_Seg;
+  std::complex<double> *Packed_Seg;
+  std::complex<double> *Fft_Twiddles;
   double *Sample_Spectrum;
   double Samp_Intvl;
   //double *Sample_Spectrum;
   T *Time_Seg;
-  T *Overlap_Seg;
-  T *Win_Time_Seg;
+  int Write_Idx;
   double *Psd_Est;
   int Num_Segs_To_Avg;
   int Segs_In_Est;
@@ -45,7 +52,6 @@ private:
   int Seg_Len;
   int Samps_Needed;
   int Shift_Between_Segs;
-  int Overlap_Len;
   char *Psd_File_Name;
   ofstream *Psd_File;
   bool Halt_When_Completed;
@@ -53,13 +59,14 @@ private:
   bool Output_In_Decibels;
   bool Plot_Two_Sided;
   bool Using_Window;
-  GenericWindow* Data_Window;
-  double *Window_Taps;
+  WindowTable *Data_Window;
   WINDOW_SHAPE_T Window_Shape;
+  double Kaiser_Beta;
   double Delta_F;
   double Norm_Factor;
   double Freq_Norm_Factor;
-  double Window_Power;
+  double Window_Enbw;
+  double Psd_Scale;
   //void (*Spectrum_Calc)( T* time_signal,
   //                   double* psd_estimate,
   //                   int num_samps,
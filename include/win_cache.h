@@ -0,0 +1,81 @@
+//
+//  File = win_cache.h
+//
+
+#ifndef _WIN_CACHE_H_
+#define _WIN_CACHE_H_
+
+#include <complex>
+#include "window_shapes.h"
+
+//  byte alignment of cached tap arrays
+#define WINDOW_TAP_ALIGN 64
+
+typedef enum {
+  WINDOW_NORM_PEAK,        // taps as generated, peak of 1
+  WINDOW_NORM_UNIT_POWER,  // mean of squared taps is 1
+  WINDOW_NORM_UNIT_GAIN    // mean of taps (coherent gain) is 1
+  } WINDOW_NORM_T;
+
+//======================================================
+//  Immutable table of data window taps along with the
+//  figures of merit needed to interpret a windowed
+//  spectrum.  Tables are only created by GetCachedWindow()
+//  and live for the rest of the run, so every model that
+//  asks for the same window shares one copy.
+
+class WindowTable
+{
+public:
+  WindowTable( WINDOW_SHAPE_T shape,
+               int length,
+               WINDOW_NORM_T win_norm,
+               double kaiser_beta );
+  ~WindowTable(void);
+
+  const double* GetTaps(void){return Taps;};
+  int GetLength(void){return Length;};
+
+  // mean of the taps
+  double GetCoherentGain(void){return Coherent_Gain;};
+
+  // mean of the squared taps
+  double GetWindowPower(void){return Window_Power;};
+
+  // equivalent noise bandwidth in bins
+  double GetEnbw(void){return Enbw;};
+
+  //  out[is] = tap[tap_beg+is] * in[is] for num_samps
+  //  samples; in and out may be the same buffer
+  void Apply( const float *in_seg, float *out_seg,
+              int tap_beg, int num_samps );
+  void Apply( const float *in_seg, double *out_seg,
+              int tap_beg, int num_samps );
+  void Apply( const std::complex<float> *in_seg,
+              std::complex<float> *out_seg,
+              int tap_beg, int num_samps );
+
+  // whole-segment forms
+  void Apply( const float *in_seg, float *out_seg );
+  void Apply( const std::complex<float> *in_seg,
+              std::complex<float> *out_seg );
+
+private:
+  int Length;
+  double *Taps;
+  float *Float_Taps;
+  char *Tap_Storage;
+  double Coherent_Gain;
+  double Window_Power;
+  double Enbw;
+};
+
+//  returns the shared table for (shape, length, norm),
+//  building it on first use; kaiser_beta is only used
+//  for WINDOW_SHAPE_KAISER
+WindowTable* GetCachedWindow( WINDOW_SHAPE_T shape,
+                              int length,
+                              WINDOW_NORM_T win_norm,
+                              double kaiser_beta = 0.0 );
+
+#endif
@@ -9,6 +9,10 @@ typedef enum {
   WINDOW_SHAPE_TRIANGULAR,
   WINDOW_SHAPE_HAMMING,
   WINDOW_SHAPE_HANN,
+  WINDOW_SHAPE_RECTANGULAR,
+  WINDOW_SHAPE_KAISER,
+  WINDOW_SHAPE_BLACKMAN_HARRIS,
+  WINDOW_SHAPE_FLAT_TOP,
   sizeof_WINDOW_SHAPE_T
   } WINDOW_SHAPE_T;
 
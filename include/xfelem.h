@@ -20,6 +20,7 @@ public:
   ExtenFieldElem(void);
   ExtenFieldElem(GaloisField*);
   ExtenFieldElem(GaloisField*, int value);
+  ExtenFieldElem(const ExtenFieldElem&);
   bool EqualsZero();
   //void operator=(const int);
   void operator=(const ExtenFieldElem&);
@@ -42,6 +43,18 @@ private:
   int FieldDegree;
 };
 
+//  A copy shares the original's Value array (elements are
+//  passed and returned by value, and no element is changed
+//  in place once it has been built); assignment makes its
+//  own array.
+
+inline ExtenFieldElem::ExtenFieldElem(const ExtenFieldElem &right)
+  {
+  Field = right.Field;
+  FieldDegree = right.FieldDegree;
+  Value = right.Value;
+  }
+
 inline void ExtenFieldElem::operator=(const ExtenFieldElem &right)
   {
   Field = right.Field;
@@ -7,6 +7,14 @@
 
 #include "psmodel.h"
 #include "signal_T.h"
+#include "ar_estim.h"
+
+//======================================================
+//  AR spectrum estimate (Yule-Walker, Burg or covariance
+//  method) for each Seg_Len segment of the input.  The
+//  spectra of every Num_Segs_To_Avg segments are averaged
+//  and appended to Psd_File, so long records can be
+//  tracked as a sequence of estimates.
 
 class YuleWalkerPsdEstim : public PracSimModel
 {
@@ -22,13 +30,14 @@ public:
 private:
   int Block_Size;
   Signal<float> *In_Sig;
-  std::complex<double> *Freq_Seg;
-  double *Sample_Spectrum;
+  ArEstimator *Ar_Estimator;
+  AR_METHOD_T Ar_Method;
   double Samp_Intvl;
   double *Time_Seg;
   double *Psd_Est;
   int Num_Freq_Pts;
   int Segs_In_Est;
+  int Num_Segs_To_Avg;
   int Ar_Order;
   int Hold_Off;
   int Seg_Len;
@@ -262,6 +262,6 @@ int AdditiveGaussianNoise<T>::Execute(void)
    }
    return(_MES_AOK);
 };
-template AdditiveGaussianNoise< complex<float> >;
-template AdditiveGaussianNoise<float>;
+template class AdditiveGaussianNoise< complex<float> >;
+template class AdditiveGaussianNoise<float>;
 
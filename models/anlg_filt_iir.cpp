@@ -44,6 +44,10 @@ AnalogFilterByIir<T>::
    MAKE_INPUT(In_Sig);
    MAKE_OUTPUT(Out_Sig);
    In_Sig->SetAllocMemDepth( Filt_Order );
+   if(Bypass_Enabled){
+      DECLARE_PASS_THRU(In_Sig, Out_Sig);
+      DECLARE_BLOCK_ALIAS(In_Sig, Out_Sig);
+   }
    Using_Signal_Objects = true;
    return;
 }
@@ -247,14 +251,8 @@ int AnalogFilterByIir<T>::Execute()
    Out_Sig->SetValidBlockSize(proc_block_size);
 
    if(Bypass_Enabled){
-      // copy input signal to output signal
-      for(  samp_idx=0; 
-            samp_idx<Proc_Block_Size; 
-            samp_idx++){
-         *out_sig_ptr = *in_sig_ptr;
-         out_sig_ptr++;
-         in_sig_ptr++;
-      }
+      // output is the input -- read it in place
+      Out_Sig->AliasBlock(In_Sig);
    }
    else
    {
@@ -360,5 +358,29 @@ T AnalogFilterByIir<T>::ProcessSample(T input_val)
    } // end of else clause on if(Bypass_Enabled) control structure
    return(output_val);
 }
-template AnalogFilterByIir<std::complex<float> >;
-template AnalogFilterByIir<float>;
\ No newline at end of file
+//======================================================
+template <class T>
+int AnalogFilterByIir<T>::GetFiltOrder(void)
+{
+   return(Filt_Order);
+}
+//======================================================
+template <class T>
+double* AnalogFilterByIir<T>::GetACoefs(void)
+{
+   return(A_Coefs);
+}
+//======================================================
+template <class T>
+double* AnalogFilterByIir<T>::GetBCoefs(void)
+{
+   return(B_Coefs);
+}
+//======================================================
+template <class T>
+bool AnalogFilterByIir<T>::BypassIsEnabled(void)
+{
+   return(Bypass_Enabled);
+}
+template class AnalogFilterByIir<std::complex<float> >;
+template class AnalogFilterByIir<float>;
\ No newline at end of file
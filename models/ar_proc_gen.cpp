@@ -107,4 +107,4 @@ int ArProcessGenerator<T>::Execute(void)
    return(_MES_AOK);
 };
 
-template ArProcessGenerator<float>;
+template class ArProcessGenerator<float>;
@@ -11,6 +11,7 @@
 //#include "hann.h"
 #include "fft_T.h"
 #include "dump_spect.h"
+#include "spect_result.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -20,6 +21,7 @@
 
 extern ParmFile *ParmInput;
 extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
 
 //======================================================
 
@@ -49,9 +51,12 @@ BartlettPeriodogram<T>::
    In_Sig = in_sig;
    MAKE_INPUT(In_Sig);
 
-   Time_Seg = new T[Seg_Len];
+   Cmpx_Seg = new std::complex<float>[Seg_Len];
    Sample_Spectrum = new double[Fft_Len];
    Freq_Seg = new std::complex<double>[Fft_Len];
+   Packed_Seg = new std::complex<double>[Fft_Len/2];
+   Fft_Twiddles = new std::complex<double>[Fft_Len/2];
+   RealFftTwiddles<double>(Fft_Twiddles, Fft_Len);
 
    for(int is=0; is<Fft_Len; is++) {
       Sample_Spectrum[is] = 0.0;
@@ -73,12 +78,81 @@ void BartlettPeriodogram<T>::Initialize(void)
    Samp_Intvl = In_Sig->GetSampIntvl();
    Delta_F = 1.0/(Samp_Intvl*Fft_Len);
 
+   // periodogram and averaging normalization, applied once at dump time
+   Psd_Scale = Samp_Intvl / (double(Seg_Len) * Num_Segs_To_Avg);
+
+   for(int is=0; is<Fft_Len/2; is++) {
+      Packed_Seg[is] = std::complex<double>(0.0, 0.0);
+   }
 };
 //======================================================
+//  Append num_samps input samples to the segment being
+//  assembled.
+
+template <class T>
+void BartlettPeriodogram<T>::StoreSamples( float *in_sig_ptr,
+                                           int num_samps )
+{
+   double *pack_ptr = (double*)Packed_Seg + (Seg_Len - Samps_Needed);
+   for(int is=0; is<num_samps; is++){
+      pack_ptr[is] = in_sig_ptr[is];
+   }
+}
+//------------------------------------------------------
+template <class T>
+void BartlettPeriodogram<T>::StoreSamples( 
+                              std::complex<float> *in_sig_ptr,
+                              int num_samps )
+{
+   std::complex<float> *seg_ptr = Cmpx_Seg + (Seg_Len - Samps_Needed);
+   for(int is=0; is<num_samps; is++){
+      seg_ptr[is] = in_sig_ptr[is];
+   }
+}
+//======================================================
+//  Add the unnormalized periodogram of the completed
+//  segment to Sample_Spectrum.  The argument only selects
+//  the real or complex path.
+
+template <class T>
+void BartlettPeriodogram<T>::AccumSegment( float *seg_type )
+{
+   int i;
+   RealFFT<double>(  Packed_Seg,
+                     Fft_Twiddles,
+                     Freq_Seg,
+                     Fft_Len);
+
+   for(i=0; i<Fft_Len/2; i++){
+      Sample_Spectrum[i] += std::norm(Freq_Seg[i]);
+   }
+
+   // restore the zero padding overwritten by the FFT
+   double *pack_ptr = (double*)Packed_Seg;
+   for(i=Seg_Len; i<Fft_Len; i++){
+      pack_ptr[i] = 0.0;
+   }
+}
+//------------------------------------------------------
+template <class T>
+void BartlettPeriodogram<T>::AccumSegment( 
+                              std::complex<float> *seg_type )
+{
+   FFT<double>(   
+      Cmpx_Seg,
+      Freq_Seg,
+      Seg_Len,
+      Fft_Len);
+
+   for(int i=0; i<Fft_Len; i++){
+      Sample_Spectrum[i] += std::norm(Freq_Seg[i]);
+   }
+}
+//======================================================
 template <class T>
 int BartlettPeriodogram<T>::Execute()
 {
-   int i,is;
+   int i;
 #ifdef _DEBUG
    *DebugFile << "In SampleSpectrum::Execute\0" << endl;
 #endif
@@ -100,35 +174,26 @@ int BartlettPeriodogram<T>::Execute()
       //
       //  Fill up FFT buffer by getting Samps_Needed
       //  input samples.
-      for(is=Samps_Needed; is>0; is--){
-         Time_Seg[Seg_Len - is] = *in_sig_ptr++;
-      }
+      StoreSamples(in_sig_ptr, Samps_Needed);
+      in_sig_ptr += Samps_Needed;
       samps_avail -= Samps_Needed;
 
-      //  Perform FFT
-      FFT<double>(   
-         Time_Seg,
-         Freq_Seg,
-         Seg_Len,
-         Fft_Len);
-
-      for(i=0; i<Seg_Len; i++){
-         Sample_Spectrum[i] += Samp_Intvl * 
-            std::norm(Freq_Seg[i])/Seg_Len;
-      }
-
-      for(is=0; is<Seg_Len; is++){
-         Time_Seg[is] = 0.0;
-      }
+      AccumSegment(in_sig_ptr);
       Samps_Needed = Seg_Len;
       Segs_In_Est++;
 
       // is it time to dump the results?
       if(Segs_In_Est == Num_Segs_To_Avg){
-         for(i=0; i<Seg_Len; i++){
-            Sample_Spectrum[i] /= 
-               double(Num_Segs_To_Avg);
+         for(i=0; i<Fft_Len; i++){
+            Sample_Spectrum[i] *= Psd_Scale;
          }
+         SpectRegistry.Publish(  
+            GetInstanceName(),
+            Sample_Spectrum,
+            Fft_Len/2,
+            Delta_F,
+            Num_Segs_To_Avg,
+            1.0);
          DumpSpectrum(  
             Sample_Spectrum,
             Fft_Len,
@@ -155,13 +220,10 @@ int BartlettPeriodogram<T>::Execute()
    //  to finish a segment.  Copy the avaialble samples
    //  and then wait for the next pass to get some more.
 
-   for(is=0; is<samps_avail; is++){
-      Time_Seg[Seg_Len - Samps_Needed + is] = 
-                                       *in_sig_ptr++;
-   }
+   StoreSamples(in_sig_ptr, samps_avail);
    Samps_Needed -= samps_avail;
    return(_MES_AOK);
 
 }
-template BartlettPeriodogram< std::complex<float> >;
-template BartlettPeriodogram<float>;
+template class BartlettPeriodogram< std::complex<float> >;
+template class BartlettPeriodogram<float>;
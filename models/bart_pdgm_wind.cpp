@@ -6,20 +6,18 @@
 #include "parmfile.h"
 #include "model_graph.h"
 #include "bart_pdgm_wind.h"
-#include "trianglr.h"
-#include "hamming.h"
-#include "hann.h"
+#include "win_cache.h"
 #include "fft_T.h"
 #include "dump_spect.h"
+#include "spect_result.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
 #endif
-#define _NO_ZERO_ENDS 0
-#define _ZERO_ENDS 1
 
 extern ParmFile *ParmInput;
 extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
 
 //======================================================
 template <class T>
@@ -47,43 +45,34 @@ BartlettPeriodogramWindowed<T>::
    strcpy(Psd_File_Name, "\0");
    GET_STRING_PARM(Psd_File_Name);
 
+   Kaiser_Beta = 0.0;
    if(Using_Window){
       Window_Shape = 
          GetWindowShapeParm("Window_Shape\0");
-
-      switch(Window_Shape){
-      case WINDOW_SHAPE_TRIANGULAR:
-         Data_Window = new TriangularWindow( Seg_Len,
-                                       _NO_ZERO_ENDS );
-         break;
-      case WINDOW_SHAPE_HAMMING:
-         Data_Window = new HammingWindow( Seg_Len );
-         break;
-      case WINDOW_SHAPE_HANN:
-         Data_Window = new HannWindow( Seg_Len, 
-                                       _NO_ZERO_ENDS );
-         break;
-      }
-
-      Window_Taps = Data_Window->GetDataWindow();
-      Window_Power = 0.0;
-      for(is=0; is<Seg_Len; is++){
-         Window_Power +=Window_Taps[is]*Window_Taps[is];
-      }
-      Window_Power /= double(Seg_Len);
-      double window_scale = sqrt(Window_Power);
-      for(is=0; is<Seg_Len; is++){
-         Window_Taps[is] /= window_scale;
+      if(Window_Shape == WINDOW_SHAPE_KAISER){
+         GET_DOUBLE_PARM(Kaiser_Beta);
       }
    }
+   else{
+      // rectangular window keeps the fill loop free of branches
+      Window_Shape = WINDOW_SHAPE_RECTANGULAR;
+   }
+
+   // unit power taps keep the PSD level unbiased
+   Data_Window = GetCachedWindow( Window_Shape,
+                                  Seg_Len,
+                                  WINDOW_NORM_UNIT_POWER,
+                                  Kaiser_Beta );
+   Window_Enbw = Data_Window->GetEnbw();
 
    In_Sig = in_sig;
    MAKE_INPUT(In_Sig);
 
-   Time_Seg = new T[Seg_Len];
-   Win_Time_Seg = new T[Seg_Len];
    Sample_Spectrum = new double[Fft_Len];
-   Freq_Seg = new std::complex<double>[Fft_Len];
+   Packed_Seg = new std::complex<double>[Fft_Len/2];
+   Freq_Seg = new std::complex<double>[Fft_Len/2 + 1];
+   Fft_Twiddles = new std::complex<double>[Fft_Len/2];
+   RealFftTwiddles<double>(Fft_Twiddles, Fft_Len);
 
    for(is=0; is<Fft_Len; is++){
       Sample_Spectrum[is] = 0.0;
@@ -106,12 +95,19 @@ void BartlettPeriodogramWindowed<T>::Initialize(void)
    Samp_Intvl = In_Sig->GetSampIntvl();
    Delta_F = 1.0/(Samp_Intvl*Fft_Len);
 
+   // periodogram and averaging normalization, applied once at dump time
+   Psd_Scale = Samp_Intvl / (double(Seg_Len) * Num_Segs_To_Avg);
+
+   for(int is=0; is<Fft_Len/2; is++){
+      Packed_Seg[is] = std::complex<double>(0.0, 0.0);
+   }
 };
 //======================================================
 template <class T>
 int BartlettPeriodogramWindowed<T>::Execute()
 {
    int i,is;
+   double *pack_ptr;
 #ifdef _DEBUG
    *DebugFile 
       << "In BartlettPeriodogramWindowed::Execute\0" 
@@ -124,6 +120,7 @@ int BartlettPeriodogramWindowed<T>::Execute()
    //  Get pointers for buffers
 
    T *in_sig_ptr = GET_INPUT_PTR(In_Sig);
+   pack_ptr = (double*)Packed_Seg;
 
    int samps_avail = Block_Size;
 
@@ -133,46 +130,40 @@ int BartlettPeriodogramWindowed<T>::Execute()
       //  to finish a segment.
       //  Fill up FFT buffer by getting 
       //  Samps_Needed input samples.
-      for(is=Samps_Needed; is>0; is--){
-         Time_Seg[Seg_Len - is] = *in_sig_ptr++;
-      }
+      is = Seg_Len-Samps_Needed;
+      Data_Window->Apply( in_sig_ptr, pack_ptr + is, 
+                          is, Samps_Needed );
+      in_sig_ptr += Samps_Needed;
       samps_avail -= Samps_Needed;
 
-      if(Using_Window){
-         for(is=0; is<Seg_Len; is++){
-            Win_Time_Seg[is] = 
-                  Window_Taps[is]*Time_Seg[is];
-         }
-      }
-      else{
-         for(is=0; is<Seg_Len; is++){
-            Win_Time_Seg[is] = Time_Seg[is];
-         }
-      }
-
       //  Perform FFT
-      FFT<double>(   Win_Time_Seg,
-                     Freq_Seg,
-                     Seg_Len,
-                     Fft_Len);
-
-      for(i=0; i<Seg_Len; i++){
-         Sample_Spectrum[i] += Samp_Intvl * 
-                  std::norm(Freq_Seg[i])/Seg_Len;
+      RealFFT<double>(  Packed_Seg,
+                        Fft_Twiddles,
+                        Freq_Seg,
+                        Fft_Len);
+
+      for(i=0; i<Fft_Len/2; i++){
+         Sample_Spectrum[i] += std::norm(Freq_Seg[i]);
       }
 
-      for(is=0; is<Seg_Len; is++){
-         Time_Seg[is] = 0.0;
+      // restore the zero padding overwritten by the FFT
+      for(is=Seg_Len; is<Fft_Len; is++){
+         pack_ptr[is] = 0.0;
       }
       Samps_Needed = Seg_Len;
       Segs_In_Est++;
 
       // is it time to dump the results?
       if(Segs_In_Est == Num_Segs_To_Avg){
-         for(i=0; i<Seg_Len; i++){
-            Sample_Spectrum[i] /= 
-                        double(Num_Segs_To_Avg);
+         for(i=0; i<Fft_Len/2; i++){
+            Sample_Spectrum[i] *= Psd_Scale;
          }
+         SpectRegistry.Publish(  GetInstanceName(),
+                                 Sample_Spectrum,
+                                 Fft_Len/2,
+                                 Delta_F,
+                                 Num_Segs_To_Avg,
+                                 Window_Enbw);
          DumpSpectrum(  Sample_Spectrum,
                         Fft_Len,
                         Delta_F,
@@ -199,12 +190,11 @@ int BartlettPeriodogramWindowed<T>::Execute()
    //  to finish a segment.  Copy the avaialble samples 
    //  and then wait for the next pass to get some more.
 
-   for(is=0; is<samps_avail; is++){
-      Time_Seg[Seg_Len - Samps_Needed + is] = 
-                                       *in_sig_ptr++;
-   }
+   is = Seg_Len-Samps_Needed;
+   Data_Window->Apply( in_sig_ptr, pack_ptr + is, 
+                       is, samps_avail );
    Samps_Needed -= samps_avail;
    return(_MES_AOK);
 }
 //======================================================
-template BartlettPeriodogramWindowed<float>;
+template class BartlettPeriodogramWindowed<float>;
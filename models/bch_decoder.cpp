@@ -0,0 +1,128 @@
+//
+//  File = bch_decoder.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "bch_decoder.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+extern int PassNumber;
+using namespace std;
+
+//======================================================
+
+BchDecoder::BchDecoder( char* instance_name,
+                      PracSimModel* outer_model,
+                      Signal<bit_t>* in_signal,
+                      Signal<bit_t>* out_signal )
+          :PracSimModel(instance_name,
+                        outer_model)
+{
+  MODEL_NAME(BchDecoder);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Gf_Degree);
+  GET_INT_PARM(Code_Len);
+  GET_INT_PARM(Num_Corr);
+  GET_INT_PARM(Num_Holdoff_Passes);
+  GET_INT_PARM(Report_Intvl_In_Blocks);
+
+  Field = new Gf2mField(Gf_Degree);
+  Codec = new BchCodec(Field, Code_Len, Num_Corr);
+  Msg_Len = Codec->GetMsgLen();
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, double(Msg_Len)/double(Code_Len));
+  SET_BLOCK_GRANULARITY(In_Sig, Code_Len);
+}
+//======================================================
+BchDecoder::~BchDecoder( void )
+{
+  delete Codec;
+  delete Field;
+};
+
+//======================================================
+void BchDecoder::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  if(Block_Size % Code_Len)
+    {
+    ostrstream temp_stream;
+    temp_stream << "BchDecoder input block size " << Block_Size
+                << " is not a multiple of Code_Len" << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Num_Codewords = Block_Size/Code_Len;
+  Code_Buf.resize(Block_Size);
+  Cw_Num_Corr.resize(Num_Codewords);
+
+  Codewords_Decoded = 0;
+  Codewords_Corrected = 0;
+  Bits_Corrected = 0;
+  Decoder_Failures = 0;
+};
+
+//======================================================
+int BchDecoder::Execute()
+{
+  bit_t *bits_in, *bits_out;
+  int is, iw;
+
+  bits_in = GET_INPUT_PTR( In_Sig );
+  bits_out = GET_OUTPUT_PTR( Out_Sig );
+
+  for(is=0; is<Block_Size; is++) Code_Buf[is] = bits_in[is] & 1;
+  Codec->DecodeBlock(&Code_Buf[0], Num_Codewords, &Cw_Num_Corr[0]);
+
+  for(iw=0; iw<Num_Codewords; iw++)
+    {
+    for(is=0; is<Msg_Len; is++)
+      {
+      bits_out[iw*Msg_Len + is] = Code_Buf[iw*Code_Len + is];
+      }
+    }
+  Out_Sig->SetValidBlockSize(Num_Codewords*Msg_Len);
+
+  if(PassNumber <= Num_Holdoff_Passes ) return(_MES_AOK);
+
+  for(iw=0; iw<Num_Codewords; iw++)
+    {
+    if(Cw_Num_Corr[iw] < 0)
+      {
+      Decoder_Failures++;
+      }
+    else if(Cw_Num_Corr[iw] > 0)
+      {
+      Codewords_Corrected++;
+      Bits_Corrected += Cw_Num_Corr[iw];
+      }
+    }
+  Codewords_Decoded += Num_Codewords;
+
+  if( ((PassNumber - Num_Holdoff_Passes) % Report_Intvl_In_Blocks) == 0)
+    {
+    BasicResults << GetInstanceName() << ": " << PassNumber
+                 << "  codewords = " << double(Codewords_Decoded)
+                 << "  corrected = " << double(Codewords_Corrected)
+                 << "  bits corrected = " << double(Bits_Corrected)
+                 << "  failures = " << double(Decoder_Failures) << endl;
+    BasicResults << "decoder failure rate = "
+                 << (Codewords_Decoded > 0 ?
+                     double(Decoder_Failures)/double(Codewords_Decoded) : 0.0)
+                 << endl;
+    }
+  return(_MES_AOK);
+}
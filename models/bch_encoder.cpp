@@ -0,0 +1,82 @@
+//
+//  File = bch_encoder.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "bch_encoder.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+using namespace std;
+
+//======================================================
+
+BchEncoder::BchEncoder( char* instance_name,
+                        PracSimModel* outer_model,
+                        Signal<bit_t>* in_signal,
+                        Signal<bit_t>* out_signal )
+           :PracSimModel(instance_name,
+                         outer_model)
+{
+  MODEL_NAME(BchEncoder);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Gf_Degree);
+  GET_INT_PARM(Code_Len);
+  GET_INT_PARM(Num_Corr);
+
+  Field = new Gf2mField(Gf_Degree);
+  Codec = new BchCodec(Field, Code_Len, Num_Corr);
+  Msg_Len = Codec->GetMsgLen();
+  BasicResults << GetInstanceName() << ": BCH (" << Code_Len << ","
+               << Msg_Len << ") code" << endl;
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, double(Code_Len)/double(Msg_Len));
+  SET_BLOCK_GRANULARITY(In_Sig, Msg_Len);
+}
+//======================================================
+BchEncoder::~BchEncoder( void )
+{
+  delete Codec;
+  delete Field;
+};
+
+//======================================================
+void BchEncoder::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  if(Block_Size % Msg_Len)
+    {
+    ostrstream temp_stream;
+    temp_stream << "BchEncoder input block size " << Block_Size
+                << " is not a multiple of " << Msg_Len << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Num_Codewords = Block_Size/Msg_Len;
+};
+
+//======================================================
+int BchEncoder::Execute()
+{
+  bit_t *bits_in, *bits_out;
+
+  bits_in = GET_INPUT_PTR( In_Sig );
+  bits_out = GET_OUTPUT_PTR( Out_Sig );
+
+  Codec->EncodeBlock(bits_in, bits_out, Num_Codewords);
+
+  Out_Sig->SetValidBlockSize(Num_Codewords*Code_Len);
+  return(_MES_AOK);
+}
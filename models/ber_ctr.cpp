@@ -33,6 +33,26 @@ BerCounter::BerCounter( char* instance_name,
   GET_INT_PARM(Num_Holdoff_Passes);
   GET_INT_PARM(Report_Intvl_In_Blocks);
 
+  // Max_Lag = 0 (the default) takes the streams as
+  // already aligned
+  GET_INT_PARM_OPT(Max_Lag, 0);
+  Sync_Window_Len = 0;
+  Max_Window_Errs = 0;
+  if(Max_Lag > 0)
+    {
+    GET_INT_PARM(Sync_Window_Len);
+    GET_INT_PARM(Max_Window_Errs);
+    }
+
+  // Conf_Level = 0 (the default) omits the intervals, and
+  // Target_Rel_Precision = 0 never stops the run
+  GET_DOUBLE_PARM_OPT(Conf_Level, 0.0);
+  Target_Rel_Precision = 0.0;
+  if(Conf_Level > 0.0)
+    {
+    GET_DOUBLE_PARM(Target_Rel_Precision);
+    }
+
   MAKE_INPUT(In_Sig);
   MAKE_INPUT(Ref_Sig);
 
@@ -45,9 +65,17 @@ BerCounter::BerCounter( char* instance_name,
   Kernel = new k_BerCounter(  sub_name, 
                               Num_Holdoff_Passes,
                               Report_Intvl_In_Blocks );
+  Kernel->SetDelaySearch( Max_Lag,
+                          Sync_Window_Len,
+                          Max_Window_Errs );
+  Kernel->SetConfidence( Conf_Level,
+                         Target_Rel_Precision );
 }
 //======================================================
-BerCounter::~BerCounter( void ){ };
+BerCounter::~BerCounter( void )
+{
+  delete Kernel;
+};
 
 //======================================================
 void BerCounter::Initialize(void)
@@ -52,5 +52,5 @@ BesselFilterByIir<T>::BesselFilterByIir( char *instance_name,
 
 template <class T>
 BesselFilterByIir<T>::~BesselFilterByIir(){};
-template BesselFilterByIir<float>;
-template BesselFilterByIir<std::complex<float> >;
+template class BesselFilterByIir<float>;
+template class BesselFilterByIir<std::complex<float> >;
@@ -0,0 +1,91 @@
+//
+//  File = bursterrorgen.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include "parmfile.h"
+#include "bursterrorgen.h"
+#include "model_graph.h"
+#include "syst_graph.h"
+#include "misdefs.h"
+extern ParmFile *ParmInput;
+#ifdef _DEBUG
+  extern ofstream *DebugFile;
+#endif
+
+//======================================================
+
+BurstErrorGener::BurstErrorGener( char* instance_name,
+                                  PracSimModel* outer_model,
+                                  Signal<bit_t>* in_signal,
+                                  Signal<bit_t>* out_signal)
+                :PracSimModel(instance_name,
+                              outer_model)
+{
+   MODEL_NAME(BurstErrorGener);
+
+   In_Sig = in_signal;
+   Out_Sig = out_signal;
+
+   OPEN_PARM_BLOCK;
+   GET_BOOL_PARM(Two_State_Chan);
+   if(Two_State_Chan){
+      GET_DOUBLE_PARM(Good_Error_Prob);
+      GET_DOUBLE_PARM(Bad_Error_Prob);
+      GET_DOUBLE_PARM(Good_To_Bad_Prob);
+      GET_DOUBLE_PARM(Bad_To_Good_Prob);
+   }
+   else{
+      GET_DOUBLE_PARM(Bit_Error_Probability);
+   }
+   GET_LONG_PARM(Initial_Seed);
+
+   MAKE_OUTPUT( Out_Sig );
+   MAKE_INPUT( In_Sig );
+
+   if(Two_State_Chan){
+      Err_Sampler = new GapErrorSampler( Good_Error_Prob,
+                                         Bad_Error_Prob,
+                                         Good_To_Bad_Prob,
+                                         Bad_To_Good_Prob,
+                                         Initial_Seed );
+   }
+   else{
+      Err_Sampler = new GapErrorSampler( Bit_Error_Probability,
+                                         Initial_Seed );
+   }
+   BasicResults << "mean bit error probability = "
+                << Err_Sampler->GetMeanErrorProb() << endl;
+}
+
+//======================================================
+BurstErrorGener::~BurstErrorGener( void )
+{
+   delete Err_Sampler;
+};
+
+//======================================================
+void BurstErrorGener::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+};
+
+//======================================================
+int BurstErrorGener::Execute()
+{
+   bit_t *in_sig_ptr, *out_sig_ptr;
+   int block_size;
+
+   out_sig_ptr = GET_OUTPUT_PTR(Out_Sig);
+   in_sig_ptr = GET_INPUT_PTR(In_Sig);
+
+   block_size = In_Sig->GetValidBlockSize();
+   Out_Sig->SetValidBlockSize(block_size);
+
+   memcpy(out_sig_ptr, in_sig_ptr, block_size*sizeof(bit_t));
+   Err_Sampler->Inject(out_sig_ptr, block_size);
+
+   return(_MES_AOK);
+}
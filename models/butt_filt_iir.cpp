@@ -74,5 +74,5 @@ ButterworthFilterByIir<T>::
 
 template <class T>
 ButterworthFilterByIir<T>::~ButterworthFilterByIir(){};
-template ButterworthFilterByIir<float>;
-template ButterworthFilterByIir<std::complex<float> >;
+template class ButterworthFilterByIir<float>;
+template class ButterworthFilterByIir<std::complex<float> >;
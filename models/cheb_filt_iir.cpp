@@ -54,5 +54,5 @@ ChebyshevFilterByIir<T>::ChebyshevFilterByIir( char *instance_name,
 }
 template <class T>
 ChebyshevFilterByIir<T>::~ChebyshevFilterByIir(){};
-template ChebyshevFilterByIir<float>;
-template ChebyshevFilterByIir<std::complex<float> >;
+template class ChebyshevFilterByIir<float>;
+template class ChebyshevFilterByIir<std::complex<float> >;
@@ -8,8 +8,6 @@
 #include "coarse_delay_est.h"
 #include "misdefs.h"
 #include "model_graph.h"
-#include "dit_pino_T.h"
-#include "dit_nipo_T.h"
 
 extern ParmFile* ParmInput;
 extern int PassNumber;
@@ -49,6 +47,13 @@ CoarseDelayEstimator::CoarseDelayEstimator( char* instance_name,
      GET_INT_PARM(Search_Window_End);
   }
   GET_BOOL_PARM(Invert_Input_Sig_Enab);
+  // older parameter files have no Peak_Interp_Mode and
+  // get the original integer-lag peak
+  if(ParmInput->ParmIsPresent("Peak_Interp_Mode\0"))
+    Peak_Interp_Mode = GetPeakInterpParm("Peak_Interp_Mode\0");
+  else
+    Peak_Interp_Mode = PEAK_INTERP_NONE;
+  BasicResults << "   " << "Peak_Interp_Mode = " << Peak_Interp_Mode << endl;
   GET_INT_PARM(Smoothing_Sidelobe_Len);
 
   MAKE_OUTPUT(Out_Sig);
@@ -65,9 +70,7 @@ CoarseDelayEstimator::~CoarseDelayEstimator( void ){ };
 //======================================================
 void CoarseDelayEstimator::Initialize(void)
 {
-   int dummy_size, i;
-   double tmp_nsexp;
-   double frac_part, int_part;
+   int i;
    float sample=0;
 
    Proc_Block_Size = Out_Sig->GetBlockSize();
@@ -76,62 +79,22 @@ void CoarseDelayEstimator::Initialize(void)
    In_Sig_Buf = new AuxSignalBuffer<float>(sample, Proc_Block_Size);
    Ref_Sig_Buf = new AuxSignalBuffer<float>(sample, Proc_Block_Size);
 
-   tmp_nsexp = log10(double(Proc_Block_Size))/log10(2.0);
-   frac_part = modf(tmp_nsexp, &int_part);
-
-   if( frac_part != 0.0 )
-      {
-      Ns_Exp = int_part + 2;
-      }
-   else
-      {
-      Ns_Exp = int_part + 1;
-      }
-
-   Full_Corr_Size = pow(2.0, Ns_Exp);
-   X = new std::complex<float>[Full_Corr_Size];
-   Y = new std::complex<float>[Full_Corr_Size];
+   // zero padded to at least twice the block size
+   Corr_Engine = new CrossCorrelator<float>(Proc_Block_Size);
+   Corr_Engine->SetInputInversion(Invert_Input_Sig_Enab);
+   Full_Corr_Size = Corr_Engine->GetFftLen();
 
    if(Limited_Search_Window_Enab)
       {
-      if(Search_Window_Beg < 0)
-         {
-         Neg_Window_Beg = Full_Corr_Size + Search_Window_Beg;
-         Pos_Window_Beg = 0;
-         }
-      else
-         {
-         Neg_Window_Beg = Full_Corr_Size;
-         Pos_Window_Beg = Search_Window_Beg;
-         }
-      if(Search_Window_End >= 0)
-         {
-         Pos_Window_End = Search_Window_End;
-         Neg_Window_End = Full_Corr_Size-1;
-         }
-      else
-         {
-         Pos_Window_End = -1;
-         Neg_Window_End = Search_Window_End;
-         }
+      Min_Search_Lag = Search_Window_Beg;
+      Max_Search_Lag = Search_Window_End;
       }
    else
       {
-      Neg_Window_Beg = Full_Corr_Size/2 + 1;
-      Neg_Window_End = Full_Corr_Size-1;
-      Pos_Window_Beg = 0;
-      Pos_Window_End = Full_Corr_Size/2 - 1;
+      Min_Search_Lag = 1 - Full_Corr_Size/2;
+      Max_Search_Lag = Full_Corr_Size/2 - 1;
       }
 
-
-   dummy_size = Full_Corr_Size - Proc_Block_Size;
-   Zero_Array = new std::complex<float>[dummy_size];
-   for( i = 0; i < dummy_size; i++)
-   {
-      Zero_Array[i] = std::complex<float>(0.0, 0.0);
-   }
-   Size_Of_FComplex = sizeof(std::complex<float>);
-
    Max_Corr = 0.0;
    Max_Corr_Time = 0.0;
 
@@ -152,10 +115,7 @@ int CoarseDelayEstimator::Execute()
    int in_sig_buf_count;
    int ref_sig_buf_count;
    float *out_sig_ptr;
-   float max_corr;
-   float out_mag, x_temp; // out_angle;
    float max_corr_time;
-   int zero_size;
    int samp, max_samp;
    double deg_per_rad = 180.0/PI;
    double phase_deg;
@@ -164,14 +124,12 @@ int CoarseDelayEstimator::Execute()
 
    //-------------------------------------------------------
    //  Copy frequently accessed member vars into local vars
-   std::complex<float> *x = X;
-   std::complex<float> *y = Y;
+   std::complex<float> *x;
+   float *corr;
    int proc_block_size;
    int in_sig_block_size;
    int ref_sig_block_size;
    int full_corr_size = Full_Corr_Size;
-   int size_of_fcomplex = Size_Of_FComplex;
-   int ns_exp = int(Ns_Exp);
    int smoothing_sidelobe_len = Smoothing_Sidelobe_Len;
    double samp_intvl = Samp_Intvl;
    double phase_to_time;
@@ -182,7 +140,7 @@ int CoarseDelayEstimator::Execute()
    double phase_sum;
    double phase_avg;
    double idx_sum, idx_avg;
-   std::complex<float> x_of_f[4096];
+   double max_lag;
    bool phase_has_wrapped;
     float amp;
 
@@ -219,41 +177,13 @@ int CoarseDelayEstimator::Execute()
    
 
    //----------------------------------------
-   zero_size = full_corr_size - proc_block_size;
    phase_to_time = full_corr_size * samp_intvl/TWO_PI;
-   int i;
-   for( i=0; i<proc_block_size; i++){
-      x[i] = std::complex<float>( *in_sig_buf_ptr++, 0.0 );
-   }
-   In_Sig_Buf->Release(proc_block_size);
 
-   for( i=proc_block_size; i<full_corr_size; i++){
-      x[i] = 0.0;
-   }
-
-   if(Invert_Input_Sig_Enab){
-      for( i=0; i<proc_block_size; i++){
-         x[i] = -x[i];
-      }
-   }
-
-   for( i=0; i<proc_block_size; i++){
-      y[i] = std::complex<float>( *ref_sig_buf_ptr++, 0.0 );
-   }
+   Corr_Engine->Correlate(in_sig_buf_ptr, ref_sig_buf_ptr);
+   In_Sig_Buf->Release(proc_block_size);
    Ref_Sig_Buf->Release(proc_block_size);
+   x = Corr_Engine->GetCrossSpectrum();
 
-   for( i=proc_block_size; i<full_corr_size; i++){
-      y[i] = 0.0;
-   }
-
-   FftDitNipo<float>(x, full_corr_size);
-   FftDitNipo<float>(y, full_corr_size);
-
-   // perform correlation
-   for(samp=0; samp < full_corr_size; samp++){
-      //x[samp] /= float(full_corr_size);
-      x[samp] *= std::conj<float>( y[samp] ) / float(full_corr_size);
-   }
    //----------------------------------------------------------
    if( (PassNumber >= 2) &&
        (Corr_Pass_Count <= Num_Corr_Passes) ){
@@ -308,47 +238,20 @@ int CoarseDelayEstimator::Execute()
    }
    //----------------------------------------------------
 
-   IfftDitPino<float>(x, full_corr_size);
-
    // fill the output buffer
-   //memcpy( out_sig_ptr, x, proc_block_size*size_of_fcomplex);
+   corr = Corr_Engine->GetCorrelation();
    for(int ii=0; ii<proc_block_size; ii++){
-      out_sig_ptr[ii] = x[ii].real();
+      out_sig_ptr[ii] = corr[ii];
    }
 
    // Determine maximum correlation plus corresponding time
-   out_mag = 0.0;
-   for(samp=Neg_Window_Beg; samp <= Neg_Window_End; samp++){
-      x_temp = x[samp].real();
-      (*DebugFile) << samp << ", " << x_temp << endl;
-      if( x_temp > out_mag)
-      {
-         out_mag = x_temp;
-         max_corr = x[samp].real();
-         max_samp = samp;
-      }
-   }
-   for(samp=Pos_Window_Beg; samp <= Pos_Window_End; samp++)
-   {
-      x_temp = x[samp].real();
-      (*DebugFile) << samp << ", " << x_temp << endl;
-      if( x_temp > out_mag)
-      {
-         out_mag = x_temp;
-         max_corr = x[samp].real();
-         max_samp = samp;
-      }
-   }
-   (*DebugFile) << "max_samp = " << max_samp << endl;
-   if( max_samp > proc_block_size ) max_samp -= full_corr_size;
-   max_corr_time = max_samp*samp_intvl;
-//  if( (fabs(max_corr) < 1.0e-30) )
-//      {
-//      max_corr = 1.0;
-//      }
+   max_samp = Corr_Engine->FindPeak(Min_Search_Lag, Max_Search_Lag);
+   max_lag = Corr_Engine->InterpolatePeak(max_samp, Peak_Interp_Mode);
+   max_corr_time = float(max_lag*samp_intvl);
    Delay_At_Max_Corr->SetValue(max_corr_time);
 
    #ifdef _DEBUG
+      (*DebugFile) << "max_samp = " << max_samp << endl;
       (*DebugFile) << "Correlator found delay as " << max_corr_time << endl;
    #endif
 
@@ -418,6 +418,6 @@ int ContinuousAdvance<T>::Execute()
   Write_Ptr = write_ptr;
   return(_MES_AOK);
 }
-template ContinuousAdvance< int >;
-template ContinuousAdvance< float >;
-template ContinuousAdvance< std::complex<float> >;
\ No newline at end of file
+template class ContinuousAdvance< int >;
+template class ContinuousAdvance< float >;
+template class ContinuousAdvance< std::complex<float> >;
\ No newline at end of file
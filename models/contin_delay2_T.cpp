@@ -511,5 +511,5 @@ int ContinuousDelay2<T>::Execute()
   return(_MES_AOK);
 }
 //template ContinuousDelay2< int >;
-template ContinuousDelay2< float >;
+template class ContinuousDelay2< float >;
 //template ContinuousDelay2< std::complex<float> >;
\ No newline at end of file
@@ -166,6 +166,10 @@ void ContinuousDelay< T >::Constructor_Common_Tasks( char* instance_name,
   MAKE_INPUT( In_Sig );
   EnclaveNumber++; // must come after MAKE_INPUT and before MAKE_OUTPUT
   MAKE_OUTPUT( Out_Sig );
+
+  // Execute() reads the input in place whenever the
+  // delay is zero
+  DECLARE_BLOCK_ALIAS( In_Sig, Out_Sig );
 };
 //================================================
 template< class T >
@@ -286,11 +290,7 @@ int ContinuousDelay<T>::Execute()
     //- - - - - - - - - - - - - - - - - - - - - - 
     case DELAY_MODE_NONE:
       {
-      for(is=0; is<Block_Size; is++)
-        {
-        input_samp = *input_signal_ptr++;
-        *output_signal_ptr++ =input_samp;
-        }
+      Out_Sig->AliasBlock(In_Sig);
       return(_MES_AOK);
       }
     //- - - - - - - - - - - - - - - - - - - - - - 
@@ -342,15 +342,11 @@ int ContinuousDelay<T>::Execute()
   sinc_val = Sinc_Val;
 
   //-----------------------------------------------------
-  // if active delay is zero, just copy input to output
+  // if active delay is zero, output is just the input
 
   if(Active_Delay == 0)
     {
-    for(is=0; is<block_size; is++)
-      {
-      input_samp = *input_signal_ptr++;
-      *output_signal_ptr++ =input_samp;
-      }
+    Out_Sig->AliasBlock(In_Sig);
     return(_MES_AOK);
     }
 
@@ -481,6 +477,6 @@ int ContinuousDelay<T>::Execute()
   Write_Ptr = write_ptr;
   return(Return_Status);
 }
-template ContinuousDelay< int >;
-template ContinuousDelay< float >;
-template ContinuousDelay< std::complex<float> >;
\ No newline at end of file
+template class ContinuousDelay< int >;
+template class ContinuousDelay< float >;
+template class ContinuousDelay< std::complex<float> >;
\ No newline at end of file
@@ -102,7 +102,7 @@ int ContinuousDelayTester<T>::Execute()
   return(_MES_AOK);
 
 }
-template ContinuousDelayTester< int >;
-template ContinuousDelayTester< float >;
-template ContinuousDelayTester< std::complex<float> >;
+template class ContinuousDelayTester< int >;
+template class ContinuousDelayTester< float >;
+template class ContinuousDelayTester< std::complex<float> >;
 
@@ -0,0 +1,89 @@
+//
+//  File = conv_encoder.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "conv_encoder.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+using namespace std;
+
+//======================================================
+
+ConvEncoder::ConvEncoder( char* instance_name,
+                          PracSimModel* outer_model,
+                          Signal<bit_t>* in_signal,
+                          Signal<bit_t>* out_signal )
+            :PracSimModel(instance_name,
+                          outer_model)
+{
+  MODEL_NAME(ConvEncoder);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Constr_Len);
+  GET_INT_PARM(Num_Outputs);
+  if(Num_Outputs < 2 || Num_Outputs > VIT_MAX_OUTPUTS)
+    {
+    ostrstream temp_stream;
+    temp_stream << "ConvEncoder Num_Outputs must be 2 thru "
+                << VIT_MAX_OUTPUTS << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Gen_Polys = new int[Num_Outputs];
+  GET_INT_PARM_ARRAY(Gen_Polys, Num_Outputs);
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, Num_Outputs);
+
+  for(int k=0; k<Num_Outputs; k++)
+    {
+    Enc_Table[k] = new BitEncodingTable(Constr_Len, Gen_Polys[k]);
+    }
+}
+//======================================================
+ConvEncoder::~ConvEncoder( void )
+{
+  for(int k=0; k<Num_Outputs; k++) delete Enc_Table[k];
+  delete[] Gen_Polys;
+};
+
+//======================================================
+void ConvEncoder::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  Enc_State = 0;
+};
+
+//======================================================
+int ConvEncoder::Execute()
+{
+  bit_t *bits_in, *bits_out;
+  int is, k, reg;
+
+  bits_in = GET_INPUT_PTR( In_Sig );
+  bits_out = GET_OUTPUT_PTR( Out_Sig );
+
+  for(is=0; is<Block_Size; is++)
+    {
+    reg = (int(bits_in[is] & 1) << (Constr_Len-1)) | Enc_State;
+    for(k=0; k<Num_Outputs; k++)
+      {
+      *bits_out++ = Enc_Table[k]->GetOutput(reg) & 1;
+      }
+    Enc_State = reg >> 1;
+    }
+  Out_Sig->SetValidBlockSize(Block_Size*Num_Outputs);
+  return(_MES_AOK);
+}
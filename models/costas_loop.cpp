@@ -9,6 +9,7 @@
 #include "model_error.h"
 #include "costas_loop.h"
 #include "butt_filt_iir.h"
+#include "k_pll_engine.h"
 #include "model_graph.h"
 //#include "sinc.h"
 extern ParmFile *ParmInput;
@@ -82,11 +83,20 @@ CostasLoop::CostasLoop( char* instance_name,
 }
 
 //======================================
-CostasLoop::~CostasLoop( void ){ };
+CostasLoop::~CostasLoop( void )
+{
+   delete I_Filter;
+   delete Q_Filter;
+   delete Prod_Filter;
+   delete Osc;
+   delete Divided_Osc;
+};
 
 //=======================================
 void CostasLoop::Initialize(void)
 {
+   static const LoopFnPtr loop_table[LOOP_DIAG_NUM_MASKS] = 
+                              LOOP_DIAG_TABLE(CostasLoop);
    //------------------
    int block_size = fsig_Output->GetBlockSize();
    Samp_Intvl = fsig_Input->GetSampIntvl();
@@ -96,12 +106,55 @@ void CostasLoop::Initialize(void)
    Osc_Output_Prev_Val = 0.0;
    I_OscOutput = 0;
    Q_OscOutput = 0;
-   Phi_Sub_2 = 0;
-   Phi_Divided = 0;
 
+   //------------------------------------------------------
+   //  The per-sample work is done by inlined copies of the
+   //  loop filters and by NCOs in place of sin/cos calls
+
+   I_Filter = new k_StateSpaceLoopFilter(I_Filter_Core);
+   Q_Filter = new k_StateSpaceLoopFilter(Q_Filter_Core);
+   Prod_Filter = new k_StateSpaceLoopFilter(Prod_Filter_Core);
+   Osc = new k_Nco;
+   Divided_Osc = new k_Nco;
+
+   //------------------------------------------------------
+   //  Select the version of the sample loop that produces
+   //  only the diagnostic outputs that are actually used
+
+   Diag_Mask = 
+      LOOP_DIAG_IF_USED(fsig_Phase_Error, LOOP_DIAG_PHASE_ERROR)
+    | LOOP_DIAG_IF_USED(fsig_Filtered_Error, LOOP_DIAG_FILT_ERROR)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Output, LOOP_DIAG_OSC_OUTPUT)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Freq, LOOP_DIAG_OSC_FREQ)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Phase, LOOP_DIAG_OSC_PHASE);
+   Run_Loop = loop_table[Diag_Mask];
 }
 //=======================================================
 int CostasLoop::Execute()
+{
+   double err_sum=0;
+   double err_avg;
+   int block_size;
+
+   block_size = fsig_Input->GetValidBlockSize();
+
+   fsig_Output->SetValidBlockSize(block_size);
+   fsig_Phase_Error->SetValidBlockSize(block_size);
+   fsig_Filtered_Error->SetValidBlockSize(block_size);
+   fsig_Osc_Output->SetValidBlockSize(block_size);
+   fsig_Osc_Freq->SetValidBlockSize(block_size);
+   fsig_Osc_Phase->SetValidBlockSize(block_size);
+
+   (this->*Run_Loop)(block_size);
+
+   err_avg = err_sum / block_size;
+   BasicResults << "avg PLL error = " << err_avg << endl;
+
+  return(_MES_AOK);
+}
+//=======================================================
+template <int Diag_Mask>
+void CostasLoop::RunLoop(int block_size)
 {
    // pointers for signal data
 
@@ -124,53 +177,49 @@ int CostasLoop::Execute()
    double filt_val;
    double i_arm_product;
    double q_arm_product;
-   double err_sum=0;
-   double err_avg;
+   double i_osc_output;
+   double q_osc_output;
    int is;
-   int block_size;
-
 
    //--------------------------------------------------------------
    // set up pointers to data buffers for input and output signals
 
    fsOutput_ptr = GET_OUTPUT_PTR( fsig_Output );
-   fsPhaseError_ptr = GET_OUTPUT_PTR( fsig_Phase_Error );
-   fs_filtered_error_ptr = GET_OUTPUT_PTR( fsig_Filtered_Error );
-
-   fsOscOutput_ptr = GET_OUTPUT_PTR( fsig_Osc_Output );
-   fsOscFreq_ptr = GET_OUTPUT_PTR( fsig_Osc_Freq );
-   fsOscPhase_ptr = GET_OUTPUT_PTR( fsig_Osc_Phase );
+   if(Diag_Mask & LOOP_DIAG_PHASE_ERROR)
+      fsPhaseError_ptr = GET_OUTPUT_PTR( fsig_Phase_Error );
+   if(Diag_Mask & LOOP_DIAG_FILT_ERROR)
+      fs_filtered_error_ptr = GET_OUTPUT_PTR( fsig_Filtered_Error );
+   if(Diag_Mask & LOOP_DIAG_OSC_OUTPUT)
+      fsOscOutput_ptr = GET_OUTPUT_PTR( fsig_Osc_Output );
+   if(Diag_Mask & LOOP_DIAG_OSC_FREQ)
+      fsOscFreq_ptr = GET_OUTPUT_PTR( fsig_Osc_Freq );
+   if(Diag_Mask & LOOP_DIAG_OSC_PHASE)
+      fsOscPhase_ptr = GET_OUTPUT_PTR( fsig_Osc_Phase );
    fsInput_ptr = GET_INPUT_PTR( fsig_Input );
    //---------------------------------------------------------------
 
    samp_intvl = Samp_Intvl;
    osc_output_val = Osc_Output_Prev_Val;
-
-   block_size = fsig_Input->GetValidBlockSize();
-
-   fsig_Output->SetValidBlockSize(block_size);
-   fsig_Phase_Error->SetValidBlockSize(block_size);
-   fsig_Filtered_Error->SetValidBlockSize(block_size);
-   fsig_Osc_Output->SetValidBlockSize(block_size);
-   fsig_Osc_Freq->SetValidBlockSize(block_size);
-   fsig_Osc_Phase->SetValidBlockSize(block_size);
-
-   //-------------------------------------------------------
+   i_osc_output = I_OscOutput;
+   q_osc_output = Q_OscOutput;
 
    for (is=0; is<block_size; is++)
    {
-      *fsOscOutput_ptr++ = osc_output_val;
+      if(Diag_Mask & LOOP_DIAG_OSC_OUTPUT)
+         *fsOscOutput_ptr++ = osc_output_val;
       input_val = *fsInput_ptr;
-      i_arm_product = K_Sub_D * input_val * I_OscOutput;
-      q_arm_product = K_Sub_D * input_val * Q_OscOutput;
-      *fsPhaseError_ptr++ = i_arm_product;
+      i_arm_product = K_Sub_D * input_val * i_osc_output;
+      q_arm_product = K_Sub_D * input_val * q_osc_output;
+      if(Diag_Mask & LOOP_DIAG_PHASE_ERROR)
+         *fsPhaseError_ptr++ = i_arm_product;
 
       //--------------------------------
       //  filter the arm signals
 
-      i_filt_val = I_Filter_Core->ProcessSample(i_arm_product);
-      *fs_filtered_error_ptr++ = i_filt_val;
-      q_filt_val = Q_Filter_Core->ProcessSample(q_arm_product);
+      i_filt_val = I_Filter->ProcessSample(i_arm_product);
+      if(Diag_Mask & LOOP_DIAG_FILT_ERROR)
+         *fs_filtered_error_ptr++ = i_filt_val;
+      q_filt_val = Q_Filter->ProcessSample(q_arm_product);
 
       //----------------------------------------
       //  multiply arm signals
@@ -180,31 +229,28 @@ int CostasLoop::Execute()
       //----------------------------------------
       //  filter the result
 
-      filt_val = Prod_Filter_Core->ProcessSample(error_val);
+      filt_val = Prod_Filter->ProcessSample(error_val);
 
       //----------------------------------------
       // use filtered error signal to drive VCO
 
       inst_freq = Omega_Sub_0 + K_Sub_0 * filt_val;
-      Phi_Sub_2 += inst_freq * samp_intvl;
-      if(Phi_Sub_2 > PI) Phi_Sub_2 -= TWO_PI;
+      Osc->Advance(inst_freq * samp_intvl);
 
-      I_OscOutput = -sin(Phi_Sub_2);
-      Q_OscOutput = -cos(Phi_Sub_2);
+      i_osc_output = -Osc->Sin();
+      q_osc_output = -Osc->Cos();
 
-      *fsOscPhase_ptr++ = Phi_Sub_2;
-      *fsOscFreq_ptr++ = inst_freq/TWO_PI;
+      if(Diag_Mask & LOOP_DIAG_OSC_PHASE)
+         *fsOscPhase_ptr++ = Osc->GetPhase();
+      if(Diag_Mask & LOOP_DIAG_OSC_FREQ)
+         *fsOscFreq_ptr++ = inst_freq/TWO_PI;
 
-      Phi_Divided += inst_freq * samp_intvl/Scaler_Divisor;
-      if(Phi_Divided > PI) Phi_Divided -= TWO_PI;
-      *fsOutput_ptr++ = sin(Phi_Divided);
+      Divided_Osc->Advance(inst_freq * samp_intvl/Scaler_Divisor);
+      *fsOutput_ptr++ = Divided_Osc->Sin();
 
       fsInput_ptr++;
    }
-   err_avg = err_sum / block_size;
-   BasicResults << "avg PLL error = " << err_avg << endl;
+   I_OscOutput = i_osc_output;
+   Q_OscOutput = q_osc_output;
    Osc_Output_Prev_Val = osc_output_val;
-
-  return(_MES_AOK);
 }
-
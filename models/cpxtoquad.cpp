@@ -9,6 +9,7 @@
 #include "misdefs.h"
 #include "model_graph.h"
 #include "sigplot.h"
+#include "cmpx_kernels.h"
 extern ParmFile ParmInput;
 extern SignalPlotter SigPlot;
 extern int PassNumber;
@@ -46,7 +47,6 @@ int CmpxToQuadrature::Execute()
   std::complex<float> *in_sig;
   float *i_out_sig;
   float *q_out_sig;
-  int is;
   int block_size;
 
   i_out_sig = GET_OUTPUT_PTR(I_Out_Sig);
@@ -56,12 +56,7 @@ int CmpxToQuadrature::Execute()
   I_Out_Sig->SetValidBlockSize(block_size);
   Q_Out_Sig->SetValidBlockSize(block_size);
 
-  for (is=0; is<block_size; is++)
-    {
-    *i_out_sig++ = in_sig->real();
-    *q_out_sig++ = in_sig->imag();
-    in_sig++;
-    }
+  CmpxDeinterleave( in_sig, i_out_sig, q_out_sig, block_size );
   return(_MES_AOK);
 }
 
@@ -0,0 +1,104 @@
+//
+//  File = crc_checker.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "crc_checker.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+extern int PassNumber;
+using namespace std;
+
+//======================================================
+
+CrcChecker::CrcChecker( char* instance_name,
+                        PracSimModel* outer_model,
+                        Signal<bit_t>* in_signal,
+                        Signal<bit_t>* out_signal )
+           :PracSimModel(instance_name,
+                         outer_model)
+{
+  MODEL_NAME(CrcChecker);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Frame_Len);
+  GET_INT_PARM(Crc_Len);
+  GET_HEX_PARM(Crc_Poly);
+  GET_BOOL_PARM(Invert_Crc);
+  GET_INT_PARM(Num_Holdoff_Passes);
+  GET_INT_PARM(Report_Intvl_In_Blocks);
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, double(Frame_Len)/double(Frame_Len + Crc_Len));
+  SET_BLOCK_GRANULARITY(In_Sig, (Frame_Len + Crc_Len));
+
+  Crc_Engine = new CrcEngine(Crc_Len, Crc_Poly, Invert_Crc);
+}
+//======================================================
+CrcChecker::~CrcChecker( void )
+{
+  delete Crc_Engine;
+};
+
+//======================================================
+void CrcChecker::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  if(Block_Size % (Frame_Len + Crc_Len))
+    {
+    ostrstream temp_stream;
+    temp_stream << "CrcChecker input block size " << Block_Size
+                << " is not a multiple of Frame_Len + Crc_Len" << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Num_Frames = Block_Size/(Frame_Len + Crc_Len);
+  Frame_Count = 0;
+  Frame_Error_Count = 0;
+};
+
+//======================================================
+int CrcChecker::Execute()
+{
+  bit_t *bits_in, *bits_out;
+  int iframe, is, num_bad;
+
+  bits_in = GET_INPUT_PTR( In_Sig );
+  bits_out = GET_OUTPUT_PTR( Out_Sig );
+
+  num_bad = 0;
+  for(iframe=0; iframe<Num_Frames; iframe++)
+    {
+    if(!Crc_Engine->Check(bits_in, Frame_Len)) num_bad++;
+    for(is=0; is<Frame_Len; is++) bits_out[is] = bits_in[is] & 1;
+    bits_in += Frame_Len + Crc_Len;
+    bits_out += Frame_Len;
+    }
+  Out_Sig->SetValidBlockSize(Num_Frames*Frame_Len);
+
+  if(PassNumber <= Num_Holdoff_Passes ) return(_MES_AOK);
+
+  Frame_Count += Num_Frames;
+  Frame_Error_Count += num_bad;
+
+  if( ((PassNumber - Num_Holdoff_Passes) % Report_Intvl_In_Blocks) == 0)
+    {
+    BasicResults << GetInstanceName() << ": " << PassNumber << "  FER = "
+                 << (Frame_Count > 0 ?
+                     double(Frame_Error_Count)/double(Frame_Count) : 0.0)
+                 << " -- " << double(Frame_Error_Count) << " frame errors in "
+                 << double(Frame_Count) << " frames" << endl;
+    }
+  return(_MES_AOK);
+}
@@ -0,0 +1,84 @@
+//
+//  File = crc_gen.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "crc_gen.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+using namespace std;
+
+//======================================================
+
+CrcGenerator::CrcGenerator( char* instance_name,
+                            PracSimModel* outer_model,
+                            Signal<bit_t>* in_signal,
+                            Signal<bit_t>* out_signal )
+             :PracSimModel(instance_name,
+                           outer_model)
+{
+  MODEL_NAME(CrcGenerator);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Frame_Len);
+  GET_INT_PARM(Crc_Len);
+  GET_HEX_PARM(Crc_Poly);
+  GET_BOOL_PARM(Invert_Crc);
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, double(Frame_Len + Crc_Len)/double(Frame_Len));
+  SET_BLOCK_GRANULARITY(In_Sig, Frame_Len);
+
+  Crc_Engine = new CrcEngine(Crc_Len, Crc_Poly, Invert_Crc);
+}
+//======================================================
+CrcGenerator::~CrcGenerator( void )
+{
+  delete Crc_Engine;
+};
+
+//======================================================
+void CrcGenerator::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  if(Block_Size % Frame_Len)
+    {
+    ostrstream temp_stream;
+    temp_stream << "CrcGenerator input block size " << Block_Size
+                << " is not a multiple of Frame_Len" << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Num_Frames = Block_Size/Frame_Len;
+};
+
+//======================================================
+int CrcGenerator::Execute()
+{
+  bit_t *bits_in, *bits_out;
+  int iframe, is;
+
+  bits_in = GET_INPUT_PTR( In_Sig );
+  bits_out = GET_OUTPUT_PTR( Out_Sig );
+
+  for(iframe=0; iframe<Num_Frames; iframe++)
+    {
+    for(is=0; is<Frame_Len; is++) bits_out[is] = bits_in[is] & 1;
+    Crc_Engine->Append(bits_out, Frame_Len);
+    bits_in += Frame_Len;
+    bits_out += Frame_Len + Crc_Len;
+    }
+  Out_Sig->SetValidBlockSize(Num_Frames*(Frame_Len + Crc_Len));
+  return(_MES_AOK);
+}
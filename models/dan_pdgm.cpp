@@ -9,6 +9,7 @@
 #include "dan_pdgm.h"
 #include "fft_T.h"
 #include "dump_spect.h"
+#include "spect_result.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -16,6 +17,7 @@
 
 extern ParmFile *ParmInput;
 extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
 
 //======================================================
 
@@ -137,6 +139,12 @@ int DaniellPeriodogram<T>::Execute()
       // is it time to dump the results?
 //      if(Segs_In_Est == Num_Segs_To_Avg)
 //      {
+         SpectRegistry.Publish(  GetInstanceName(),
+                                 Dan_Pdgm,
+                                 Fft_Len/2,
+                                 Delta_F,
+                                 2*Big_P+1,
+                                 1.0);
          DumpSpectrum(  Dan_Pdgm,
                         Fft_Len,
                         Delta_F,
@@ -170,4 +178,4 @@ int DaniellPeriodogram<T>::Execute()
    return(_MES_AOK);
 
 }
-template DaniellPeriodogram<float>;
+template class DaniellPeriodogram<float>;
@@ -204,4 +204,4 @@ int DftDelay< T >::Execute()
    //---------------------
    return(_MES_AOK);
 }
-template DftDelay< float >;
+template class DftDelay< float >;
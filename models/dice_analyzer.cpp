@@ -30,83 +30,45 @@ DiceAnalyzer::DiceAnalyzer( char* instance_name,
   GET_INT_PARM(Report_Intvl_In_Blocks);
   GET_INT_PARM(Faces_Per_Die);
 
-  MAKE_INPUT(In_Sig);
+  // statistics are kept for 1-grams thru Ngram_Order-grams;
+  // with Continuous_Run the n-grams span block boundaries
+  GET_INT_PARM_OPT(Ngram_Order, 2);
+  GET_BOOL_PARM_OPT(Continuous_Run, false);
+  GET_INT_PARM_OPT(Num_Threads, 1);
 
-  Symb_Count = new int[Faces_Per_Die];
-  Double_Count = new int[Faces_Per_Die*Faces_Per_Die];
+  MAKE_INPUT(In_Sig);
 
+  // faces are numbered 1 thru Faces_Per_Die
+  Stats = new NgramStats( Faces_Per_Die, 1,
+                          Ngram_Order,
+                          Continuous_Run,
+                          Num_Threads );
 }
 //======================================================
-DiceAnalyzer::~DiceAnalyzer( void ){ };
+DiceAnalyzer::~DiceAnalyzer( void )
+{
+  delete Stats;
+};
 
 //======================================================
 void DiceAnalyzer::Initialize(void)
 {
-   int i;
    Block_Size = In_Sig->GetBlockSize();
-
-   for(i=0; i<Faces_Per_Die; i++)
-      Symb_Count[i] = 0;
-   for(i=0; i<Faces_Per_Die*Faces_Per_Die; i++)
-      Double_Count[i] = 0;
+   Stats->Reset();
 };
 
 //======================================================
 int DiceAnalyzer::Execute()
 {
-   byte_t *in_byte_ptr, in_byte;
-   byte_t old_byte;
-   int is, i,j;
+   byte_t *in_byte_ptr;
 
    in_byte_ptr = GET_INPUT_PTR( In_Sig );
+   Stats->Tally(in_byte_ptr, Block_Size);
 
-   for( is=0; is < Block_Size; is++)
-   {
-      in_byte = *in_byte_ptr++;
-      Symb_Count[in_byte-1]++;
-      if(is%2)
-      {
-         Double_Count[old_byte*Faces_Per_Die + in_byte-1]++;
-      }
-      else
-      {
-         old_byte = in_byte-1;
-      }
-     
-
-   }
    if( (PassNumber % Report_Intvl_In_Blocks) == 0)
    {
-      float total_count = float(Symb_Count[0]);
-      for( i=1; i<Faces_Per_Die; i++)
-         total_count += Symb_Count[i];
-
-      BasicResults << Instance_Name << ": "
-              << PassNumber << "  symbol %'s: "
-              << (Symb_Count[0]/total_count);
-
-      for( i=1; i<Faces_Per_Die; i++)
-      {
-         BasicResults << ", " << (Symb_Count[i]/total_count);
-      }
-      BasicResults << "\n" << endl;
-
-      total_count = float(Double_Count[0]);
-      for( i=1; i<Faces_Per_Die*Faces_Per_Die; i++)
-         total_count += Double_Count[i];
-
-
-      for( i=0; i<Faces_Per_Die; i++)
-      {
-         BasicResults << (Double_Count[i*Faces_Per_Die]/total_count);
-         for( j=1; j<Faces_Per_Die; j++)
-         {
-            BasicResults << ", " << (Double_Count[i*Faces_Per_Die+j]/total_count);
-         }
-         BasicResults << "\n" << endl;
-      }
+      Stats->Report(Instance_Name, PassNumber);
    }
 
    return(_MES_AOK);
 }
-
@@ -7,6 +7,7 @@
 #include "model_error.h"
 #include "digital_pll.h"
 #include "butt_filt_iir.h"
+#include "k_pll_engine.h"
 #include "model_graph.h"
 extern ParmFile *ParmInput;
 extern PracSimModel *ActiveModel;
@@ -71,11 +72,16 @@ DigitalPLL::DigitalPLL(
 }
 
 //======================================================
-DigitalPLL::~DigitalPLL( void ){ };
+DigitalPLL::~DigitalPLL( void )
+{
+   delete Osc;
+};
 
 //======================================================
 void DigitalPLL::Initialize(void)
 {
+   static const LoopFnPtr loop_table[LOOP_DIAG_NUM_MASKS] = 
+                              LOOP_DIAG_TABLE(DigitalPLL);
    //------------------
    int block_size = fsig_Output->GetBlockSize();
    Samp_Intvl = fsig_Input->GetSampIntvl();
@@ -93,9 +99,40 @@ void DigitalPLL::Initialize(void)
    Time_Of_Samp = 0.0;
    Prev_Osc_Phase = 0.0;
 
+   // table lookup replaces sin() for the output waveform
+   Osc = new k_Nco;
+
+   //------------------------------------------------------
+   //  Select the version of the sample loop that produces
+   //  only the diagnostic outputs that are actually used
+
+   Diag_Mask = 
+      LOOP_DIAG_IF_USED(fsig_Filtered_Error, LOOP_DIAG_FILT_ERROR)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Output, LOOP_DIAG_OSC_OUTPUT)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Freq, LOOP_DIAG_OSC_FREQ)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Phase, LOOP_DIAG_OSC_PHASE);
+   Run_Loop = loop_table[Diag_Mask];
 }
 //======================================================
 int DigitalPLL::Execute()
+{
+   int block_size;
+
+   block_size = fsig_Input->GetValidBlockSize();
+
+   fsig_Output->SetValidBlockSize(block_size);
+   fsig_Filtered_Error->SetValidBlockSize(block_size);
+   fsig_Osc_Output->SetValidBlockSize(block_size);
+   fsig_Osc_Freq->SetValidBlockSize(block_size);
+   fsig_Osc_Phase->SetValidBlockSize(block_size);
+
+   (this->*Run_Loop)(block_size);
+
+  return(_MES_AOK);
+}
+//======================================================
+template <int Diag_Mask>
+void DigitalPLL::RunLoop(int block_size)
 {
    // pointers for signal data
 
@@ -116,7 +153,6 @@ int DigitalPLL::Execute()
    double err_sum=0;
    double err_avg;
    int is;
-   int block_size;
    double time_of_samp;
    double time_zc;
    double delta_T;
@@ -139,12 +175,15 @@ int DigitalPLL::Execute()
    // output signals
 
    fsOutput_ptr = GET_OUTPUT_PTR( fsig_Output );
-   fs_filtered_error_ptr = 
+   if(Diag_Mask & LOOP_DIAG_FILT_ERROR)
+      fs_filtered_error_ptr = 
                GET_OUTPUT_PTR( fsig_Filtered_Error );
-
-   fsOscOutput_ptr = GET_OUTPUT_PTR( fsig_Osc_Output );
-   fsOscFreq_ptr = GET_OUTPUT_PTR( fsig_Osc_Freq );
-   fsOscPhase_ptr = GET_OUTPUT_PTR( fsig_Osc_Phase );
+   if(Diag_Mask & LOOP_DIAG_OSC_OUTPUT)
+      fsOscOutput_ptr = GET_OUTPUT_PTR( fsig_Osc_Output );
+   if(Diag_Mask & LOOP_DIAG_OSC_FREQ)
+      fsOscFreq_ptr = GET_OUTPUT_PTR( fsig_Osc_Freq );
+   if(Diag_Mask & LOOP_DIAG_OSC_PHASE)
+      fsOscPhase_ptr = GET_OUTPUT_PTR( fsig_Osc_Phase );
    fsInput_ptr = GET_INPUT_PTR( fsig_Input );
 
    samp_intvl = Samp_Intvl;
@@ -156,19 +195,12 @@ int DigitalPLL::Execute()
    prev_cap_val = Prev_Cap_Val;
    prev_osc_phase = Prev_Osc_Phase;
 
-   block_size = fsig_Input->GetValidBlockSize();
-
-   fsig_Output->SetValidBlockSize(block_size);
-   fsig_Filtered_Error->SetValidBlockSize(block_size);
-   fsig_Osc_Output->SetValidBlockSize(block_size);
-   fsig_Osc_Freq->SetValidBlockSize(block_size);
-   fsig_Osc_Phase->SetValidBlockSize(block_size);
-
    for (is=0; is<block_size; is++){
       time_of_samp = Time_Of_Samp + (is+1)*samp_intvl;
       //----------------------------------
       //  Look for zero crossing 
-      *fsOscOutput_ptr++ = osc_output_val;
+      if(Diag_Mask & LOOP_DIAG_OSC_OUTPUT)
+         *fsOscOutput_ptr++ = osc_output_val;
       input_val = *fsInput_ptr;
 
       if( (input_val >= 0) != Prev_Input_Positive){
@@ -316,10 +348,13 @@ int DigitalPLL::Execute()
       inst_freq = Omega_Sub_0 + K_Sub_0 * prev_filt_val;
       output_phase = 
                   prev_osc_phase + inst_freq * delta_T;
-      *fsOutput_ptr++ = sin(output_phase);
-      *fs_filtered_error_ptr++ = prev_filt_val;
-      *fsOscPhase_ptr++ = output_phase;
-      *fsOscFreq_ptr++ = inst_freq/TWO_PI;
+      *fsOutput_ptr++ = Osc->SinOfPhase(output_phase);
+      if(Diag_Mask & LOOP_DIAG_FILT_ERROR)
+         *fs_filtered_error_ptr++ = prev_filt_val;
+      if(Diag_Mask & LOOP_DIAG_OSC_PHASE)
+         *fsOscPhase_ptr++ = output_phase;
+      if(Diag_Mask & LOOP_DIAG_OSC_FREQ)
+         *fsOscFreq_ptr++ = inst_freq/TWO_PI;
       fsInput_ptr++;
    }
    Prev_Input_Val = prev_input_val;
@@ -335,7 +370,5 @@ int DigitalPLL::Execute()
    BasicResults << "avg PLL error = " << err_avg 
                 << endl;
    Osc_Output_Prev_Val = osc_output_val;
-
-  return(_MES_AOK);
 }
 
@@ -105,6 +105,6 @@ int DiscreteDelayTester<T>::Execute()
   return(_MES_AOK);
 
 }
-template DiscreteDelayTester< int >;
-template DiscreteDelayTester< float >;
+template class DiscreteDelayTester< int >;
+template class DiscreteDelayTester< float >;
 
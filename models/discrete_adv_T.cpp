@@ -313,6 +313,6 @@ int DiscreteAdvance< T >::Execute()
   Write_Ptr = write_ptr;
   return(Return_Status);
 }
-template DiscreteAdvance< int >;
-template DiscreteAdvance< float >;
+template class DiscreteAdvance< int >;
+template class DiscreteAdvance< float >;
 
@@ -168,6 +168,16 @@ void DiscreteDelay< T >
 
    MAKE_OUTPUT( Out_Sig );
    MAKE_INPUT( In_Sig );
+
+   // Execute() reads the input in place whenever the
+   // delay is zero
+   DECLARE_BLOCK_ALIAS( In_Sig, Out_Sig );
+
+   // with no delay the output is just the input
+   if( (Delay_Mode == DELAY_MODE_NONE) ||
+       (Delay_Mode == DELAY_MODE_FIXED && Initial_Delay_In_Samps == 0) ){
+      DECLARE_PASS_THRU( In_Sig, Out_Sig );
+   }
 };
 //======================================================
 template< class T >
@@ -226,10 +236,7 @@ int DiscreteDelay<T>::Execute()
 
    switch (Delay_Mode){
    case DELAY_MODE_NONE:
-      for(is=0; is<Block_Size; is++){
-         input_samp = *input_signal_ptr++;
-         *output_signal_ptr++ =input_samp;
-      }
+      Out_Sig->AliasBlock(In_Sig);
       return(_MES_AOK);
    case DELAY_MODE_FIXED:
       break;
@@ -265,13 +272,10 @@ int DiscreteDelay<T>::Execute()
    end_of_buffer = End_Of_Buffer;
 
    //---------------------------------------------------
-   // if active delay is zero, just copy input to output
+   // if active delay is zero, output is just the input
 
    if(Active_Delay_In_Samps == 0){
-      for(is=0; is<block_size; is++){
-         input_samp = *input_signal_ptr++;
-         *output_signal_ptr++ =input_samp;
-      }
+      Out_Sig->AliasBlock(In_Sig);
       return(_MES_AOK);
    }
   //---------------------------------------------------
@@ -310,7 +314,7 @@ int DiscreteDelay<T>::Execute()
    Write_Ptr = write_ptr;
    return(_MES_AOK);
 }
-template DiscreteDelay< int >;
-template DiscreteDelay< float >;
-template DiscreteDelay< bit_t >;
+template class DiscreteDelay< int >;
+template class DiscreteDelay< float >;
+template class DiscreteDelay< bit_t >;
 
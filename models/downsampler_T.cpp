@@ -103,7 +103,7 @@ int Downsampler<T>::Execute()
    return(_MES_AOK);
 
 }
-template Downsampler< int >;
-template Downsampler< float >;
-template Downsampler< bit_t >;
+template class Downsampler< int >;
+template class Downsampler< float >;
+template class Downsampler< bit_t >;
 
@@ -59,5 +59,5 @@ EllipticalFilterByIir<T>::EllipticalFilterByIir( char *instance_name,
 }
 template <class T>
 EllipticalFilterByIir<T>::~EllipticalFilterByIir(){};
-template EllipticalFilterByIir<float>;
-template EllipticalFilterByIir<std::complex<float> >;
+template class EllipticalFilterByIir<float>;
+template class EllipticalFilterByIir<std::complex<float> >;
@@ -10,9 +10,6 @@
 #include "misdefs.h"
 #include "model_graph.h"
 #include "sigplot.h"
-#include "dit_pino_T.h"
-#include "dit_nipo_T.h"
-#include "dft_T.h"
 #include "unwrap.h"
 #include "complex_io.h"
 extern ParmFile* ParmInput;
@@ -74,9 +71,7 @@ FineDelayEstimator::~FineDelayEstimator( void ){ };
 
 void FineDelayEstimator::Initialize(void)
 {
-   int dummy_size, i;
-   double tmp_nsexp;
-   double frac_part, int_part;
+   int i;
    float sample=0;
 
    Proc_Block_Size = In_Sig->GetBlockSize();
@@ -85,21 +80,10 @@ void FineDelayEstimator::Initialize(void)
    In_Sig_Buf = new AuxSignalBuffer<float>(sample, Proc_Block_Size);
    Ref_Sig_Buf = new AuxSignalBuffer<float>(sample, Proc_Block_Size);
 
-   tmp_nsexp = log10(double(Proc_Block_Size))/log10(2.0);
-   frac_part = modf(tmp_nsexp, &int_part);
-
-   if( frac_part != 0.0 )
-      {
-      Ns_Exp = int_part + 2;
-      }
-   else
-      {
-      Ns_Exp = int_part + 1;
-      }
-
-   Full_Corr_Size = pow(2.0, Ns_Exp);
-   X = new std::complex<float>[Full_Corr_Size];
-   Y = new std::complex<float>[Full_Corr_Size];
+   // zero padded to at least twice the block size
+   Corr_Engine = new CrossCorrelator<float>(Proc_Block_Size);
+   Corr_Engine->SetInputInversion(Invert_Input_Sig_Enab);
+   Full_Corr_Size = Corr_Engine->GetFftLen();
 
 //   if(Limited_Search_Window_Enab)
 //      {
@@ -133,14 +117,6 @@ void FineDelayEstimator::Initialize(void)
 //      }
 
 
-   dummy_size = Full_Corr_Size - Proc_Block_Size;
-   Zero_Array = new std::complex<float>[dummy_size];
-   for( i = 0; i < dummy_size; i++)
-   {
-      Zero_Array[i] = std::complex<float>(0.0, 0.0);
-   }
-   Size_Of_FComplex = sizeof(std::complex<float>);
-
    Max_Corr = 0.0;
    Max_Corr_Time = 0.0;
 
@@ -165,7 +141,6 @@ int FineDelayEstimator::Execute()
 //   float max_corr;
 //   float out_mag, x_temp; // out_angle;
 //   float max_corr_time;
-   int zero_size;
    int samp;
    double deg_per_rad = 180.0/PI;
    double phase_deg;
@@ -175,14 +150,11 @@ int FineDelayEstimator::Execute()
 
    //-------------------------------------------------------
    //  Copy frequently accessed member vars into local vars
-   std::complex<float> *x = X;
-   std::complex<float> *y = Y;
+   std::complex<float> *x;
    int proc_block_size;
    int in_sig_block_size;
    int ref_sig_block_size;
    int full_corr_size = Full_Corr_Size;
-   int size_of_fcomplex = Size_Of_FComplex;
-   int ns_exp = int(Ns_Exp);
 //   int smoothing_sidelobe_len = Smoothing_Sidelobe_Len;
    double samp_intvl = Samp_Intvl;
    double phase_to_time;
@@ -194,7 +166,6 @@ int FineDelayEstimator::Execute()
    double phase_sum;
    double phase_avg;
    double idx_sum, idx_avg;
-   std::complex<float> x_of_f[4096];
    bool phase_has_wrapped;
     float amp;
 
@@ -230,81 +201,13 @@ int FineDelayEstimator::Execute()
    
 
    //----------------------------------------
-   zero_size = full_corr_size - proc_block_size;
    phase_to_time = full_corr_size * samp_intvl/TWO_PI;
-   //phase_to_time = full_corr_size * samp_intvl;
 
-  // set up arrays for FFT's
-  // zero-pad from Proc_Block_Size to Full_Corr_Size
-   int i;
-//  memcpy( x, in_sig_ptr, proc_block_size*size_of_fcomplex);
-   for( i=0; i<proc_block_size; i++)
-   {
-      x[i] = std::complex<float>( *in_sig_buf_ptr++, 0.0 );
-   }
+   // only the cross spectrum is needed for the phase slope
+   Corr_Engine->CrossSpectrum(in_sig_buf_ptr, ref_sig_buf_ptr);
    In_Sig_Buf->Release(proc_block_size);
-
-   for( i=proc_block_size; i<full_corr_size; i++)
-   {
-      x[i] = 0.0;
-   }
-
-   if(Invert_Input_Sig_Enab)
-   {
-      for( i=0; i<proc_block_size; i++)
-      {
-         x[i] = -x[i];
-      }
-   }
-
-//  memcpy( y, ref_sig_ptr, proc_block_size*size_of_fcomplex);
-   for( i=0; i<proc_block_size; i++)
-   {
-      y[i] = std::complex<float>( *ref_sig_buf_ptr++, 0.0 );
-   }
    Ref_Sig_Buf->Release(proc_block_size);
-
-   for( i=proc_block_size; i<full_corr_size; i++)
-   {
-      y[i] = 0.0;
-   }
-
-   //memset( &x[proc_block_size], 0,
-   //         zero_size*sizeof(std::complex<float>));
-   //memcpy( &x[proc_block_size], Zero_Array,
-   //         zero_size*size_of_fcomplex);
-   //memcpy( &y[proc_block_size], Zero_Array,
-   //         zero_size*size_of_fcomplex);
-
-   // perform FFT's
-   //FFT(x, ns_exp, full_corr_size, ns_exp);
-   //FFT(y, ns_exp, full_corr_size, ns_exp);
-//   dft( x, x_of_f, full_corr_size);
-
-   FftDitNipo<float>(x, full_corr_size);
-   FftDitNipo<float>(y, full_corr_size);
-
-//   if(PassNumber == Num_Corr_Passes)
-//   {
-//      ofstream  *special_file = new ofstream("special.txt\0", ios::out);
-//     for(samp=0; samp < full_corr_size; samp++)
-//     {
-//        *special_file << samp << ", " << x[samp] << ", " << x_of_f[samp] << endl;
-        //x[samp] /= float(full_corr_size);
-        //x[samp] *= std::conj<float>( y[samp] ) / float(full_corr_size);
-//     }
-//     special_file->close();
-//   }
-
-
-
-   // perform correlation
-   for(samp=0; samp < full_corr_size; samp++)
-   {
-      //x[samp] /= float(full_corr_size);
-      x[samp] *= std::conj<float>( y[samp] ) / float(full_corr_size);
-   }
-
+   x = Corr_Engine->GetCrossSpectrum();
 
    //----------------------------------------------------------
    if( (PassNumber >= 2)
@@ -37,116 +37,78 @@ HistogramBuilder<T>
    GET_DOUBLE_PARM(Bin_Width);
    GET_BOOL_PARM(Positive_Only);
    GET_BOOL_PARM(Halt_When_Completed);
+   GET_BOOL_PARM_OPT(Higher_Moments_Enab, false);
+   if(Num_Segs_To_Tally <= 0){
+      GET_INT_PARM(Report_Intvl_In_Blocks);
+   }
 
+   // bins are centered on multiples of Bin_Width unless
+   // only positive values are expected
    if(!Positive_Only){
       if(Num_Bins%2 == 0) Num_Bins++;
       Ctr_Bin = (Num_Bins-1)/2;
+      Left_Edge = -(Ctr_Bin + 0.5)*Bin_Width;
    }
    else{
       Ctr_Bin = 0;
+      Left_Edge = 0.0;
    }
 
    In_Sig = in_sig;
    MAKE_INPUT(In_Sig);
 
-
    Hist_Bins = new double[Num_Bins];
-   for(int is=0; is<Num_Bins; is++){
-      Hist_Bins[is] = 0.0;
-   }
+   Stats = new StatsAccumulator( Num_Bins,
+                                 Left_Edge,
+                                 Bin_Width,
+                                 Higher_Moments_Enab );
 
    Hist_File = new ofstream(Hist_File_Name, ios::out);
    Processing_Completed = false;
 
 }
 template <class T>
-HistogramBuilder<T>::~HistogramBuilder( void ){ };
+HistogramBuilder<T>::~HistogramBuilder( void )
+{
+   // a continuous tally reports whatever it has at exit
+   if(!Processing_Completed && Stats->GetCount() > 0) WriteReport();
+   delete Stats;
+   delete[] Hist_Bins;
+};
 
 template <class T>
 void HistogramBuilder<T>::Initialize(void)
 {
    Segs_In_Tally = 0;
-   Pts_In_Tally = 0;
-   Out_Of_Range_Count = 0;
    Block_Size = In_Sig->GetBlockSize();
-   Sum = 0.0;
-   Sum_Sqrs = 0.0;
-
+   Stats->Reset();
 };
 
 template <class T>
 //======================================================
 int HistogramBuilder<T>::Execute()
 {
-   int is;
-   float left_edge, right_edge, gap_on_left;
 #ifdef _DEBUG
    *DebugFile << "In HistogramBuilder::Execute\0" 
               << endl;
 #endif
 
-
    if(Processing_Completed) return(_MES_AOK);
    if(PassNumber < Hold_Off) return (_MES_AOK);
-   //--------------------------------
-   //  Get pointers for buffers
 
    T *in_sig_ptr = GET_INPUT_PTR(In_Sig);
-   T in_sig_val;
-   int bin_idx;
-   double val;
-   double edge_offset;
-   double mean, variance;
-
-   for(is=0; is<Block_Size; is++){
-      in_sig_val = *in_sig_ptr++;
-      Sum += in_sig_val;
-      Sum_Sqrs += in_sig_val * in_sig_val;
-      bin_idx = int(Ctr_Bin + in_sig_val/Bin_Width);
-      if(bin_idx>=0 && bin_idx<Num_Bins){
-         Hist_Bins[bin_idx]++;
-         Pts_In_Tally++;
-      }
-      else{
-         Out_Of_Range_Count++;
-      }
-   }
-
+   Stats->Tally(in_sig_ptr, Block_Size);
    Segs_In_Tally++;
 
+   if(Num_Segs_To_Tally <= 0){
+      if( (Segs_In_Tally % Report_Intvl_In_Blocks) == 0 ) WriteReport();
+      return(_MES_AOK);
+   }
+
    // is it time to dump the results?
    if(Segs_In_Tally == Num_Segs_To_Tally){
-      mean = Sum/Pts_In_Tally;
-      variance = (Sum_Sqrs/Pts_In_Tally) - (mean*mean);
-      *DebugFile << "mean = " << mean << endl;
-      *DebugFile << "variance = " << variance << endl;
-
-      if(Positive_Only)
-         edge_offset = 0.0;
-      else
-         edge_offset = 0.5;
-
-      for(is=0; is<Num_Bins; is++){
-         gap_on_left = 
-            float(((is-Ctr_Bin)-edge_offset)*Bin_Width);
-         left_edge = 
-            float(((is-Ctr_Bin)-edge_offset)*Bin_Width);
-         right_edge = float(left_edge + Bin_Width);
-         val = 
-            double(Hist_Bins[is])/double(Pts_In_Tally);
-         (*Hist_File) << gap_on_left << ", " << 0 
-                      << endl;
-         (*Hist_File) << left_edge << ", " << val 
-                      << endl;
-         (*Hist_File) << right_edge << ", " << val 
-                      << endl;
-      }
-      gap_on_left = 
-         float(((Num_Bins-Ctr_Bin)-0.5)*Bin_Width);
-      (*Hist_File) << gap_on_left << ", " << 0 << endl;
-
+      WriteReport();
       Processing_Completed = true;
-      Hist_File->close();
       if(Halt_When_Completed){
 #ifdef _DEBUG
          *DebugFile << "Execution halted by " 
@@ -158,5 +120,54 @@ int HistogramBuilder<T>::Execute()
    return(_MES_AOK);
 }
 //======================================================
+template <class T>
+void HistogramBuilder<T>::WriteReport(void)
+{
+   int is;
+   float left_edge, right_edge, gap_on_left;
+   double val;
+   double pts_in_tally;
+
+   Stats->GetHistogram(Hist_Bins);
+   pts_in_tally = double(Stats->GetInRangeCount());
+   if(pts_in_tally < 1.0) pts_in_tally = 1.0;
+
+   BasicResults << GetInstanceName() << ": "
+                << PassNumber << "  samples = "
+                << double(Stats->GetCount())
+                << "  out of range = "
+                << double(Stats->GetBelowRangeCount()
+                          + Stats->GetAboveRangeCount()) << endl;
+   BasicResults << "   mean = " << Stats->GetMean()
+                << "  variance = " << Stats->GetVariance() << endl;
+   if(Higher_Moments_Enab){
+      BasicResults << "   skewness = " << Stats->GetSkewness()
+                   << "  excess kurtosis = " << Stats->GetKurtosis()
+                   << endl;
+   }
+   BasicResults << "   min = " << Stats->GetMin()
+                << "  median = " << Stats->GetQuantile(0.5)
+                << "  max = " << Stats->GetMax() << endl;
+
+   // file is rewritten with the cumulative histogram
+   if(!Hist_File->is_open()) Hist_File->open(Hist_File_Name, ios::out);
+
+   for(is=0; is<Num_Bins; is++){
+      left_edge = float(Left_Edge + is*Bin_Width);
+      gap_on_left = left_edge;
+      right_edge = float(left_edge + Bin_Width);
+      val = Hist_Bins[is]/pts_in_tally;
+      (*Hist_File) << gap_on_left << ", " << 0 
+                   << endl;
+      (*Hist_File) << left_edge << ", " << val 
+                   << endl;
+      (*Hist_File) << right_edge << ", " << val 
+                   << endl;
+   }
+   gap_on_left = float(Left_Edge + Num_Bins*Bin_Width);
+   (*Hist_File) << gap_on_left << ", " << 0 << endl;
+   Hist_File->close();
+}
+//======================================================
 //template HistogramBuilder<std::complex<float> >;
-template HistogramBuilder<float>;
+template class HistogramBuilder<float>;
@@ -50,7 +50,11 @@ IntegrateDumpAndSlice::IntegrateDumpAndSlice( char* instance_name,
   //SAME_RATE(Corr_Sig, Samp_Wave_Out);
 
 }
-IntegrateDumpAndSlice::~IntegrateDumpAndSlice( void ){ };
+IntegrateDumpAndSlice::~IntegrateDumpAndSlice( void )
+{
+  delete Kernel;
+  delete[] Dump_Val;
+};
 
 void IntegrateDumpAndSlice::Initialize(void)
 {
@@ -59,20 +63,19 @@ void IntegrateDumpAndSlice::Initialize(void)
   In_Samp_Intvl = In_Sig->GetSampIntvl();
   Out_Samp_Intvl = Out_Sig->GetSampIntvl();
 
-  Integ_Val = 0.0;
+  Kernel = new k_IntegrateAndDump<float>(In_Block_Size);
+  Kernel->Initialize();
+  Dump_Val = new float[In_Block_Size];
 };
 
 //============================================
 int IntegrateDumpAndSlice::Execute()
 {
-  float *in_sig_ptr, in_val;
-  //float *corr_sig_ptr, corr_val;
+  float *in_sig_ptr;
   float *samp_wave_out_ptr;
-  bit_t *out_sig_ptr, symb_decis;
+  bit_t *out_sig_ptr;
   bit_t *symb_clock_in_ptr;
-  int is;
-
-  double integ_val = Integ_Val;
+  int is, num_dumps;
 
    Out_Sig->SetValidBlockSize(Out_Block_Size);
    Samp_Wave_Out->SetValidBlockSize(In_Block_Size);
@@ -81,34 +84,23 @@ int IntegrateDumpAndSlice::Execute()
   samp_wave_out_ptr = GET_OUTPUT_PTR( Samp_Wave_Out );
   symb_clock_in_ptr = GET_INPUT_PTR( Symb_Clock_In );
   in_sig_ptr = GET_INPUT_PTR( In_Sig );
-  //corr_sig_ptr = GET_INPUT_PTR( Corr_Sig );
 
-  for (is=0; is<In_Block_Size; is++)
+  num_dumps = Kernel->Execute( in_sig_ptr,
+                               symb_clock_in_ptr,
+                               In_Block_Size,
+                               Dump_Val,
+                               NULL );
+
+  // time to make decisions
+  for (is=0; is<num_dumps; is++)
     {
-    in_val = *in_sig_ptr++;
-    //corr_val = *corr_sig_ptr++;
-
-    //integ_val += in_val*corr_val;
-    integ_val += in_val;
-
-    if(*symb_clock_in_ptr != 0)
-      {
-      // time to make a decision
-
-      if(integ_val < 0.0) symb_decis = 0;
-      else symb_decis = 1;
-      *out_sig_ptr++ = symb_decis;
-      *samp_wave_out_ptr++ = integ_val;
-      integ_val = 0.0;
-      }
-    else
-      {
-      //*samp_wave_out_ptr++ = 0.0;
-      *samp_wave_out_ptr++ = integ_val;
-      }
-    symb_clock_in_ptr++;
+    if(Dump_Val[is] < 0.0) out_sig_ptr[is] = 0;
+    else out_sig_ptr[is] = 1;
     }
-  Integ_Val = integ_val;
+
+  // running integral (reset at each dump) for plotting
+  Kernel->GetPartialSums( samp_wave_out_ptr );
+
   return(_MES_AOK);
 }
 
@@ -42,59 +42,50 @@ IntegrateAndDump::IntegrateAndDump( char* instance_name,
 //  CHANGE_RATE(In_Sig, Samp_Wave_Out);
 
 }
-IntegrateAndDump::~IntegrateAndDump( void ){ };
+IntegrateAndDump::~IntegrateAndDump( void )
+{
+  delete Kernel;
+  delete[] Dump_Len;
+};
 
 void IntegrateAndDump::Initialize(void)
 {
   In_Block_Size = In_Sig->GetBlockSize();
   In_Samp_Intvl = In_Sig->GetSampIntvl();
 
-  Integ_Val = 0.0;
-  Integ_Gain = 0.0;
+  Kernel = new k_IntegrateAndDump<float>(In_Block_Size);
+  Kernel->Initialize();
+  Dump_Len = new int[In_Block_Size];
 };
 
 //============================================
 int IntegrateAndDump::Execute()
 {
-  float *in_sig_ptr, in_val;
+  float *in_sig_ptr;
   float *samp_wave_out_ptr;
   bit_t *symb_clock_in_ptr;
   int is, block_size;
   int out_block_size;
 
-  double integ_val = Integ_Val;
-  double integ_gain = Integ_Gain;
-
   samp_wave_out_ptr = GET_OUTPUT_PTR( Samp_Wave_Out );
   symb_clock_in_ptr = GET_INPUT_PTR( Symb_Clock_In );
   in_sig_ptr = GET_INPUT_PTR( In_Sig );
   block_size = In_Sig->GetValidBlockSize();
-  out_block_size = 0;
 
-  for (is=0; is<block_size; is++)
-    {
-    in_val = *in_sig_ptr++;
-    integ_val += in_val;
-    integ_gain++;
-
-    if(*symb_clock_in_ptr != 0)
-      {
-      // time to make a decision
+  // integrated values are dumped straight into the output
+  // buffer and then normalized by the number of samples
+  // that went into each one
+  out_block_size = Kernel->Execute( in_sig_ptr,
+                                    symb_clock_in_ptr,
+                                    block_size,
+                                    samp_wave_out_ptr,
+                                    Dump_Len );
 
-      *samp_wave_out_ptr++ = integ_val/integ_gain;
-      out_block_size++;
-      integ_val = 0.0;
-      integ_gain = 0.0;
-      }
-//    else
-//      {
-      //*samp_wave_out_ptr++ = 0.0;
-//      *samp_wave_out_ptr++ = integ_val;
-//      }
-    symb_clock_in_ptr++;
+  for (is=0; is<out_block_size; is++)
+    {
+    samp_wave_out_ptr[is] /= float(Dump_Len[is]);
     }
  Samp_Wave_Out->SetValidBlockSize(out_block_size);
-  Integ_Val = integ_val;
   return(_MES_AOK);
 }
 
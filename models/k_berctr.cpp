@@ -3,24 +3,71 @@
 //
 
 #include <stdlib.h>
+#include <string.h>
 #include <fstream>
 #include "parmfile.h"
 #include "k_berctr.h"
 #include "typedefs.h"
 #include "model_graph.h"
 #include "syst_graph.h"
+#include "binom_conf.h"
+
+#if defined(__SSE2__) && !defined(_BER_SSE2)
+  #define _BER_SSE2
+#endif
+#ifdef _BER_SSE2
+  #include <emmintrin.h>
+#endif
+
 extern ParmFile *ParmInput;
 extern ofstream *DebugFile;
 extern SystemGraph CommSystemGraph;
 extern int PassNumber;
 extern int MaxPassNumber;
+extern bool SimStopRequested;
+extern int SimStopVoters;
+extern int SimStopVotes;
+
+//======================================================
+static int BerWordPopCount( ber_word_t word )
+{
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return(int((word * 0x0101010101010101ULL) >> 56));
+}
+//======================================================
+static void AppendPackedBit( std::vector<ber_word_t> &words,
+                             int *bit_count,
+                             bit_t bit_val )
+{
+  int b_idx = (*bit_count) % BER_WORD_BITS;
+  if(b_idx == 0) words.push_back(0);
+  words.back() |= ber_word_t(bit_val & 1) << b_idx;
+  (*bit_count)++;
+}
+//======================================================
+static ber_word_t ExtractPackedBits( const std::vector<ber_word_t> &words,
+                                     int bit_pos,
+                                     int num_bits )
+{
+  int w_idx = bit_pos/BER_WORD_BITS;
+  int b_idx = bit_pos%BER_WORD_BITS;
+  ber_word_t bits = words[w_idx] >> b_idx;
+
+  if(b_idx != 0 && b_idx + num_bits > BER_WORD_BITS){
+    bits |= words[w_idx+1] << (BER_WORD_BITS - b_idx);
+    }
+  if(num_bits < BER_WORD_BITS) bits &= (ber_word_t(1) << num_bits) - 1;
+  return(bits);
+}
 
 //======================================================
 // constructor - parms read from ParmFile
 
 k_BerCounter::k_BerCounter( char* instance_name )
 {
-  Instance_Name = new char[strlen(instance_name)];
+  Instance_Name = new char[strlen(instance_name)+1];
   strcpy(Instance_Name, instance_name);
 
   OPEN_PARM_BLOCK;
@@ -33,13 +80,17 @@ k_BerCounter::k_BerCounter( char* instance_name )
   Error_Count = 0;
   Error_0_Count = 0;
   Error_1_Count = 0;
+  Stop_Voter = false;
+  Stop_Vote_Cast = false;
+  SetDelaySearch(0, 0, 0);
+  SetConfidence(0.0, 0.0);
 }
 //==============================================
 k_BerCounter::k_BerCounter( char* instance_name,
                             int num_holdoff_passes,
                             int report_intvl_in_blocks)
 {
-  Instance_Name = new char[strlen(instance_name)];
+  Instance_Name = new char[strlen(instance_name)+1];
   strcpy(Instance_Name, instance_name);
 
   Num_Holdoff_Passes = num_holdoff_passes;
@@ -50,81 +101,333 @@ k_BerCounter::k_BerCounter( char* instance_name,
   Error_Count = 0;
   Error_0_Count = 0;
   Error_1_Count = 0;
+  Stop_Voter = false;
+  Stop_Vote_Cast = false;
+  SetDelaySearch(0, 0, 0);
+  SetConfidence(0.0, 0.0);
 }
 //==============================================
-k_BerCounter::~k_BerCounter( void ){ };
+k_BerCounter::~k_BerCounter( void )
+{
+  if(Stop_Voter)
+    {
+    SimStopVoters--;
+    if(Stop_Vote_Cast) SimStopVotes--;
+    }
+  delete []Instance_Name;
+};
 
 //==============================================
 void k_BerCounter::Initialize(void)
 {
 };
 
+//==============================================
+void k_BerCounter::SetDelaySearch( int max_lag,
+                                   int sync_window_len,
+                                   int max_window_errs )
+{
+  if(max_lag < 0 || (max_lag > 0 && sync_window_len < 1))
+    {
+    ErrorStream << "Error: " << Instance_Name
+                << " needs Max_Lag >= 0 and, if Max_Lag > 0, Sync_Window_Len >= 1"
+                << endl;
+    exit(-1);
+    }
+  Max_Lag = max_lag;
+  Sync_Window_Len = sync_window_len;
+  Max_Window_Errs = max_window_errs;
+
+  // with no search the streams are taken as aligned
+  In_Sync = (Max_Lag == 0);
+  Curr_Lag = 0;
+  Num_Sync_Losses = 0;
+  Window_Bits = 0;
+  Window_Errs = 0;
+  Ref_Hist.clear();
+  Acq_Count = 0;
+  Acq_Ref_Count = 0;
+}
+//==============================================
+void k_BerCounter::SetConfidence( double conf_level,
+                                  double target_rel_precision )
+{
+  if(conf_level < 0.0 || conf_level >= 1.0)
+    {
+    ErrorStream << "Error: " << Instance_Name
+                << " confidence level must be in [0, 1)" << endl;
+    exit(-1);
+    }
+  Conf_Level = conf_level;
+  Target_Rel_Precision = (conf_level > 0.0) ? target_rel_precision : 0.0;
+
+  // a counter with a precision target gets one vote on
+  // ending the run
+  if((Target_Rel_Precision > 0.0) != Stop_Voter)
+    {
+    if(Stop_Voter)
+      {
+      SimStopVoters--;
+      if(Stop_Vote_Cast) SimStopVotes--;
+      }
+    else
+      {
+      SimStopVoters++;
+      }
+    Stop_Voter = !Stop_Voter;
+    Stop_Vote_Cast = false;
+    }
+}
+
 //==============================================
 int k_BerCounter::Execute( bit_t *in_sig_ptr,
                             bit_t *ref_sig_ptr,
                             int block_size )
 {
-  bit_t bit_val, ref_val;
-  int bit_count, error_count;
-  int bit_0_count, bit_1_count;
-  int error_0_count, error_1_count;
-  bit_t *symbs_in;
-  bit_t *symbs_ref;
-  int is;
+  int is, num_now, hist_len;
+  bool stop_now;
+
+  if(Max_Lag > 0)
+    {
+    // keep the reference history current through the
+    // holdoff passes so a lag can be found on the first
+    // counted block
+    hist_len = int(Ref_Hist.size());
+    if(hist_len >= Max_Lag)
+      memmove(&Ref_Hist[0], &Ref_Hist[hist_len-Max_Lag], Max_Lag*sizeof(bit_t));
+    else
+      Ref_Hist.assign(Max_Lag, 0);
+    Ref_Hist.resize(Max_Lag + block_size);
+    memcpy(&Ref_Hist[Max_Lag], ref_sig_ptr, block_size*sizeof(bit_t));
+    }
 
   if(PassNumber <= Num_Holdoff_Passes ) return(_MES_AOK);
 
-  symbs_in = in_sig_ptr;
-  symbs_ref = ref_sig_ptr;
+  if(Max_Lag == 0)
+    {
+    Tally(in_sig_ptr, ref_sig_ptr, block_size);
+    }
+  else
+    {
+    is = 0;
+    while(is < block_size)
+      {
+      if(!In_Sync)
+        {
+        is += Acquire(in_sig_ptr+is, is, block_size-is);
+        continue;
+        }
+      num_now = block_size - is;
+      if(num_now > Sync_Window_Len - Window_Bits)
+        num_now = int(Sync_Window_Len - Window_Bits);
+      Tally(in_sig_ptr+is, &Ref_Hist[Max_Lag + is - Curr_Lag], num_now);
+      is += num_now;
+      if(Window_Bits < Sync_Window_Len) continue;
 
-  bit_count = Bit_Count;
-  bit_0_count = Bit_0_Count;
-  bit_1_count = Bit_1_Count;
+      // the window only decides whether sync is kept; its
+      // errors stay counted either way
+      if(Window_Errs > Max_Window_Errs)
+        {
+        Num_Sync_Losses++;
+        In_Sync = false;
+        Acq_Count = 0;
+        }
+      Window_Bits = 0;
+      Window_Errs = 0;
+      }
+    }
 
-  error_count = Error_Count;
-  error_0_count = Error_0_Count;
-  error_1_count = Error_1_Count;
+  stop_now = Stop_Voter && !Stop_Vote_Cast && PrecisionReached();
 
-  bool error_found = false;
+//  if(PassNumber == MaxPassNumber)
+  if( stop_now ||
+      ((PassNumber - Num_Holdoff_Passes) % Report_Intvl_In_Blocks) == 0)
+    {
+    WriteReport();
+    }
+  if(stop_now)
+    {
+    // the run ends only when every voting counter is done
+    Stop_Vote_Cast = true;
+    SimStopVotes++;
+    BasicResults << Instance_Name << ": target precision reached at pass "
+                 << PassNumber;
+    if(SimStopVotes < SimStopVoters)
+      {
+      BasicResults << ", waiting on " << (SimStopVoters - SimStopVotes)
+                   << " other counter(s)" << endl;
+      }
+    else
+      {
+      BasicResults << ", requesting stop" << endl;
+      SimStopRequested = true;
+      }
+    }
+  return(_MES_AOK);
+}
+//==============================================
+//  Bits are compared a vector at a time with xor/and
+//  instead of per-bit branches; only bit 0 of each
+//  sample is significant.
+
+void k_BerCounter::Tally( const bit_t *in_bits,
+                          const bit_t *ref_bits,
+                          int num_bits )
+{
+  long long num_ones = 0;
+  long long num_errs = 0;
+  long long num_errs_1 = 0;
+  bit_t diff, ref_val;
+  int is = 0;
+
+#ifdef _BER_SSE2
+  __m128i one_mask = _mm_set1_epi32(1);
+  __m128i acc_ones = _mm_setzero_si128();
+  __m128i acc_errs = _mm_setzero_si128();
+  __m128i acc_errs_1 = _mm_setzero_si128();
+  __m128i in_vec, ref_vec, diff_vec;
+  int lane_sum[4];
 
-  for (is=0; is < block_size; is++)
+  for(; is+4<=num_bits; is+=4)
     {
-    bit_val = *symbs_in++;
-    ref_val = *symbs_ref++;
-    bit_count++;
+    in_vec = _mm_and_si128(_mm_loadu_si128((const __m128i*)(in_bits+is)), one_mask);
+    ref_vec = _mm_and_si128(_mm_loadu_si128((const __m128i*)(ref_bits+is)), one_mask);
+    diff_vec = _mm_xor_si128(in_vec, ref_vec);
+    acc_ones = _mm_add_epi32(acc_ones, ref_vec);
+    acc_errs = _mm_add_epi32(acc_errs, diff_vec);
+    acc_errs_1 = _mm_add_epi32(acc_errs_1, _mm_and_si128(diff_vec, ref_vec));
+    }
+  _mm_storeu_si128((__m128i*)lane_sum, acc_ones);
+  num_ones = (long long)lane_sum[0] + lane_sum[1] + lane_sum[2] + lane_sum[3];
+  _mm_storeu_si128((__m128i*)lane_sum, acc_errs);
+  num_errs = (long long)lane_sum[0] + lane_sum[1] + lane_sum[2] + lane_sum[3];
+  _mm_storeu_si128((__m128i*)lane_sum, acc_errs_1);
+  num_errs_1 = (long long)lane_sum[0] + lane_sum[1] + lane_sum[2] + lane_sum[3];
+#endif
 
-    if(ref_val == 0)
-      bit_0_count++;
-    else
-      bit_1_count++;
+  for(; is<num_bits; is++)
+    {
+    ref_val = ref_bits[is] & 1;
+    diff = (in_bits[is] ^ ref_val) & 1;
+    num_ones += ref_val;
+    num_errs += diff;
+    num_errs_1 += diff & ref_val;
+    }
 
-    if(bit_val != ref_val) 
-      {
-      error_found = true;
-      error_count++;
+  Bit_Count += num_bits;
+  Bit_1_Count += num_ones;
+  Bit_0_Count += num_bits - num_ones;
+  Error_Count += num_errs;
+  Error_1_Count += num_errs_1;
+  Error_0_Count += num_errs - num_errs_1;
 
-      if(ref_val == 0)
-        error_0_count++;
-      else
-        error_1_count++;
-      }
+  Window_Bits += num_bits;
+  Window_Errs += num_errs;
+}
+//==============================================
+//  Packs received bits, and the reference from Max_Lag
+//  bits earlier, until a full sync window is collected.
+//  blk_pos is the position of in_bits within the block.
+//  Returns the number of bits consumed.
+
+int k_BerCounter::Acquire( const bit_t *in_bits,
+                           int blk_pos,
+                           int num_bits )
+{
+  int ib, num_now;
+
+  if(Acq_Count == 0)
+    {
+    Acq_In.clear();
+    Acq_Ref.clear();
+    Acq_Ref_Count = 0;
+    for(ib=0; ib<Max_Lag; ib++)
+      AppendPackedBit(Acq_Ref, &Acq_Ref_Count, Ref_Hist[blk_pos+ib]);
     }
-//  if(PassNumber == MaxPassNumber)
-  if( ((PassNumber - Num_Holdoff_Passes) % Report_Intvl_In_Blocks) == 0)
+  num_now = Sync_Window_Len - Acq_Count;
+  if(num_now > num_bits) num_now = num_bits;
+  for(ib=0; ib<num_now; ib++)
     {
-    BasicResults << Instance_Name << ": "
-              << PassNumber << "  BER = " << (float(error_count)/float(bit_count)) << " -- "
-              << error_count << " errors in " << bit_count << " bits" << endl;
-    BasicResults << "space errors = " << error_0_count
-                 << "   mark errors = " << error_1_count << endl;
+    AppendPackedBit(Acq_In, &Acq_Count, in_bits[ib]);
+    AppendPackedBit(Acq_Ref, &Acq_Ref_Count, Ref_Hist[Max_Lag+blk_pos+ib]);
     }
-  Bit_Count = bit_count;
-  Bit_0_Count = bit_0_count;
-  Bit_1_Count = bit_1_count;
+  if(Acq_Count == Sync_Window_Len) SearchLag();
+  return(num_now);
+}
+//==============================================
+//  Correlates the packed window against the reference
+//  at each lag, 64 bits per xor/popcount; a lag is
+//  abandoned as soon as it can no longer beat the best.
 
-  Error_Count = error_count;
-  Error_0_Count = error_0_count;
-  Error_1_Count = error_1_count;
-  return(_MES_AOK);
+void k_BerCounter::SearchLag(void)
+{
+  int num_words = (Sync_Window_Len + BER_WORD_BITS-1)/BER_WORD_BITS;
+  int best_errs = Sync_Window_Len + 1;
+  int best_lag = 0;
+  int lag, iw, num_errs, word_bits;
+
+  for(lag=0; lag<=Max_Lag; lag++)
+    {
+    num_errs = 0;
+    for(iw=0; iw<num_words && num_errs<best_errs; iw++)
+      {
+      word_bits = Sync_Window_Len - iw*BER_WORD_BITS;
+      if(word_bits > BER_WORD_BITS) word_bits = BER_WORD_BITS;
+      num_errs += BerWordPopCount( Acq_In[iw] ^
+                     ExtractPackedBits(Acq_Ref, Max_Lag - lag + iw*BER_WORD_BITS, word_bits) );
+      }
+    if(num_errs < best_errs)
+      {
+      best_errs = num_errs;
+      best_lag = lag;
+      }
+    }
+
+  // the window itself is not counted either way
+  Acq_Count = 0;
+  if(best_errs > Max_Window_Errs) return;
+  In_Sync = true;
+  Curr_Lag = best_lag;
+  Window_Bits = 0;
+  Window_Errs = 0;
 }
+//==============================================
+//  Wilson interval is used for the stopping test since
+//  it is closed form and is evaluated every pass
+
+bool k_BerCounter::PrecisionReached(void)
+{
+  double ber, lower, upper;
+
+  if(Error_Count == 0) return(false);
+  ber = double(Error_Count)/double(Bit_Count);
+  WilsonInterval(Error_Count, Bit_Count, Conf_Level, &lower, &upper);
+  return( (upper - lower)/2.0 <= Target_Rel_Precision*ber );
+}
+//==============================================
+void k_BerCounter::WriteReport(void)
+{
+  double wil_lower, wil_upper, cp_lower, cp_upper;
 
+  BasicResults << Instance_Name << ": "
+               << PassNumber << "  BER = "
+               << (Bit_Count > 0 ? double(Error_Count)/double(Bit_Count) : 0.0)
+               << " -- " << double(Error_Count) << " errors in "
+               << double(Bit_Count) << " bits" << endl;
+  BasicResults << "space errors = " << double(Error_0_Count)
+               << "   mark errors = " << double(Error_1_Count) << endl;
+  if(Max_Lag > 0)
+    {
+    BasicResults << "lag = " << Curr_Lag
+                 << "  sync losses = " << Num_Sync_Losses
+                 << (In_Sync ? "" : "  (out of sync)") << endl;
+    }
+  if(Conf_Level > 0.0 && Bit_Count > 0)
+    {
+    WilsonInterval(Error_Count, Bit_Count, Conf_Level, &wil_lower, &wil_upper);
+    ClopperPearsonInterval(Error_Count, Bit_Count, Conf_Level, &cp_lower, &cp_upper);
+    BasicResults << 100.0*Conf_Level << "% interval  Wilson = ["
+                 << wil_lower << ", " << wil_upper << "]  Clopper-Pearson = ["
+                 << cp_lower << ", " << cp_upper << "]" << endl;
+    }
+}
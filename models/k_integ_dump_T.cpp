@@ -0,0 +1,192 @@
+//
+//  File = k_integ_dump_T.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include "k_integ_dump_T.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+#ifdef _DEBUG
+  extern ofstream *DebugFile;
+#endif
+
+//======================================================
+// constructor
+
+template <class T>
+k_IntegrateAndDump<T>::k_IntegrateAndDump( int max_block_size )
+{
+  Max_Block_Size = max_block_size;
+  Prefix_Sum = new acc_t[Max_Block_Size];
+  Symb_Clock_Ptr = NULL;
+  Block_Size = 0;
+  Carry_Sum = acc_t(0.0);
+  Carry_Count = 0;
+}
+//======================================================
+template <class T>
+k_IntegrateAndDump<T>::~k_IntegrateAndDump( void )
+{
+  delete[] Prefix_Sum;
+};
+
+//======================================================
+template <class T>
+void k_IntegrateAndDump<T>::Initialize(void)
+{
+  Carry_Sum = acc_t(0.0);
+  Carry_Count = 0;
+};
+
+//======================================================
+//  Fills Prefix_Sum[is] with the integral of the input from
+//  the most recent dump in a previous block (i.e. including
+//  the carried partial symbol) through sample is.
+//
+//  The block is split into INTEG_DUMP_NUM_LANES strips that
+//  are summed concurrently, and then each strip is offset by
+//  the totals of the strips ahead of it.
+
+template <class T>
+void k_IntegrateAndDump<T>::PrefixSum( T *in_sig_ptr,
+                                       int block_size )
+{
+  acc_t lane_sum[INTEG_DUMP_NUM_LANES];
+  acc_t offset;
+  int strip_len, strip_beg, strip_end;
+  int lane, is;
+
+  strip_len = block_size / INTEG_DUMP_NUM_LANES;
+
+  for(lane=0; lane<INTEG_DUMP_NUM_LANES; lane++)
+    {
+    lane_sum[lane] = acc_t(0.0);
+    }
+
+  //-----------------------------------------------------
+  //  local prefix sum within each strip
+
+  for(is=0; is<strip_len; is++)
+    {
+    for(lane=0; lane<INTEG_DUMP_NUM_LANES; lane++)
+      {
+      lane_sum[lane] += acc_t(in_sig_ptr[lane*strip_len + is]);
+      Prefix_Sum[lane*strip_len + is] = lane_sum[lane];
+      }
+    }
+
+  // samples left over when block_size is not a multiple of
+  // the number of lanes are appended to the final strip
+  lane = INTEG_DUMP_NUM_LANES - 1;
+  for(is=INTEG_DUMP_NUM_LANES*strip_len; is<block_size; is++)
+    {
+    lane_sum[lane] += acc_t(in_sig_ptr[is]);
+    Prefix_Sum[is] = lane_sum[lane];
+    }
+
+  //-----------------------------------------------------
+  //  offset each strip by everything that precedes it
+
+  offset = Carry_Sum;
+  for(lane=0; lane<INTEG_DUMP_NUM_LANES; lane++)
+    {
+    strip_beg = lane*strip_len;
+    if(lane == INTEG_DUMP_NUM_LANES-1)
+      strip_end = block_size;
+    else
+      strip_end = strip_beg + strip_len;
+
+    for(is=strip_beg; is<strip_end; is++)
+      {
+      Prefix_Sum[is] += offset;
+      }
+    offset += lane_sum[lane];
+    }
+}
+
+//======================================================
+//  Integrates the input block and writes one integrated
+//  value to dump_val_ptr for every nonzero sample in the
+//  symbol clock.  If dump_len_ptr is not NULL, the number
+//  of input samples that went into each dumped value is
+//  written there.  Returns the number of values dumped.
+
+template <class T>
+int k_IntegrateAndDump<T>::Execute( T *in_sig_ptr,
+                                    bit_t *symb_clock_ptr,
+                                    int block_size,
+                                    T *dump_val_ptr,
+                                    int *dump_len_ptr )
+{
+  acc_t dump_base;
+  int prev_dump_idx;
+  int carry_count;
+  int num_dumps;
+  int is;
+
+  if(block_size > Max_Block_Size)
+    {
+    ErrorStream << "block too large for k_IntegrateAndDump" << endl;
+    exit(-99);
+    }
+  Block_Size = block_size;
+  Symb_Clock_Ptr = symb_clock_ptr;
+  if(block_size <= 0) return(0);
+
+  PrefixSum(in_sig_ptr, block_size);
+
+  //-----------------------------------------------------
+  //  difference the prefix sum at each strobe
+
+  dump_base = acc_t(0.0);
+  prev_dump_idx = -1;
+  carry_count = Carry_Count;
+  num_dumps = 0;
+
+  for(is=0; is<block_size; is++)
+    {
+    if(symb_clock_ptr[is] == 0) continue;
+
+    dump_val_ptr[num_dumps] = T(Prefix_Sum[is] - dump_base);
+    if(dump_len_ptr != NULL)
+      {
+      dump_len_ptr[num_dumps] = is - prev_dump_idx + carry_count;
+      }
+    carry_count = 0;
+    dump_base = Prefix_Sum[is];
+    prev_dump_idx = is;
+    num_dumps++;
+    }
+
+  //-----------------------------------------------------
+  //  partial symbol carries over into the next block
+
+  Carry_Sum = Prefix_Sum[block_size-1] - dump_base;
+  Carry_Count = carry_count + (block_size - 1 - prev_dump_idx);
+
+  return(num_dumps);
+}
+
+//======================================================
+//  For the block most recently passed to Execute(), writes
+//  the running integral since the last dump at each sample.
+//  At a strobe sample this is the value that was dumped.
+
+template <class T>
+void k_IntegrateAndDump<T>::GetPartialSums( T *partial_sum_ptr )
+{
+  acc_t dump_base;
+  int is;
+
+  dump_base = acc_t(0.0);
+  for(is=0; is<Block_Size; is++)
+    {
+    partial_sum_ptr[is] = T(Prefix_Sum[is] - dump_base);
+    if(Symb_Clock_Ptr[is] != 0) dump_base = Prefix_Sum[is];
+    }
+}
+
+template class k_IntegrateAndDump<float>;
+template class k_IntegrateAndDump< std::complex<float> >;
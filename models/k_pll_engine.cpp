@@ -0,0 +1,88 @@
+//
+//  File = k_pll_engine.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include "misdefs.h"
+#include "k_pll_engine.h"
+
+//======================================================
+// constructor
+
+k_StateSpaceLoopFilter::k_StateSpaceLoopFilter(
+                     AnalogFilterByIir<float> *filter_core )
+{
+   int idx;
+   double *a_coefs;
+   double *b_coefs;
+
+   if(filter_core->BypassIsEnabled()){
+      Filt_Order = 0;
+   }
+   else{
+      Filt_Order = filter_core->GetFiltOrder();
+   }
+   A_Coefs = new double[Filt_Order+1];
+   B_Coefs = new double[Filt_Order+1];
+   State = new double[Filt_Order+1];
+
+   if(Filt_Order == 0){
+      // bypassed filter passes its input straight through
+      A_Coefs[0] = 0.0;
+      B_Coefs[0] = 1.0;
+   }
+   else{
+      a_coefs = filter_core->GetACoefs();
+      b_coefs = filter_core->GetBCoefs();
+      for(idx=0; idx<=Filt_Order; idx++){
+         A_Coefs[idx] = a_coefs[idx];
+         B_Coefs[idx] = b_coefs[idx];
+      }
+   }
+   Reset();
+}
+//======================================================
+k_StateSpaceLoopFilter::~k_StateSpaceLoopFilter( void )
+{
+   delete[] A_Coefs;
+   delete[] B_Coefs;
+   delete[] State;
+};
+//======================================================
+void k_StateSpaceLoopFilter::Reset(void)
+{
+   for(int idx=0; idx<=Filt_Order; idx++){
+      State[idx] = 0.0;
+   }
+}
+
+//======================================================
+//  NCO sine table is shared by every oscillator instance.
+//  It has one guard entry at the end so that interpolation
+//  at the top index does not need to wrap.
+
+float *k_Nco::Sine_Table = NULL;
+const double k_Nco::Words_Per_Rad = 4294967296.0/TWO_PI;
+const double k_Nco::Rad_Per_Word = TWO_PI/4294967296.0;
+const float k_Nco::Frac_Scale = float(1.0/4294967296.0);
+
+k_Nco::k_Nco( void )
+{
+   if(Sine_Table == NULL){
+      Sine_Table = new float[NCO_TABLE_SIZE+1];
+      for(int idx=0; idx<=NCO_TABLE_SIZE; idx++){
+         Sine_Table[idx] = float(sin(TWO_PI*idx/double(NCO_TABLE_SIZE)));
+      }
+   }
+   Reset();
+}
+//======================================================
+k_Nco::~k_Nco( void )
+{
+};
+//======================================================
+void k_Nco::Reset(void)
+{
+   Phase_Word = 0;
+}
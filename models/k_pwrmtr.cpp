@@ -124,6 +124,6 @@ int k_PowerMeter<T>::Execute(  T *in_sig_ptr,
 
   return(0);
 }
-template k_PowerMeter<std::complex<float> >;
-template k_PowerMeter<float>;
+template class k_PowerMeter<std::complex<float> >;
+template class k_PowerMeter<float>;
 
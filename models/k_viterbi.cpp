@@ -0,0 +1,336 @@
+//
+//  File = k_viterbi.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include "k_viterbi.h"
+#include "bitenctab.h"
+#include "psstream.h"
+
+#if defined(__AVX2__) && !defined(_VIT_AVX2)
+  #define _VIT_AVX2
+#endif
+#if defined(__SSE2__) && !defined(_VIT_SSE2)
+  #define _VIT_SSE2
+#endif
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  Lane vector primitives.  A vector holds one 16-bit
+//  path or branch metric for each lane.
+
+#if defined(_VIT_AVX2)
+
+#include <immintrin.h>
+#define VIT_NUM_LANES 16
+typedef __m256i vit_vec_t;
+
+static inline vit_vec_t VecLoad( const short *src )
+   {return(_mm256_loadu_si256((const __m256i*)src));}
+static inline void VecStore( short *dest, vit_vec_t val )
+   {_mm256_storeu_si256((__m256i*)dest, val);}
+static inline vit_vec_t VecZero(void)
+   {return(_mm256_setzero_si256());}
+static inline vit_vec_t VecAdds( vit_vec_t a, vit_vec_t b )
+   {return(_mm256_adds_epi16(a, b));}
+static inline vit_vec_t VecSubs( vit_vec_t a, vit_vec_t b )
+   {return(_mm256_subs_epi16(a, b));}
+static inline vit_vec_t VecMax( vit_vec_t a, vit_vec_t b )
+   {return(_mm256_max_epi16(a, b));}
+
+//  bit i set where lane i of a exceeds lane i of b
+static inline unsigned int VecGtMask( vit_vec_t a, vit_vec_t b )
+{
+   __m256i gt = _mm256_packs_epi16(_mm256_cmpgt_epi16(a, b), _mm256_setzero_si256());
+   gt = _mm256_permute4x64_epi64(gt, 0xd8);
+   return(unsigned(_mm256_movemask_epi8(gt)) & 0xffff);
+}
+
+#elif defined(_VIT_SSE2)
+
+#include <emmintrin.h>
+#define VIT_NUM_LANES 8
+typedef __m128i vit_vec_t;
+
+static inline vit_vec_t VecLoad( const short *src )
+   {return(_mm_loadu_si128((const __m128i*)src));}
+static inline void VecStore( short *dest, vit_vec_t val )
+   {_mm_storeu_si128((__m128i*)dest, val);}
+static inline vit_vec_t VecZero(void)
+   {return(_mm_setzero_si128());}
+static inline vit_vec_t VecAdds( vit_vec_t a, vit_vec_t b )
+   {return(_mm_adds_epi16(a, b));}
+static inline vit_vec_t VecSubs( vit_vec_t a, vit_vec_t b )
+   {return(_mm_subs_epi16(a, b));}
+static inline vit_vec_t VecMax( vit_vec_t a, vit_vec_t b )
+   {return(_mm_max_epi16(a, b));}
+static inline unsigned int VecGtMask( vit_vec_t a, vit_vec_t b )
+{
+   __m128i gt = _mm_packs_epi16(_mm_cmpgt_epi16(a, b), _mm_setzero_si128());
+   return(unsigned(_mm_movemask_epi8(gt)) & 0xff);
+}
+
+#else
+
+#define VIT_NUM_LANES 8
+typedef struct{ short lane[VIT_NUM_LANES]; } vit_vec_t;
+
+static inline short SatShort( int val )
+{
+   if(val > 32767) return(32767);
+   if(val < -32768) return(-32768);
+   return(short(val));
+}
+static inline vit_vec_t VecLoad( const short *src )
+{
+   vit_vec_t res;
+   for(int i=0; i<VIT_NUM_LANES; i++) res.lane[i] = src[i];
+   return(res);
+}
+static inline void VecStore( short *dest, vit_vec_t val )
+{
+   for(int i=0; i<VIT_NUM_LANES; i++) dest[i] = val.lane[i];
+}
+static inline vit_vec_t VecZero(void)
+{
+   vit_vec_t res;
+   for(int i=0; i<VIT_NUM_LANES; i++) res.lane[i] = 0;
+   return(res);
+}
+static inline vit_vec_t VecAdds( vit_vec_t a, vit_vec_t b )
+{
+   for(int i=0; i<VIT_NUM_LANES; i++) a.lane[i] = SatShort(a.lane[i] + b.lane[i]);
+   return(a);
+}
+static inline vit_vec_t VecSubs( vit_vec_t a, vit_vec_t b )
+{
+   for(int i=0; i<VIT_NUM_LANES; i++) a.lane[i] = SatShort(a.lane[i] - b.lane[i]);
+   return(a);
+}
+static inline vit_vec_t VecMax( vit_vec_t a, vit_vec_t b )
+{
+   for(int i=0; i<VIT_NUM_LANES; i++) if(b.lane[i] > a.lane[i]) a.lane[i] = b.lane[i];
+   return(a);
+}
+static inline unsigned int VecGtMask( vit_vec_t a, vit_vec_t b )
+{
+   unsigned int mask = 0;
+   for(int i=0; i<VIT_NUM_LANES; i++) if(a.lane[i] > b.lane[i]) mask |= 1u << i;
+   return(mask);
+}
+
+#endif
+
+//======================================================
+//  constructor
+
+k_ViterbiDecoder::k_ViterbiDecoder( int constr_len,
+                                    int num_outputs,
+                                    const int *gen_polys,
+                                    int traceback_depth,
+                                    float soft_scale )
+{
+   BitEncodingTable *enc_table[VIT_MAX_OUTPUTS];
+   int state, pred, in_bit, reg, pattern, k, d, i;
+
+   if(constr_len < VIT_MIN_CONSTR_LEN || constr_len > VIT_MAX_CONSTR_LEN){
+      ErrorStream << "Error: Viterbi decoder constraint length must be "
+                  << VIT_MIN_CONSTR_LEN << " thru " << VIT_MAX_CONSTR_LEN << endl;
+      exit(-1);
+   }
+   if(num_outputs < 2 || num_outputs > VIT_MAX_OUTPUTS){
+      ErrorStream << "Error: Viterbi decoder supports rate 1/2 thru 1/"
+                  << VIT_MAX_OUTPUTS << endl;
+      exit(-1);
+   }
+   if(traceback_depth < constr_len){
+      ErrorStream << "Error: traceback depth must be at least the "
+                  << "constraint length" << endl;
+      exit(-1);
+   }
+   Constr_Len = constr_len;
+   Num_Outputs = num_outputs;
+   Num_States = 1 << (Constr_Len-1);
+   Num_Lanes = VIT_NUM_LANES;
+   Traceback_Depth = traceback_depth;
+   Warmup_Len = traceback_depth;
+   Soft_Scale = soft_scale;
+
+   // state = last constr_len-1 inputs, newest in the msb;
+   // the encoder register is the new input above the
+   // predecessor state
+   for(k=0; k<Num_Outputs; k++){
+      enc_table[k] = new BitEncodingTable(Constr_Len, gen_polys[k]);
+   }
+   Branch_Out.resize(2*Num_States);
+   for(state=0; state<Num_States; state++){
+      in_bit = state >> (Constr_Len-2);
+      for(d=0; d<2; d++){
+         pred = ((state << 1) & (Num_States-1)) | d;
+         reg = (in_bit << (Constr_Len-1)) | pred;
+         pattern = 0;
+         for(k=0; k<Num_Outputs; k++){
+            pattern = (pattern << 1) | (enc_table[k]->GetOutput(reg) & 1);
+         }
+         Branch_Out[2*state + d] = pattern;
+      }
+   }
+   for(k=0; k<Num_Outputs; k++) delete enc_table[k];
+
+   // the encoder starts in state 0, which looks the same
+   // as a run of zeros before the first bit
+   Soft_Hist.resize((Warmup_Len + Traceback_Depth)*Num_Outputs);
+   for(i=0; i<int(Soft_Hist.size()); i++) Soft_Hist[i] = -VIT_MAX_SOFT;
+
+   Branch_Metric.resize((1 << Num_Outputs)*Num_Lanes);
+   Path_Metric.resize(Num_States*Num_Lanes);
+   New_Metric.resize(Num_States*Num_Lanes);
+}
+//======================================================
+k_ViterbiDecoder::~k_ViterbiDecoder(void)
+{
+}
+//======================================================
+int k_ViterbiDecoder::GetNumLanes(void)
+{
+   return(VIT_NUM_LANES);
+}
+//======================================================
+//  Output bit i of this call is bit i + Warmup_Len of the
+//  history.  Lane l decodes a segment of seg_len output
+//  bits starting at lane_beg, preceded by Warmup_Len bits
+//  to settle the metrics and followed by Traceback_Depth
+//  bits so its survivors have merged.  The last segment
+//  is pulled back to end with the block, overlapping its
+//  neighbour rather than running past the data.
+
+void k_ViterbiDecoder::Execute( const float *soft_in,
+                                bit_t *bits_out,
+                                int num_bits )
+{
+   int carry_len = (Warmup_Len + Traceback_Depth)*Num_Outputs;
+   int hist_len, seg_len, num_steps, lane, lane_beg, step, k, i;
+   const short *src;
+   float val;
+
+   if(num_bits < 1) return;
+   hist_len = carry_len + num_bits*Num_Outputs;
+   Soft_Hist.resize(hist_len);
+   for(i=0; i<num_bits*Num_Outputs; i++){
+      val = soft_in[i]*Soft_Scale;
+      if(val > VIT_MAX_SOFT) val = VIT_MAX_SOFT;
+      if(val < -VIT_MAX_SOFT) val = -VIT_MAX_SOFT;
+      Soft_Hist[carry_len + i] = short(floor(val + 0.5f));
+   }
+
+   seg_len = (num_bits + Num_Lanes-1)/Num_Lanes;
+   num_steps = Warmup_Len + seg_len + Traceback_Depth;
+   Lane_Soft.resize(num_steps*Num_Outputs*Num_Lanes);
+   if(int(Decisions.size()) < num_steps*Num_States) Decisions.resize(num_steps*Num_States);
+
+   for(lane=0; lane<Num_Lanes; lane++){
+      lane_beg = lane*seg_len;
+      if(lane_beg > num_bits - seg_len) lane_beg = num_bits - seg_len;
+      src = &Soft_Hist[lane_beg*Num_Outputs];
+      for(step=0; step<num_steps; step++){
+         for(k=0; k<Num_Outputs; k++){
+            Lane_Soft[(step*Num_Outputs + k)*Num_Lanes + lane] = src[step*Num_Outputs + k];
+         }
+      }
+   }
+
+   DecodeLanes(num_steps);
+
+   for(lane=0; lane<Num_Lanes; lane++){
+      lane_beg = lane*seg_len;
+      if(lane_beg > num_bits - seg_len) lane_beg = num_bits - seg_len;
+      TraceBack(lane, num_steps, bits_out + lane_beg, seg_len);
+   }
+
+   // keep the tail for the next call
+   for(i=0; i<carry_len; i++) Soft_Hist[i] = Soft_Hist[hist_len - carry_len + i];
+   Soft_Hist.resize(carry_len);
+}
+//======================================================
+//  Add-compare-select for all lanes at once.  Metrics are
+//  correlations, so larger is better; subtracting the
+//  metric of state 0 every VIT_RENORM_INTVL steps keeps
+//  them well inside 16 bits.
+
+void k_ViterbiDecoder::DecodeLanes( int num_steps )
+{
+   short *old_metric = &Path_Metric[0];
+   short *new_metric = &New_Metric[0];
+   short *branch_metric = &Branch_Metric[0];
+   const int *branch_out = &Branch_Out[0];
+   unsigned short *decis;
+   vit_vec_t bm, soft, m0, m1, ref;
+   int num_patterns = 1 << Num_Outputs;
+   int step, pattern, state, pred, k;
+   short *swap;
+
+   for(state=0; state<Num_States; state++) VecStore(old_metric + state*Num_Lanes, VecZero());
+
+   for(step=0; step<num_steps; step++){
+      for(pattern=0; pattern<num_patterns; pattern++){
+         bm = VecZero();
+         for(k=0; k<Num_Outputs; k++){
+            soft = VecLoad(&Lane_Soft[(step*Num_Outputs + k)*Num_Lanes]);
+            if((pattern >> (Num_Outputs-1-k)) & 1) bm = VecAdds(bm, soft);
+            else bm = VecSubs(bm, soft);
+         }
+         VecStore(branch_metric + pattern*Num_Lanes, bm);
+      }
+
+      decis = &Decisions[step*Num_States];
+      for(state=0; state<Num_States; state++){
+         pred = (state << 1) & (Num_States-1);
+         m0 = VecAdds( VecLoad(old_metric + pred*Num_Lanes),
+                       VecLoad(branch_metric + branch_out[2*state]*Num_Lanes) );
+         m1 = VecAdds( VecLoad(old_metric + (pred+1)*Num_Lanes),
+                       VecLoad(branch_metric + branch_out[2*state+1]*Num_Lanes) );
+         decis[state] = (unsigned short)VecGtMask(m1, m0);
+         VecStore(new_metric + state*Num_Lanes, VecMax(m0, m1));
+      }
+      swap = old_metric;
+      old_metric = new_metric;
+      new_metric = swap;
+
+      if((step % VIT_RENORM_INTVL) == VIT_RENORM_INTVL-1){
+         ref = VecLoad(old_metric);
+         for(state=0; state<Num_States; state++){
+            VecStore( old_metric + state*Num_Lanes,
+                      VecSubs(VecLoad(old_metric + state*Num_Lanes), ref) );
+         }
+      }
+   }
+   if(old_metric != &Path_Metric[0]){
+      for(k=0; k<Num_States*Num_Lanes; k++) Path_Metric[k] = old_metric[k];
+   }
+}
+//======================================================
+void k_ViterbiDecoder::TraceBack( int lane,
+                                  int num_steps,
+                                  bit_t *lane_out,
+                                  int num_out )
+{
+   const short *metric = &Path_Metric[0];
+   int state, best_state, step, decis_bit;
+
+   best_state = 0;
+   for(state=1; state<Num_States; state++){
+      if(metric[state*Num_Lanes + lane] > metric[best_state*Num_Lanes + lane]){
+         best_state = state;
+      }
+   }
+   state = best_state;
+   for(step=num_steps-1; step>=Warmup_Len; step--){
+      if(step < Warmup_Len + num_out){
+         lane_out[step - Warmup_Len] = bit_t(state >> (Constr_Len-2));
+      }
+      decis_bit = (Decisions[step*Num_States + state] >> lane) & 1;
+      state = ((state << 1) & (Num_States-1)) | decis_bit;
+   }
+}
@@ -9,6 +9,7 @@
 #include "model_error.h"
 #include "linear_pll.h"
 #include "butt_filt_iir.h"
+#include "k_pll_engine.h"
 #include "model_graph.h"
 //#include "sinc.h"
 extern ParmFile *ParmInput;
@@ -73,23 +74,62 @@ LinearPLL::LinearPLL( char* instance_name,
 }
 
 //======================================
-LinearPLL::~LinearPLL( void ){ };
+LinearPLL::~LinearPLL( void )
+{
+   delete Filter;
+   delete Osc;
+   delete Divided_Osc;
+};
 
 //=======================================
 void LinearPLL::Initialize(void)
 {
+   static const LoopFnPtr loop_table[LOOP_DIAG_NUM_MASKS] = 
+                              LOOP_DIAG_TABLE(LinearPLL);
    //------------------
    int block_size = fsig_Output->GetBlockSize();
    Samp_Intvl = fsig_Input->GetSampIntvl();
    Filter_Core->Initialize(block_size, Samp_Intvl);
    Osc_Output_Prev_Val = 0.0;
    OscOutput = 0;
-   Phi_Sub_2 = 0;
-   Phi_Divided = 0;
 
+   Filter = new k_StateSpaceLoopFilter(Filter_Core);
+   Osc = new k_Nco;
+   Divided_Osc = new k_Nco;
+
+   //------------------------------------------------------
+   //  Select the version of the sample loop that produces
+   //  only the diagnostic outputs that are actually used
+
+   Diag_Mask = 
+      LOOP_DIAG_IF_USED(fsig_Phase_Error, LOOP_DIAG_PHASE_ERROR)
+    | LOOP_DIAG_IF_USED(fsig_Filtered_Error, LOOP_DIAG_FILT_ERROR)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Output, LOOP_DIAG_OSC_OUTPUT)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Freq, LOOP_DIAG_OSC_FREQ)
+    | LOOP_DIAG_IF_USED(fsig_Osc_Phase, LOOP_DIAG_OSC_PHASE);
+   Run_Loop = loop_table[Diag_Mask];
 }
 //=======================================================
 int LinearPLL::Execute()
+{
+   int block_size;
+
+   block_size = fsig_Input->GetValidBlockSize();
+
+   fsig_Output->SetValidBlockSize(block_size);
+   fsig_Phase_Error->SetValidBlockSize(block_size);
+   fsig_Filtered_Error->SetValidBlockSize(block_size);
+   fsig_Osc_Output->SetValidBlockSize(block_size);
+   fsig_Osc_Freq->SetValidBlockSize(block_size);
+   fsig_Osc_Phase->SetValidBlockSize(block_size);
+
+   (this->*Run_Loop)(block_size);
+
+  return(_MES_AOK);
+}
+//=======================================================
+template <int Diag_Mask>
+void LinearPLL::RunLoop(int block_size)
 {
    // pointers for signal data
 
@@ -108,51 +148,48 @@ int LinearPLL::Execute()
 
    double samp_intvl;
    double phase_error;
+   double phi_sub_2;
+   double osc_output;
    double err_sum=0;
    double err_avg;
    int is;
-   int block_size;
-
 
    //--------------------------------------------------------------
    // set up pointers to data buffers for input and output signals
 
    fsOutput_ptr = GET_OUTPUT_PTR( fsig_Output );
-   fsPhaseError_ptr = GET_OUTPUT_PTR( fsig_Phase_Error );
-   fs_filtered_error_ptr = GET_OUTPUT_PTR( fsig_Filtered_Error );
-
-   fsOscOutput_ptr = GET_OUTPUT_PTR( fsig_Osc_Output );
-   fsOscFreq_ptr = GET_OUTPUT_PTR( fsig_Osc_Freq );
-   fsOscPhase_ptr = GET_OUTPUT_PTR( fsig_Osc_Phase );
+   if(Diag_Mask & LOOP_DIAG_PHASE_ERROR)
+      fsPhaseError_ptr = GET_OUTPUT_PTR( fsig_Phase_Error );
+   if(Diag_Mask & LOOP_DIAG_FILT_ERROR)
+      fs_filtered_error_ptr = GET_OUTPUT_PTR( fsig_Filtered_Error );
+   if(Diag_Mask & LOOP_DIAG_OSC_OUTPUT)
+      fsOscOutput_ptr = GET_OUTPUT_PTR( fsig_Osc_Output );
+   if(Diag_Mask & LOOP_DIAG_OSC_FREQ)
+      fsOscFreq_ptr = GET_OUTPUT_PTR( fsig_Osc_Freq );
+   if(Diag_Mask & LOOP_DIAG_OSC_PHASE)
+      fsOscPhase_ptr = GET_OUTPUT_PTR( fsig_Osc_Phase );
    fsInput_ptr = GET_INPUT_PTR( fsig_Input );
    //---------------------------------------------------------------
 
    samp_intvl = Samp_Intvl;
    osc_output_val = Osc_Output_Prev_Val;
-
-   block_size = fsig_Input->GetValidBlockSize();
-
-   fsig_Output->SetValidBlockSize(block_size);
-   fsig_Phase_Error->SetValidBlockSize(block_size);
-   fsig_Filtered_Error->SetValidBlockSize(block_size);
-   fsig_Osc_Output->SetValidBlockSize(block_size);
-   fsig_Osc_Freq->SetValidBlockSize(block_size);
-   fsig_Osc_Phase->SetValidBlockSize(block_size);
-
-   //-------------------------------------------------------
+   osc_output = OscOutput;
 
    for (is=0; is<block_size; is++)
    {
-      *fsOscOutput_ptr++ = osc_output_val;
+      if(Diag_Mask & LOOP_DIAG_OSC_OUTPUT)
+         *fsOscOutput_ptr++ = osc_output_val;
       input_val = *fsInput_ptr;
-      phase_error = K_Sub_D * input_val * OscOutput;
-      *fsPhaseError_ptr++ = phase_error;
+      phase_error = K_Sub_D * input_val * osc_output;
+      if(Diag_Mask & LOOP_DIAG_PHASE_ERROR)
+         *fsPhaseError_ptr++ = phase_error;
 
       //--------------------------------
       //  filter the error signal
 
-      filt_val = Filter_Core->ProcessSample(phase_error);
-      *fs_filtered_error_ptr++ = filt_val;
+      filt_val = Filter->ProcessSample(phase_error);
+      if(Diag_Mask & LOOP_DIAG_FILT_ERROR)
+         *fs_filtered_error_ptr++ = filt_val;
 
       //---------------------------------------
       //  just for educational purposes, 
@@ -164,38 +201,37 @@ int LinearPLL::Execute()
       // use filtered error signal to drive VCO
 
       inst_freq = Omega_Sub_0 + K_Sub_0 * filt_val;
-      Phi_Sub_2 += inst_freq * samp_intvl;
-      if(Phi_Sub_2 > PI) Phi_Sub_2 -= TWO_PI;
+      Osc->Advance(inst_freq * samp_intvl);
 
       if(m_UsingDco) // make discrete valued output
       {
-         if( (Phi_Sub_2 < -PI_OVER_TWO) || (Phi_Sub_2 > PI_OVER_TWO))
+         phi_sub_2 = Osc->GetPhase();
+         if( (phi_sub_2 < -PI_OVER_TWO) || (phi_sub_2 > PI_OVER_TWO))
          {
-            OscOutput = -1;
+            osc_output = -1;
          }
          else
          {
-            OscOutput = 1;
+            osc_output = 1;
          }
       }
       else // simulate analog VCO output
       {
-         OscOutput = cos(Phi_Sub_2);
+         osc_output = Osc->Cos();
       }
 
-      *fsOscPhase_ptr++ = Phi_Sub_2;
-      *fsOscFreq_ptr++ = inst_freq/TWO_PI;
+      if(Diag_Mask & LOOP_DIAG_OSC_PHASE)
+         *fsOscPhase_ptr++ = Osc->GetPhase();
+      if(Diag_Mask & LOOP_DIAG_OSC_FREQ)
+         *fsOscFreq_ptr++ = inst_freq/TWO_PI;
 
-      Phi_Divided += inst_freq * samp_intvl/Scaler_Divisor;
-      if(Phi_Divided > PI) Phi_Divided -= TWO_PI;
-      *fsOutput_ptr++ = sin(Phi_Divided);
+      Divided_Osc->Advance(inst_freq * samp_intvl/Scaler_Divisor);
+      *fsOutput_ptr++ = Divided_Osc->Sin();
 
       fsInput_ptr++;
    }
    err_avg = err_sum / block_size;
    BasicResults << "avg PLL error = " << err_avg << endl;
+   OscOutput = osc_output;
    Osc_Output_Prev_Val = osc_output_val;
-
-  return(_MES_AOK);
 }
-
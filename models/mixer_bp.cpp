@@ -8,6 +8,7 @@
 #include "mixer_bp.h"
 #include "misdefs.h"
 #include "model_graph.h"
+#include "cmpx_kernels.h"
 extern ParmFile *ParmInput;
 extern int PassNumber;
 #ifdef _DEBUG
@@ -59,9 +60,6 @@ int BandpassMixer::Execute()
   float *out_sig_ptr;
   float *in_sig_1_ptr;
   float *in_sig_2_ptr;
-  float in_val_1, in_val_2;
-  float out_val;
-  int is;
   int block_size;
 
   #ifdef _DEBUG
@@ -74,15 +72,7 @@ int BandpassMixer::Execute()
   out_sig_ptr = GET_OUTPUT_PTR( Out_Sig );
   Out_Sig->SetValidBlockSize(block_size);
 
-  for (is=0; is<block_size; is++)
-    {
-    in_val_1 = *in_sig_1_ptr++;
-    in_val_2 = *in_sig_2_ptr++;
-
-    out_val = in_val_1 * in_val_2;
-
-    *out_sig_ptr++ = out_val;
-    }
+  FloatMultiply( in_sig_1_ptr, in_sig_2_ptr, out_sig_ptr, block_size );
   return(_MES_AOK);
 }
 
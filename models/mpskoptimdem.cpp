@@ -52,7 +52,11 @@ MpskOptimalDemod::MpskOptimalDemod(
 
 }
 //======================================================
-MpskOptimalDemod::~MpskOptimalDemod( void ){ };
+MpskOptimalDemod::~MpskOptimalDemod( void )
+{
+   delete Kernel;
+   delete[] Dump_Val;
+};
 
 //======================================================
 void MpskOptimalDemod::Initialize(void)
@@ -72,6 +76,9 @@ void MpskOptimalDemod::Initialize(void)
        -float(sin(TWO_PI * 
        isymb/double(Num_Diff_Symbs))));
     }
+  Kernel = new k_IntegrateAndDump< std::complex<float> >(Block_Size);
+  Kernel->Initialize();
+  Dump_Val = new std::complex<float>[Block_Size];
 }
 //======================================================
 int MpskOptimalDemod::Execute()
@@ -79,10 +86,8 @@ int MpskOptimalDemod::Execute()
    byte_t *out_sig_ptr;
    std::complex<float> *in_sig_ptr;
    bit_t *symb_clock_in_ptr;
-   std::complex<float> in_val;
-   double *integ_val;
    double max_val=0.0;
-   int is;
+   int is, num_dumps;
    int block_size;
    byte_t isymb, symb_decis;
 #ifdef _DEBUG
@@ -98,36 +103,32 @@ int MpskOptimalDemod::Execute()
    Out_Sig->SetValidBlockSize(block_size/
                               Samps_Per_Symb);
 
-   integ_val = Integ_Val;
-
-   for (is=0; is<block_size; is++){
-      in_val = *in_sig_ptr++;
-
-      // correlate input signal against all possible
-      // reference phases
+   // Correlation against each reference phase is linear
+   // in the input, so the input is integrated once per
+   // symbol and the integrated value is correlated against
+   // the references at decision time.
+   num_dumps = Kernel->Execute( in_sig_ptr,
+                                symb_clock_in_ptr,
+                                block_size,
+                                Dump_Val,
+                                NULL );
+
+   for (is=0; is<num_dumps; is++){
+      // time to make a decision
       for( isymb=0; isymb<Num_Diff_Symbs; isymb++){
-         Integ_Val[isymb] += std::real(in_val * 
+         Integ_Val[isymb] = std::real(Dump_Val[is] * 
                               Conj_Ref[isymb]);
       }
-
-      if(*symb_clock_in_ptr != 0){
-         // time to make a decision
-         max_val = Integ_Val[0];
-         symb_decis = 0;
-         for(isymb=1; isymb<Num_Diff_Symbs; isymb++){
-            if(Integ_Val[isymb] > max_val){
-               max_val = Integ_Val[isymb];
-               symb_decis = isymb;
-            }
-         }
-         *out_sig_ptr = symb_decis;
-         out_sig_ptr++;
-
-         for(isymb=0; isymb<Num_Diff_Symbs; isymb++){
-            Integ_Val[isymb] = 0.0;
+      max_val = Integ_Val[0];
+      symb_decis = 0;
+      for(isymb=1; isymb<Num_Diff_Symbs; isymb++){
+         if(Integ_Val[isymb] > max_val){
+            max_val = Integ_Val[isymb];
+            symb_decis = isymb;
          }
       }
-      symb_clock_in_ptr++;
+      *out_sig_ptr = symb_decis;
+      out_sig_ptr++;
    }
    return(_MES_AOK);
 }
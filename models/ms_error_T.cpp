@@ -132,6 +132,6 @@ int MeanSquareError<T>::Execute()
 
 }
 //template MeanSquareError< int >;
-template MeanSquareError< float >;
+template class MeanSquareError< float >;
 //template MeanSquareError< bit_t >;
 
@@ -81,6 +81,7 @@ int GaussianNoiseGenerator::Execute(void)
 
   // put back variables that have changed
   Seed = seed;
+  Noise_Sig->SetValidBlockSize(Proc_Block_Size);
 
   //----------------------------------------------
 
@@ -8,6 +8,7 @@
 #include "parmfile.h"
 #include "nonlinear_amp.h"
 #include "model_graph.h"
+#include "cmpx_kernels.h"
 extern ParmFile *ParmInput;
 
 //======================================================
@@ -58,6 +59,8 @@ void NonlinearAmplifier::Initialize(void)
 {
   double samp_intvl = Out_Sig->GetSampIntvl();
   Out_Avg_Block_Size = Out_Sig->GetBlockSize();
+  Amp_Sqrd_Buf.resize(In_Sig->GetBlockSize());
+  Phase_Buf.resize(In_Sig->GetBlockSize());
 }
 //======================================================
 NonlinearAmplifier::~NonlinearAmplifier( void ){ };
@@ -66,8 +69,7 @@ NonlinearAmplifier::~NonlinearAmplifier( void ){ };
 int NonlinearAmplifier::Execute()
 {
    complex<float>  *out_sig_ptr, out_sig;
-   complex<float>  *in_sig_ptr, in_sig;
-   complex<float>  agc_in_sig;
+   complex<float>  *in_sig_ptr;
    float power, power_out;
    float input_phase;
    double phase_shift;
@@ -89,10 +91,17 @@ int NonlinearAmplifier::Execute()
    sum_in = 0.0;
    sum_out = 0.0;
 
+   if(int(Amp_Sqrd_Buf.size()) < block_size){
+      Amp_Sqrd_Buf.resize(block_size);
+      Phase_Buf.resize(block_size);
+   }
+   // envelope and phase of the whole block first; only
+   // the curve lookups are left in the per-sample loop
+   CmpxMagSquared(in_sig_ptr, &Amp_Sqrd_Buf[0], block_size);
+   CmpxPhase(in_sig_ptr, &Phase_Buf[0], block_size);
+
    for(is=0; is<block_size; is++){
-      in_sig = *in_sig_ptr++;
-      agc_in_sig = in_sig;
-      amp_sqrd = std::norm(agc_in_sig);
+      amp_sqrd = Amp_Sqrd_Buf[is];
       sum_in += amp_sqrd;
       power = float(0.5 * Input_Power_Scale_Factor *
                      amp_sqrd);
@@ -100,7 +109,7 @@ int NonlinearAmplifier::Execute()
          input_phase = 0.0;
       }
       else{
-         input_phase = std::arg(agc_in_sig);
+         input_phase = Phase_Buf[is];
       }
       power_out = float(Output_Power_Scale_Factor *
                      Am_Am_Curve->GetValue(power));
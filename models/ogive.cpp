@@ -138,4 +138,4 @@ int OgiveBuilder<T>::Execute()
 
 }
 //template HistogramBuilder<std::complex<float> >;
-template OgiveBuilder<float>;
+template class OgiveBuilder<float>;
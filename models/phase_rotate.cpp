@@ -10,6 +10,7 @@
 #include "phase_rotate.h"
 #include "model_graph.h"
 #include "sinc.h"
+#include "cmpx_kernels.h"
 extern ParmFile *ParmInput;
 extern PracSimModel *ActiveModel;
 
@@ -60,18 +61,13 @@ int PhaseRotate::Execute()
 {
   std::complex<float> *out_sig_ptr;
   std::complex<float> *in_sig_ptr;
-  int is;
 
   out_sig_ptr = GET_OUTPUT_PTR( Out_Sig );
   in_sig_ptr = GET_INPUT_PTR( In_Sig );
 
-  //-------------------------------------------------------
-  //  compute outputs that use inputs from previous block
+  Out_Sig->SetValidBlockSize(Block_Size);
 
-  for (is=0; is<Block_Size; is++)
-    {
-    *out_sig_ptr++ = Rotate_Val * (*in_sig_ptr++);
-    }
+  CmpxScaleRotate( in_sig_ptr, Rotate_Val, out_sig_ptr, Block_Size );
 
   return(_MES_AOK);
 }
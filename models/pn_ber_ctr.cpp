@@ -0,0 +1,85 @@
+//
+//  File = pn_ber_ctr.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include "parmfile.h"
+#include "pn_ber_ctr.h"
+#include "typedefs.h"
+#include "model_graph.h"
+#include "syst_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+extern SystemGraph CommSystemGraph;
+extern int PassNumber;
+using namespace std;
+
+//======================================================
+
+PnBerCounter::PnBerCounter( char* instance_name,
+                            PracSimModel* outer_model,
+                            Signal<bit_t>* in_signal )
+            :PracSimModel(instance_name,
+                          outer_model)
+{
+  MODEL_NAME(PnBerCounter);
+  In_Sig = in_signal;
+
+  OPEN_PARM_BLOCK;
+  Pn_Poly = GetPnPolyParm("Pn_Poly\0");
+  Pn_Degree = 0;
+  if(Pn_Poly == PN_POLY_SIMPLEST)
+    {
+    GET_INT_PARM(Pn_Degree);
+    }
+  GET_INT_PARM(Num_Holdoff_Passes);
+  GET_INT_PARM(Report_Intvl_In_Blocks);
+  GET_INT_PARM(Sync_Window_Len);
+  GET_INT_PARM(Max_Window_Errs);
+
+  MAKE_INPUT(In_Sig);
+
+  pn_word_t fb_taps = PnFeedbackTaps(Pn_Poly, &Pn_Degree);
+  Checker = new PnSyncChecker( Pn_Degree,
+                               fb_taps,
+                               Sync_Window_Len,
+                               Max_Window_Errs );
+}
+//======================================================
+PnBerCounter::~PnBerCounter( void )
+{
+  delete Checker;
+};
+
+//======================================================
+void PnBerCounter::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+};
+
+//======================================================
+int PnBerCounter::Execute()
+{
+  bit_t *bits_in;
+  long long bit_count, error_count;
+
+  if(PassNumber <= Num_Holdoff_Passes ) return(_MES_AOK);
+
+  bits_in = GET_INPUT_PTR( In_Sig );
+  Checker->Check(bits_in, Block_Size);
+
+  if( ((PassNumber - Num_Holdoff_Passes) % Report_Intvl_In_Blocks) == 0)
+    {
+    bit_count = Checker->GetBitsChecked();
+    error_count = Checker->GetErrorCount();
+    BasicResults << GetInstanceName() << ": " << PassNumber << "  BER = "
+                 << (bit_count > 0 ? double(error_count)/double(bit_count) : 0.0)
+                 << " -- " << double(error_count) << " errors in "
+                 << double(bit_count) << " bits" << endl;
+    BasicResults << "sync losses = " << Checker->GetNumSyncLosses()
+                 << (Checker->IsInSync() ? "" : "  (out of sync)") << endl;
+    }
+  return(_MES_AOK);
+}
+
@@ -0,0 +1,71 @@
+//
+//  File = pn_bitgen.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include "pn_bitgen.h"
+#include "parmfile.h"
+#include "model_graph.h"
+#include "sigstuff.h"
+#include "syst_graph.h"
+
+extern ParmFile *ParmInput;
+extern SystemGraph CommSystemGraph;
+#ifdef _DEBUG
+  extern ofstream *DebugFile;
+#endif
+
+
+//======================================================
+
+PnBitGener::PnBitGener( char* instance_name,
+                        PracSimModel* outer_model,
+                        Signal<bit_t>* out_sig )
+          :PracSimModel( instance_name,
+                         outer_model )
+{
+  MODEL_NAME(PnBitGener);
+  Out_Sig = out_sig;
+  OPEN_PARM_BLOCK;
+
+  Pn_Poly = GetPnPolyParm("Pn_Poly\0");
+  Pn_Degree = 0;
+  if(Pn_Poly == PN_POLY_SIMPLEST)
+    {
+    GET_INT_PARM(Pn_Degree);
+    }
+  GET_LONG_PARM(Initial_State);
+
+  pn_word_t fb_taps = PnFeedbackTaps(Pn_Poly, &Pn_Degree);
+  Pn_Gen = new PnSequence(Pn_Degree, fb_taps);
+  Pn_Gen->SetState(pn_word_t(Initial_State));
+
+  MAKE_OUTPUT(Out_Sig);
+}
+//====================================================
+PnBitGener::~PnBitGener( void )
+{
+  delete Pn_Gen;
+};
+//====================================================
+void PnBitGener::Initialize(void)
+{
+  #ifdef _DEBUG
+    *DebugFile << "Now in PnBitGener::Initialize()" << endl;
+  #endif
+
+  Block_Size = Out_Sig->GetBlockSize();
+}
+//====================================================
+int PnBitGener::Execute()
+{
+  bit_t *bits_out;
+
+  Out_Sig->SetValidBlockSize(Block_Size);
+  bits_out = GET_OUTPUT_PTR(Out_Sig);
+
+  Pn_Gen->GenerateBits(bits_out, Block_Size);
+  return(_MES_AOK);
+}
+
@@ -60,6 +60,11 @@ PolarFreqDomainFilter::PolarFreqDomainFilter( char* instance_name,
    SET_SAMP_INTVL(Out_Sig, Dt_For_Fft);
    SET_BLOCK_SIZE(Out_Sig, Block_Size);
 
+   if(Bypass_Enabled){
+      DECLARE_PASS_THRU(In_Sig, Out_Sig);
+      DECLARE_BLOCK_ALIAS(In_Sig, Out_Sig);
+   }
+
    //SET_DELAY( In_Sig, Out_Sig, Group_Delay_Offset);
 
 }
@@ -333,6 +338,16 @@ int PolarFreqDomainFilter::Execute()
    valid_block_size = In_Sig->GetValidBlockSize();
    Out_Sig->SetValidBlockSize(valid_block_size);
 
+   //--------------------------------------
+   //  A bypassed filter would just FFT and IFFT the input,
+   //  so the output is read directly from the input instead.
+
+   if(Bypass_Enabled)
+   {
+      Out_Sig->AliasBlock(In_Sig);
+      return(_MES_AOK);
+   }
+
    //--------------------------------------
 
    memcpy(Full_Buffer, in_sig_ptr, Block_Size*sizeof(std::complex<float>));
@@ -358,15 +373,12 @@ int PolarFreqDomainFilter::Execute()
    // transform block of input samples
    FftDitNipo( Full_Buffer, Fft_Size);
 
-   if(!Bypass_Enabled)
+   // multiply by sampled frequency response
+   for( is=0; is<Fft_Size; is++)
    {
-      // multiply by sampled frequency response
-      for( is=0; is<Fft_Size; is++)
-      {
-         phase = std::arg(Full_Buffer[is]) + RAD_PER_DEG*Phase_Resp[is];
-         magnitude = std::abs(Full_Buffer[is]) * Mag_Resp[is];
-         Full_Buffer[is]=std::complex<float>(magnitude*cos(phase), magnitude*sin(phase));
-      }
+      phase = std::arg(Full_Buffer[is]) + RAD_PER_DEG*Phase_Resp[is];
+      magnitude = std::abs(Full_Buffer[is]) * Mag_Resp[is];
+      Full_Buffer[is]=std::complex<float>(magnitude*cos(phase), magnitude*sin(phase));
    }
 
    // transform back to time domain
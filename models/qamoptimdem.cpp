@@ -69,7 +69,11 @@ QamOptimalDemod::QamOptimalDemod( char* instance_name,
 
 }
 //==============================================
-QamOptimalDemod::~QamOptimalDemod( void ){ };
+QamOptimalDemod::~QamOptimalDemod( void )
+{
+  delete Kernel;
+  delete[] Dump_Val;
+};
 //==============================================
 
 void QamOptimalDemod::Initialize(void)
@@ -77,9 +81,9 @@ void QamOptimalDemod::Initialize(void)
   Block_Size = In_Sig->GetBlockSize();
   Out_Samp_Intvl = Out_Sig->GetSampIntvl();
 
-  I_Integ_Val = 0.0;
-  Q_Integ_Val = 0.0;
-
+  Kernel = new k_IntegrateAndDump< std::complex<float> >(Block_Size);
+  Kernel->Initialize();
+  Dump_Val = new std::complex<float>[Block_Size];
 }
 
 //============================================
@@ -89,10 +93,8 @@ int QamOptimalDemod::Execute()
   byte_t i_decis, q_decis;
   std::complex<float> *in_sig_ptr;
   bit_t *symb_clock_in_ptr;
-  std::complex<float> in_val;
   double i_integ_val, q_integ_val;
-  double max_val=0.0;
-  int is;
+  int is, num_dumps;
   byte_t isymb, symb_decis;
   #ifdef _DEBUG
     *DebugFile << "In QamOptimalDemod::Execute\0" << endl;
@@ -102,44 +104,41 @@ int QamOptimalDemod::Execute()
   symb_clock_in_ptr = GET_INPUT_PTR( Symb_Clock_In );
   out_sig_ptr = GET_OUTPUT_PTR( Out_Sig );
 
-  i_integ_val = I_Integ_Val;
-  q_integ_val = Q_Integ_Val;
+  //-------------------------------------------------------
+  //  I and Q are integrated together as one complex
+  //  integrate-and-dump; the partial symbol at the end of
+  //  the block is carried over by the kernel.
 
-  for (is=0; is<Block_Size; is++)
+  num_dumps = Kernel->Execute( in_sig_ptr,
+                               symb_clock_in_ptr,
+                               Block_Size,
+                               Dump_Val,
+                               NULL );
+
+  for (is=0; is<num_dumps; is++)
     {
-    in_val = *in_sig_ptr++;
+    // time to make a decision
 
-    I_Integ_Val += std::real(in_val);
-    Q_Integ_Val += std::imag(in_val);
+    i_integ_val = std::real(Dump_Val[is]);
+    q_integ_val = std::imag(Dump_Val[is]);
 
-    if(*symb_clock_in_ptr != 0)
+    i_decis = 0;
+    for(isymb=0; isymb<Num_Symb_Rows-1; isymb++)
       {
-      // time to make a decision
-
-      i_decis = 0;
-      for(isymb=0; isymb<Num_Symb_Rows-1; isymb++)
-        {
-        if(I_Integ_Val < I_Boundary[isymb]) break;
-        i_decis++;
-        }
-
-      q_decis = 0;
-      for(isymb=0; isymb<Num_Symb_Rows-1; isymb++)
-        {
-        if(Q_Integ_Val < Q_Boundary[isymb]) break;
-        q_decis++;
-        }
-
-      symb_decis = q_decis + Num_Symb_Rows * i_decis;
-      *out_sig_ptr = symb_decis;
-      out_sig_ptr++;
-
-      I_Integ_Val = 0.0;
-      Q_Integ_Val = 0.0;
+      if(i_integ_val < I_Boundary[isymb]) break;
+      i_decis++;
       }
-    symb_clock_in_ptr++;
+
+    q_decis = 0;
+    for(isymb=0; isymb<Num_Symb_Rows-1; isymb++)
+      {
+      if(q_integ_val < Q_Boundary[isymb]) break;
+      q_decis++;
+      }
+
+    symb_decis = q_decis + Num_Symb_Rows * i_decis;
+    *out_sig_ptr++ = symb_decis;
     }
-  //Integ_Val = integ_val;
   return(_MES_AOK);
 }
 
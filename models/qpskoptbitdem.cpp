@@ -62,7 +62,12 @@ QpskOptimalBitDemod::QpskOptimalBitDemod( char* instance_name,
 
 }
 //==============================================
-QpskOptimalBitDemod::~QpskOptimalBitDemod( void ){ };
+QpskOptimalBitDemod::~QpskOptimalBitDemod( void )
+{
+  delete Kernel;
+  delete[] Correl_Buf;
+  delete[] Dump_Val;
+};
 //==============================================
 
 void QpskOptimalBitDemod::Initialize(void)
@@ -83,6 +88,10 @@ void QpskOptimalBitDemod::Initialize(void)
     {
     Constel_Offset_Rot = std::complex<float>(1.0, 0.0);
     }
+  Kernel = new k_IntegrateAndDump< std::complex<float> >(Block_Size);
+  Kernel->Initialize();
+  Correl_Buf = new std::complex<float>[Block_Size];
+  Dump_Val = new std::complex<float>[Block_Size];
 }
 
 //============================================
@@ -92,15 +101,12 @@ int QpskOptimalBitDemod::Execute()
   bit_t *q_decis_out_ptr;
   std::complex<float> *in_sig_ptr;
   bit_t *symb_clock_in_ptr;
-  std::complex<float> in_val;
   std::complex<float> constel_offset_rot;
-  std::complex<float> correl_ref;
   std::complex<float> *carrier_ref_sig_ptr;
-  std::complex<float> carrier_val;
-  float correl_val;
+  std::complex<float> *correl_buf;
   double *integ_val;
   double max_val=0.0;
-  int is;
+  int is, num_dumps;
   byte_t isymb, symb_decis;
   #ifdef _DEBUG
     *DebugFile << "In QpskOptimalBitDemod::Execute\0" << endl;
@@ -113,71 +119,66 @@ int QpskOptimalBitDemod::Execute()
   q_decis_out_ptr = GET_OUTPUT_PTR( Q_Decis_Out );
 
   constel_offset_rot = Constel_Offset_Rot;
-  std::complex<float> cmpx_j = std::complex<float>(0.0,-1.0);
+  correl_buf = Correl_Buf;
   integ_val = Integ_Val;
 
+  //-------------------------------------------------------
+  //  Correlating against s0 gives the real part of
+  //  in_val * conj(offset * carrier) and correlating against
+  //  s1 gives the imaginary part; s2 and s3 are just the
+  //  negatives of these.  So a single complex integrate-and-
+  //  dump of the product yields all four correlations.
+
   for (is=0; is<Block_Size; is++)
     {
-    in_val = *in_sig_ptr++;
-    carrier_val = *carrier_ref_sig_ptr++;
-
-    correl_ref = std::conj(constel_offset_rot * carrier_val);
-
-    // correlate against s0
-    correl_val = std::real(in_val * correl_ref);
-    integ_val[0] += correl_val;
+    correl_buf[is] = in_sig_ptr[is] *
+                     std::conj(constel_offset_rot * carrier_ref_sig_ptr[is]);
+    }
 
-    // correlate against s2
-    integ_val[2] -= correl_val;
+  num_dumps = Kernel->Execute( correl_buf,
+                               symb_clock_in_ptr,
+                               Block_Size,
+                               Dump_Val,
+                               NULL );
 
-    // correlate against s1
-    correl_ref *= cmpx_j;
-    correl_val = std::real(in_val * correl_ref);
-    integ_val[1] += correl_val;
+  for (is=0; is<num_dumps; is++)
+    {
+    // time to make a decision
 
-    // correlate against s3
-    integ_val[3] -= correl_val;
+    integ_val[0] = std::real(Dump_Val[is]);
+    integ_val[1] = std::imag(Dump_Val[is]);
+    integ_val[2] = -integ_val[0];
+    integ_val[3] = -integ_val[1];
 
-    if(*symb_clock_in_ptr != 0)
+    max_val = integ_val[0];
+    symb_decis = 0;
+    for(isymb=1; isymb<4; isymb++)
       {
-      // time to make a decision
-
-      max_val = Integ_Val[0];
-      symb_decis = 0;
-      for(isymb=1; isymb<4; isymb++)
+      if(integ_val[isymb] > max_val)
         {
-        if(integ_val[isymb] > max_val)
-          {
-          max_val = integ_val[isymb];
-          symb_decis = isymb;
-          }
-        }
-      switch (symb_decis)
-        {
-        case 0:
-          *i_decis_out_ptr++ = 1;
-          *q_decis_out_ptr++ = 1;
-          break;
-        case 1:
-          *i_decis_out_ptr++ = 0;
-          *q_decis_out_ptr++ = 1;
-          break;
-        case 2:
-          *i_decis_out_ptr++ = 0;
-          *q_decis_out_ptr++ = 0;
-          break;
-        case 3:
-          *i_decis_out_ptr++ = 1;
-          *q_decis_out_ptr++ = 0;
-          break;
-        }
-
-      for(isymb=0; isymb<4; isymb++)
-        {
-        integ_val[isymb] = 0.0;
+        max_val = integ_val[isymb];
+        symb_decis = isymb;
         }
       }
-    symb_clock_in_ptr++;
+    switch (symb_decis)
+      {
+      case 0:
+        *i_decis_out_ptr++ = 1;
+        *q_decis_out_ptr++ = 1;
+        break;
+      case 1:
+        *i_decis_out_ptr++ = 0;
+        *q_decis_out_ptr++ = 1;
+        break;
+      case 2:
+        *i_decis_out_ptr++ = 0;
+        *q_decis_out_ptr++ = 0;
+        break;
+      case 3:
+        *i_decis_out_ptr++ = 1;
+        *q_decis_out_ptr++ = 0;
+        break;
+      }
     }
   return(_MES_AOK);
 }
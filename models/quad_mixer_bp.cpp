@@ -8,6 +8,7 @@
 #include "quad_mixer_bp.h"
 #include "misdefs.h"
 #include "model_graph.h"
+#include "cmpx_kernels.h"
 extern ParmFile *ParmInput;
 extern int PassNumber;
 #ifdef _DEBUG
@@ -67,9 +68,6 @@ int QuadBandpassMixer::Execute()
   float *in_sig_ptr;
   float *i_ref_sig_ptr;
   float *q_ref_sig_ptr;
-  float in_val, i_ref_val, q_ref_val;
-  float i_out_val, q_out_val;
-  int is;
 
   #ifdef _DEBUG
     *DebugFile << "In QuadBandpassMixer::Execute\0" << endl;
@@ -81,18 +79,8 @@ int QuadBandpassMixer::Execute()
   i_out_sig_ptr = GET_OUTPUT_PTR( I_Out_Sig );
   q_out_sig_ptr = GET_OUTPUT_PTR( Q_Out_Sig );
 
-  for (is=0; is<Block_Size; is++)
-    {
-    in_val = *in_sig_ptr++;
-    i_ref_val = *i_ref_sig_ptr++;
-    q_ref_val = *q_ref_sig_ptr++;
-
-    i_out_val = in_val * i_ref_val;
-    q_out_val = in_val * q_ref_val;
-
-    *i_out_sig_ptr++ = i_out_val;
-    *q_out_sig_ptr++ = q_out_val;
-    }
+  FloatMultiply( in_sig_ptr, i_ref_sig_ptr, i_out_sig_ptr, Block_Size );
+  FloatMultiply( in_sig_ptr, q_ref_sig_ptr, q_out_sig_ptr, Block_Size );
   return(_MES_AOK);
 }
 
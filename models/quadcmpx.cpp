@@ -12,6 +12,7 @@
 #include "syst_graph.h"
 #include "misdefs.h"
 #include "gensig.h"
+#include "cmpx_kernels.h"
 extern ParmFile ParmInput;
 extern SystemGraph CommSystGraph;
 #ifdef _DEBUG
@@ -54,8 +55,7 @@ void QuadratureToComplex::Initialize(void)
 int QuadratureToComplex::Execute(void)
 {
   float *i_in_sig, *q_in_sig;
-  std::complex<float> *out_sig, out_val;
-  int is;
+  std::complex<float> *out_sig;
   int block_size;
 
   *DebugFile << "In QuadratureToComplex::Execute\0" << endl;
@@ -65,13 +65,7 @@ int QuadratureToComplex::Execute(void)
   block_size = I_In_Sig->GetValidBlockSize();
   Out_Sig->SetValidBlockSize(block_size);
 
-  for (is=0; is<block_size; is++)
-    {
-    *out_sig = std::complex<float>(*i_in_sig, *q_in_sig);
-    out_sig++;
-    i_in_sig++;
-    q_in_sig++;
-    }
+  CmpxInterleave( i_in_sig, q_in_sig, out_sig, block_size );
   return(_MES_AOK);
 }
 
@@ -9,6 +9,7 @@
 #include "misdefs.h"
 #include "model_graph.h"
 #include "typedefs.h"
+#include "cmpx_kernels.h"
 extern ParmFile *ParmInput;
 
 //========================================================================
@@ -45,6 +46,7 @@ QuadratureDemod::~QuadratureDemod( void ){ };
 void QuadratureDemod::Initialize(void)
 {
   Block_Size = In_Sig->GetBlockSize();
+  Mixed_Buf.resize(Block_Size);
 }
 
 //============================================
@@ -53,8 +55,6 @@ int QuadratureDemod::Execute(void)
   float *i_wave_out_ptr, *q_wave_out_ptr;
   std::complex<float> *in_sig_ptr;
   std::complex<float> *carrier_ref_sig_ptr;
-  std::complex<float> in_val, carrier_val, correl_ref;
-  int is;
 
   I_Wave_Out->SetValidBlockSize(Block_Size);
   Q_Wave_Out->SetValidBlockSize(Block_Size);
@@ -64,22 +64,12 @@ int QuadratureDemod::Execute(void)
   i_wave_out_ptr = GET_OUTPUT_PTR( I_Wave_Out );
   q_wave_out_ptr = GET_OUTPUT_PTR( Q_Wave_Out );
 
-  std::complex<float> cmpx_j = std::complex<float>(0.0,-1.0);
+  //  mixing with the I subcarrier conj(c) and the Q
+  //  subcarrier -j*conj(c) gives the real and imaginary
+  //  parts of the same product
+  CmpxConjMultiply( in_sig_ptr, carrier_ref_sig_ptr, &Mixed_Buf[0], Block_Size );
+  CmpxDeinterleave( &Mixed_Buf[0], i_wave_out_ptr, q_wave_out_ptr, Block_Size );
 
-  for (is=0; is<Block_Size; is++)
-    {
-    in_val = *in_sig_ptr++;
-    carrier_val = *carrier_ref_sig_ptr++;
-
-    //  mix with I subcarrier
-    correl_ref = std::conj(carrier_val);
-    *i_wave_out_ptr++ = std::real(in_val * correl_ref);
-
-    //  mix with Q subcarrier
-    correl_ref *= cmpx_j;
-    *q_wave_out_ptr++ = std::real(in_val * correl_ref);
-
-    }
   return(_MES_AOK);
 }
 
@@ -8,6 +8,7 @@
 #include "misdefs.h"
 #include "model_graph.h"
 #include "typedefs.h"
+#include "cmpx_kernels.h"
 extern ParmFile *ParmInput;
 
 //========================================================================
@@ -95,8 +96,8 @@ void QuadratureModulator::Initialize(void)
 int QuadratureModulator::Execute(void)
 {
   float *i_in_sig_ptr, *q_in_sig_ptr;
-  float i_out, q_out;
   float *phase_out_sig_ptr, *mag_out_sig_ptr;
+  float *out_ptr;
   double real_unbal, imag_unbal;
   std::complex<float> *cmpx_out_sig_ptr;
   int is;
@@ -121,27 +122,32 @@ int QuadratureModulator::Execute(void)
 
   real_unbal = Real_Unbal;
   imag_unbal = Imag_Unbal;
-  //cout << "real_unbal = " << real_unbal << endl;
-  //cout << "imag_unbal = " << imag_unbal << endl;
 
-  for (is=0; is<block_size; is++)
+  if(real_unbal == 1.0 && imag_unbal == 0.0)
     {
-    i_out = (*i_in_sig_ptr) - (imag_unbal * (*q_in_sig_ptr));
-    q_out = real_unbal * (*q_in_sig_ptr);
-    //i_out *= 1.4;
-    //q_out *= 1.4;
-    *cmpx_out_sig_ptr++ = std::complex<float>( i_out, q_out);
+    CmpxInterleave( i_in_sig_ptr, q_in_sig_ptr, cmpx_out_sig_ptr, block_size );
+    }
+  else
+    {
+    // written as plain arithmetic on the interleaved output
+    // so the loop vectorizes; the unbalance is applied in
+    // double as before
+    out_ptr = (float*)cmpx_out_sig_ptr;
+    for (is=0; is<block_size; is++)
+      {
+      out_ptr[2*is] = float(i_in_sig_ptr[is] - imag_unbal * q_in_sig_ptr[is]);
+      out_ptr[2*is+1] = float(real_unbal * q_in_sig_ptr[is]);
+      }
+    }
 
-    if(Polar_Outputs_Enabled)
+  if(Polar_Outputs_Enabled)
+    {
+    CmpxPhase( cmpx_out_sig_ptr, phase_out_sig_ptr, block_size );
+    for (is=0; is<block_size; is++)
       {
-      *phase_out_sig_ptr++ = 180.0*atan2(q_out, i_out)/PI;
-      *mag_out_sig_ptr++ = sqrt(i_out*i_out + q_out*q_out);
+      phase_out_sig_ptr[is] *= float(180.0/PI);
       }
-    i_in_sig_ptr++;
-    q_in_sig_ptr++;
-    //cmpx_out_sig_ptr++;
-    //phase_out_sig_ptr++;
-    //mag_out_sig_ptr++;
+    CmpxMagnitude( cmpx_out_sig_ptr, mag_out_sig_ptr, block_size );
     }
   return(_MES_AOK);
 }
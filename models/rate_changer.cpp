@@ -8,7 +8,7 @@
 #include "rate_changer.h"
 #include "model_graph.h"
 #include "sinc.h"
-//#include <iomanip>
+#include <iomanip>
 extern ParmFile *ParmInput;
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -271,6 +271,6 @@ int RateChanger<T>::Execute()
   Write_Ptr = write_ptr;
   return(_MES_AOK);
 }
-template RateChanger< int >;
-template RateChanger< float >;
-template RateChanger< std::complex<float> >;
\ No newline at end of file
+template class RateChanger< int >;
+template class RateChanger< float >;
+template class RateChanger< std::complex<float> >;
\ No newline at end of file
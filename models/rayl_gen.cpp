@@ -92,4 +92,4 @@ int RayleighNoiseGenerator<T>::Execute(void)
   return(_MES_AOK);
 };
 
-template RayleighNoiseGenerator<float>;
+template class RayleighNoiseGenerator<float>;
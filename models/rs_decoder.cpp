@@ -0,0 +1,128 @@
+//
+//  File = rs_decoder.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "rs_decoder.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+extern int PassNumber;
+using namespace std;
+
+//======================================================
+
+RsDecoder::RsDecoder( char* instance_name,
+                      PracSimModel* outer_model,
+                      Signal<byte_t>* in_signal,
+                      Signal<byte_t>* out_signal )
+          :PracSimModel(instance_name,
+                        outer_model)
+{
+  MODEL_NAME(RsDecoder);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Bits_Per_Symb);
+  GET_INT_PARM(Code_Len);
+  GET_INT_PARM(Msg_Len);
+  GET_INT_PARM(Num_Holdoff_Passes);
+  GET_INT_PARM(Report_Intvl_In_Blocks);
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, double(Msg_Len)/double(Code_Len));
+  SET_BLOCK_GRANULARITY(In_Sig, Code_Len);
+
+  Field = new Gf2mField(Bits_Per_Symb);
+  Codec = new ReedSolomonCodec(Field, Code_Len, Msg_Len);
+}
+//======================================================
+RsDecoder::~RsDecoder( void )
+{
+  delete Codec;
+  delete Field;
+};
+
+//======================================================
+void RsDecoder::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  if(Block_Size % Code_Len)
+    {
+    ostrstream temp_stream;
+    temp_stream << "RsDecoder input block size " << Block_Size
+                << " is not a multiple of Code_Len" << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Num_Codewords = Block_Size/Code_Len;
+  Code_Buf.resize(Block_Size);
+  Num_Corr.resize(Num_Codewords);
+
+  Codewords_Decoded = 0;
+  Codewords_Corrected = 0;
+  Symbs_Corrected = 0;
+  Decoder_Failures = 0;
+};
+
+//======================================================
+int RsDecoder::Execute()
+{
+  byte_t *symbs_in, *symbs_out;
+  int is, iw, sym_mask;
+
+  symbs_in = GET_INPUT_PTR( In_Sig );
+  symbs_out = GET_OUTPUT_PTR( Out_Sig );
+  sym_mask = Field->GetOrder();
+
+  for(is=0; is<Block_Size; is++) Code_Buf[is] = gf_elem_t(symbs_in[is] & sym_mask);
+  Codec->DecodeBlock(&Code_Buf[0], Num_Codewords, &Num_Corr[0]);
+
+  for(iw=0; iw<Num_Codewords; iw++)
+    {
+    for(is=0; is<Msg_Len; is++)
+      {
+      symbs_out[iw*Msg_Len + is] = Code_Buf[iw*Code_Len + is];
+      }
+    }
+  Out_Sig->SetValidBlockSize(Num_Codewords*Msg_Len);
+
+  if(PassNumber <= Num_Holdoff_Passes ) return(_MES_AOK);
+
+  for(iw=0; iw<Num_Codewords; iw++)
+    {
+    if(Num_Corr[iw] < 0)
+      {
+      Decoder_Failures++;
+      }
+    else if(Num_Corr[iw] > 0)
+      {
+      Codewords_Corrected++;
+      Symbs_Corrected += Num_Corr[iw];
+      }
+    }
+  Codewords_Decoded += Num_Codewords;
+
+  if( ((PassNumber - Num_Holdoff_Passes) % Report_Intvl_In_Blocks) == 0)
+    {
+    BasicResults << GetInstanceName() << ": " << PassNumber
+                 << "  codewords = " << double(Codewords_Decoded)
+                 << "  corrected = " << double(Codewords_Corrected)
+                 << "  symbols corrected = " << double(Symbs_Corrected)
+                 << "  failures = " << double(Decoder_Failures) << endl;
+    BasicResults << "decoder failure rate = "
+                 << (Codewords_Decoded > 0 ?
+                     double(Decoder_Failures)/double(Codewords_Decoded) : 0.0)
+                 << endl;
+    }
+  return(_MES_AOK);
+}
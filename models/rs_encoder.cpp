@@ -0,0 +1,85 @@
+//
+//  File = rs_encoder.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "rs_encoder.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+using namespace std;
+
+//======================================================
+
+RsEncoder::RsEncoder( char* instance_name,
+                      PracSimModel* outer_model,
+                      Signal<byte_t>* in_signal,
+                      Signal<byte_t>* out_signal )
+          :PracSimModel(instance_name,
+                        outer_model)
+{
+  MODEL_NAME(RsEncoder);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Bits_Per_Symb);
+  GET_INT_PARM(Code_Len);
+  GET_INT_PARM(Msg_Len);
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, double(Code_Len)/double(Msg_Len));
+  SET_BLOCK_GRANULARITY(In_Sig, Msg_Len);
+
+  Field = new Gf2mField(Bits_Per_Symb);
+  Codec = new ReedSolomonCodec(Field, Code_Len, Msg_Len);
+}
+//======================================================
+RsEncoder::~RsEncoder( void )
+{
+  delete Codec;
+  delete Field;
+};
+
+//======================================================
+void RsEncoder::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  if(Block_Size % Msg_Len)
+    {
+    ostrstream temp_stream;
+    temp_stream << "RsEncoder input block size " << Block_Size
+                << " is not a multiple of Msg_Len" << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Num_Codewords = Block_Size/Msg_Len;
+  Msg_Buf.resize(Block_Size);
+  Code_Buf.resize(Num_Codewords*Code_Len);
+};
+
+//======================================================
+int RsEncoder::Execute()
+{
+  byte_t *symbs_in, *symbs_out;
+  int is, sym_mask;
+
+  symbs_in = GET_INPUT_PTR( In_Sig );
+  symbs_out = GET_OUTPUT_PTR( Out_Sig );
+  sym_mask = Field->GetOrder();
+
+  for(is=0; is<Block_Size; is++) Msg_Buf[is] = gf_elem_t(symbs_in[is] & sym_mask);
+  Codec->EncodeBlock(&Msg_Buf[0], &Code_Buf[0], Num_Codewords);
+  for(is=0; is<Num_Codewords*Code_Len; is++) symbs_out[is] = Code_Buf[is];
+
+  Out_Sig->SetValidBlockSize(Num_Codewords*Code_Len);
+  return(_MES_AOK);
+}
@@ -9,6 +9,7 @@
 #include "samp_spect.h"
 #include "fft_T.h"
 #include "dump_spect.h"
+#include "spect_result.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -16,6 +17,7 @@
 
 extern ParmFile *ParmInput;
 extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
 
 //======================================================
 
@@ -118,6 +120,12 @@ int SampleSpectrum<T>::Execute()
       // is it time to dump the results?
 //      if(Segs_In_Est == Num_Segs_To_Avg)
 //      {
+         SpectRegistry.Publish(  GetInstanceName(),
+                                 Sample_Spectrum,
+                                 Fft_Len/2,
+                                 Delta_F,
+                                 1,
+                                 1.0);
          DumpSpectrum(  Sample_Spectrum,
                         Fft_Len,
                         Delta_F,
@@ -151,4 +159,4 @@ int SampleSpectrum<T>::Execute()
    return(_MES_AOK);
 
 }
-template SampleSpectrum<float>;
+template class SampleSpectrum<float>;
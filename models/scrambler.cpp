@@ -0,0 +1,92 @@
+//
+//  File = scrambler.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include "parmfile.h"
+#include "scrambler.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+using namespace std;
+
+//======================================================
+
+Scrambler::Scrambler( char* instance_name,
+                      PracSimModel* outer_model,
+                      Signal<bit_t>* in_signal,
+                      Signal<bit_t>* out_signal )
+          :PracSimModel(instance_name,
+                        outer_model)
+{
+  pn_word_t fb_taps;
+
+  MODEL_NAME(Scrambler);
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  Scram_Mode = GetScramModeParm("Scram_Mode\0");
+  BasicResults << "   " << "Scram_Mode = " << Scram_Mode << endl;
+  Scram_Poly = GetPnPolyParm("Scram_Poly\0");
+  Scram_Degree = 0;
+  if(Scram_Poly == PN_POLY_SIMPLEST)
+    {
+    GET_INT_PARM(Scram_Degree);
+    }
+  if(Scram_Poly == PN_POLY_CUSTOM)
+    {
+    GET_HEX_PARM(Scram_Taps);
+    }
+  GET_BOOL_PARM(Self_Sync);
+  if(!Self_Sync)
+    {
+    GET_HEX_PARM(Scram_Seed);
+    }
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+
+  if(Scram_Poly == PN_POLY_CUSTOM)
+    fb_taps = PnCustomTaps(Scram_Taps, &Scram_Degree);
+  else
+    fb_taps = PnFeedbackTaps(Scram_Poly, &Scram_Degree);
+
+  Add_Scram = NULL;
+  Mult_Scram = NULL;
+  if(Self_Sync)
+    Mult_Scram = new MultiplicativeScrambler( Scram_Degree, fb_taps,
+                                   (Scram_Mode == SCRAM_MODE_DESCRAMBLE) );
+  else
+    Add_Scram = new AdditiveScrambler(Scram_Degree, fb_taps, Scram_Seed);
+}
+//======================================================
+Scrambler::~Scrambler( void )
+{
+  delete Add_Scram;
+  delete Mult_Scram;
+};
+
+//======================================================
+void Scrambler::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+};
+
+//======================================================
+int Scrambler::Execute()
+{
+  bit_t *bits_in, *bits_out;
+
+  bits_in = GET_INPUT_PTR( In_Sig );
+  bits_out = GET_OUTPUT_PTR( Out_Sig );
+
+  if(Self_Sync)
+    Mult_Scram->Process(bits_in, bits_out, Block_Size);
+  else
+    Add_Scram->Process(bits_in, bits_out, Block_Size);
+
+  return(_MES_AOK);
+}
@@ -29,7 +29,7 @@ SignalAnchor::SignalAnchor( char* instance_name,
 
   MAKE_INPUT(Complex_Signal);
   SET_SAMP_INTVL(Complex_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Complex_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Complex_Signal, block_size);
 
 }
 //====================================================
@@ -51,7 +51,7 @@ SignalAnchor::SignalAnchor( char* instance_name,
 
   MAKE_INPUT(Float_Signal);
   SET_SAMP_INTVL(Float_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Float_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Float_Signal, block_size);
 
 }
 //====================================================
@@ -73,7 +73,7 @@ SignalAnchor::SignalAnchor( char* instance_name,
 
   MAKE_INPUT(Complex_Signal);
   SET_SAMP_INTVL(Complex_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Complex_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Complex_Signal, block_size);
 
 }
 //====================================================
@@ -95,7 +95,7 @@ SignalAnchor::SignalAnchor( char* instance_name,
 
   MAKE_INPUT(Bit_Signal);
   SET_SAMP_INTVL(Bit_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Bit_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Bit_Signal, block_size);
 
 }
 //====================================================
@@ -120,9 +120,9 @@ SignalAnchor::SignalAnchor( char* instance_name,
   MAKE_INPUT(Bit_Signal);
   MAKE_INPUT(Byte_Signal);
   SET_SAMP_INTVL(Bit_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Bit_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Bit_Signal, block_size);
   SET_SAMP_INTVL(Byte_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Byte_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Byte_Signal, block_size);
 
 }
 //====================================================
@@ -140,7 +140,7 @@ SignalAnchor::SignalAnchor( char* instance_name,
 
   MAKE_INPUT(Float_Signal);
   SET_SAMP_INTVL(Float_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Float_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Float_Signal, block_size);
 
 }
 //====================================================
@@ -161,9 +161,9 @@ SignalAnchor::SignalAnchor( char* instance_name,
   MAKE_INPUT(Float_Signal);
   MAKE_INPUT(Float_Signal_2);
   SET_SAMP_INTVL(Float_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Float_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Float_Signal, block_size);
   SET_SAMP_INTVL(Float_Signal_2, samp_intvl);
-  SET_BLOCK_SIZE(Float_Signal_2, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Float_Signal_2, block_size);
 
 }
 //====================================================
@@ -180,7 +180,7 @@ SignalAnchor::SignalAnchor( char* instance_name,
 
   MAKE_INPUT(Int_Signal);
   SET_SAMP_INTVL(Int_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Int_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Int_Signal, block_size);
 
 }
 //====================================================
@@ -196,7 +196,7 @@ SignalAnchor::SignalAnchor( char* instance_name,
 
   MAKE_INPUT(Bit_Signal);
   SET_SAMP_INTVL(Bit_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Bit_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Bit_Signal, block_size);
 
 }
 //====================================================
@@ -216,9 +216,9 @@ SignalAnchor::SignalAnchor( char* instance_name,
   MAKE_INPUT(Int_Signal);
   MAKE_INPUT(Int_Signal_2);
   SET_SAMP_INTVL(Int_Signal, samp_intvl);
-  SET_BLOCK_SIZE(Int_Signal, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Int_Signal, block_size);
   SET_SAMP_INTVL(Int_Signal_2, samp_intvl);
-  SET_BLOCK_SIZE(Int_Signal_2, block_size);
+  SET_TUNABLE_BLOCK_SIZE(Int_Signal_2, block_size);
 
 }
 //===================================================
@@ -7,11 +7,13 @@
 #include "parmfile.h"
 #include "model_graph.h"
 #include "spec_analyzer.h"
-#include "hann.h"
+#include "win_cache.h"
 #include "misdefs.h"
 #include "fft_T.h"
 #include "samp_spect_util.h"
 #include "bart_pdgm_util.h"
+#include "dump_spect.h"
+#include "spect_result.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -19,6 +21,7 @@
 
 extern ParmFile *ParmInput;
 extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
 extern char *DateString;
 extern bool DateInFileNames;
 
@@ -98,12 +101,17 @@ void SpectrumAnalyzer<T>::Initialize(void)
       Spec_Estim = new SampleSpectrum<T>( Seg_Len,
                                              Fft_Len,
                                              Samp_Intvl);
+      Data_Window = GetCachedWindow( WINDOW_SHAPE_RECTANGULAR,
+                                     Seg_Len,
+                                     WINDOW_NORM_PEAK );
       break;
    case SPECT_CALC_BARTLETT_PDGM:
       Spec_Estim = new BartlettPeriodogram<T>( Seg_Len,
                                              Fft_Len,
                                              Samp_Intvl);
-      Data_Window = new HannWindow( Seg_Len, _NO_ZERO_ENDS );
+      Data_Window = GetCachedWindow( WINDOW_SHAPE_HANN,
+                                     Seg_Len,
+                                     WINDOW_NORM_PEAK );
       break;
    }
 
@@ -114,7 +122,6 @@ int SpectrumAnalyzer<T>::Execute()
 {
    int is;
    double scale_factor;
-   double *data_window;
    double total_power;
    double offset;
    #ifdef _DEBUG
@@ -144,10 +151,7 @@ int SpectrumAnalyzer<T>::Execute()
 
       //  Apply window to the time segment
 
-      data_window = Data_Window->GetDataWindow();
-      for(is=0; is<Seg_Len; is++) {
-         Time_Seg[is] *= float(*data_window++);
-      }
+      Data_Window->Apply(Time_Seg, Time_Seg);
 
       //  Perform FFT
       //FFT<double>(   Time_Seg,
@@ -199,82 +203,34 @@ int SpectrumAnalyzer<T>::Execute()
 //030726         scale_factor = Num_Segs_To_Avg;
             scale_factor = Num_Segs_To_Avg * Delta_F;
          //scale_factor = double(Seg_Len/2);
-         if(Output_In_Decibels)
+         for(is=0; is<Fft_Len/2; is++)
          {
-            if(Plot_Relative_To_Peak)
-            {
-               offset = 10.0*log10(Psd_Est[peak_idx]/scale_factor);
-            }
-            else
-            {
-               offset = 10.0*log10(1.0/scale_factor);
-            }
-
-            if(Plot_Two_Sided)
-            {
-               for(is=-(Fft_Len/2-1); is<0; is++)
-               {
-                  if( Psd_Est[-is] >0 )
-                  {
-                     if(Plot_Relative_To_Peak)
-                     {
-                        (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", " 
-                                    << (10.0*log10(Psd_Est[-is]/scale_factor)-offset) << endl;
-                     }
-                     else
-                     {
-                        (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", " 
-                                    << (10.0*log10(Psd_Est[-is]/scale_factor)) << endl;
-                     }
-                  }
-                  else
-                  {
-                     (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", -200.0" << endl;
-                  }
-               }
-            }
-
-            for(is=0; is<Fft_Len/2; is++)
-            {
-               if( Psd_Est[is] >0 )
-               {
-                  if(Plot_Relative_To_Peak)
-                  {
-                     (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", " 
-                                 << (10.0*log10(Psd_Est[is]/scale_factor)-offset) << endl;
-                  }
-                  else
-                  {
-                     (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", " 
-                                 << (10.0*log10(Psd_Est[is]/scale_factor)) << endl;
-                  }
-                  Psd_Est[is] = 0.0;
-               }
-               else
-               {
-                  (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", -200.0" << endl;
-               }
-            }
+            Psd_Est[is] /= scale_factor;
          }
-         else
+         SpectRegistry.Publish(  GetInstanceName(),
+                                 Psd_Est,
+                                 Fft_Len/2,
+                                 Delta_F,
+                                 Num_Segs_To_Avg,
+                                 Data_Window->GetEnbw());
+
+         // plotting relative to the peak puts the peak at 0 dB
+         if(Output_In_Decibels && Plot_Relative_To_Peak && peak_val > 0.0)
          {
-            // plot as linear ordinate
-            if(Plot_Two_Sided)
-            {
-               for(is=-(Fft_Len/2-1); is<0; is++)
-               {
-                  (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", " 
-                              << Psd_Est[-is]/scale_factor << endl;
-               }
-            }
-
+            offset = scale_factor/peak_val;
             for(is=0; is<Fft_Len/2; is++)
             {
-               (*Psd_File) << is * Delta_F * Freq_Norm_Factor << ", " 
-                           << Psd_Est[is]/scale_factor << endl;
-               Psd_Est[is] = 0.0;
+               Psd_Est[is] *= offset;
             }
          }
+         DumpSpectrum(  Psd_Est,
+                        Fft_Len,
+                        Delta_F,
+                        Freq_Norm_Factor,
+                        Output_In_Decibels,
+                        Plot_Two_Sided,
+                        Psd_File);
+
          Processing_Completed = true;
          Psd_File->close();
          BasicResults << Instance_Name << ": total_power = " << total_power << endl;
@@ -301,5 +257,5 @@ int SpectrumAnalyzer<T>::Execute()
    return(_MES_AOK);
 
 }
-template SpectrumAnalyzer<std::complex<float> >;
-template SpectrumAnalyzer<float>;
+template class SpectrumAnalyzer<std::complex<float> >;
+template class SpectrumAnalyzer<float>;
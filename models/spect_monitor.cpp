@@ -0,0 +1,496 @@
+//
+//  File = spect_monitor.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <string.h>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "model_graph.h"
+#include "spect_monitor.h"
+#include "fft_T.h"
+#include "spect_result.h"
+
+#ifdef _DEBUG
+  extern ofstream *DebugFile;
+#endif
+
+extern ParmFile *ParmInput;
+extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
+
+//======================================================
+
+template <class T>
+SpectrumMonitor<T>::SpectrumMonitor( char* instance_name,
+                                     PracSimModel* outer_model,
+                                     Signal<T>* in_sig )
+                :PracSimModel( instance_name,
+                               outer_model )
+{
+  MODEL_NAME(SpectrumMonitor);
+  OPEN_PARM_BLOCK;
+
+  GET_INT_PARM(Seg_Len);
+  GET_INT_PARM(Fft_Len);
+  GET_INT_PARM(Hold_Off);
+  GET_INT_PARM(Shift_Between_Segs);
+  GET_INT_PARM(Num_Workers);
+  GET_BOOL_PARM(Using_Exponential_Avg);
+  if(Using_Exponential_Avg)
+    {
+    // time constant is in segments
+    GET_DOUBLE_PARM(Exp_Avg_Time_Const);
+    Num_Segs_To_Avg = 0;
+    }
+  else
+    {
+    GET_INT_PARM(Num_Segs_To_Avg);
+    Exp_Avg_Time_Const = 0.0;
+    }
+  GET_INT_PARM(Snapshot_Interval);
+  if(Snapshot_Interval < 1)
+    {
+    ostrstream temp_stream;
+    temp_stream << "SpectrumMonitor Snapshot_Interval must be positive" << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+
+  Psd_File_Name = new char[64];
+  strcpy(Psd_File_Name, "\0");
+  GET_STRING_PARM(Psd_File_Name);
+
+  Data_Window = NULL;
+  Window_Enbw = 1.0;
+  Kaiser_Beta = 0.0;
+  GET_BOOL_PARM(Using_Window);
+  if(Using_Window)
+    {
+    Window_Shape = GetWindowShapeParm("Window_Shape\0");
+    if(Window_Shape == WINDOW_SHAPE_KAISER)
+      {
+      GET_DOUBLE_PARM(Kaiser_Beta);
+      }
+
+    // unit power taps keep the PSD level unbiased; the
+    // table is read-only so the workers can share it
+    Data_Window = GetCachedWindow( Window_Shape,
+                                   Seg_Len,
+                                   WINDOW_NORM_UNIT_POWER,
+                                   Kaiser_Beta );
+    Window_Enbw = Data_Window->GetEnbw();
+    }
+  if(Num_Workers < 1) Num_Workers = 1;
+
+  In_Sig = in_sig;
+  MAKE_INPUT(In_Sig);
+
+  Overlap_Len = Seg_Len - Shift_Between_Segs;
+  Time_Seg = new T[Seg_Len];
+  Submit_Win_Seg = new T[Seg_Len];
+  Submit_Freq_Seg = new std::complex<double>[Fft_Len];
+
+  //-------------------------------------------
+  //  segment slots shared with the workers
+
+  Num_Slots = SPECT_MON_SLOTS_PER_WORKER * Num_Workers;
+  Seg_Slots = new seg_slot_type[Num_Slots];
+  for(int islot=0; islot<Num_Slots; islot++)
+    {
+    Seg_Slots[islot].state.store(SEG_SLOT_FREE);
+    Seg_Slots[islot].seq_num = -1;
+    Seg_Slots[islot].time_seg = new T[Seg_Len];
+    Seg_Slots[islot].periodogram = new double[Fft_Len];
+    }
+
+  //-------------------------------------------
+  //  averaging buffers
+
+  Psd_Est = new double[Fft_Len];
+  Pdgm_Sum = NULL;
+  Pdgm_History = NULL;
+  if(!Using_Exponential_Avg)
+    {
+    Pdgm_Sum = new double[Fft_Len];
+    Pdgm_History = new double*[Num_Segs_To_Avg];
+    for(int ih=0; ih<Num_Segs_To_Avg; ih++)
+      {
+      Pdgm_History[ih] = new double[Fft_Len];
+      }
+    }
+
+  Psd_File = new ofstream(Psd_File_Name, ios::out | ios::binary);
+
+  Num_Pending_Segs.store(0);
+  Shutdown_Requested.store(false);
+}
+//======================================================
+//  Lets the workers finish any segments already handed
+//  to them, then issues a final snapshot.
+
+template <class T>
+SpectrumMonitor<T>::~SpectrumMonitor( void )
+{
+  int iw;
+  {
+    std::lock_guard<std::mutex> lock(Wakeup_Mutex);
+    Shutdown_Requested.store(true);
+  }
+  Wakeup_Cond.notify_all();
+  for(iw=0; iw<int(Worker_Threads.size()); iw++)
+    {
+    Worker_Threads.at(iw)->join();
+    delete Worker_Threads.at(iw);
+    }
+  HarvestSegments();
+  if(Segs_Since_Snapshot > 0) WriteSnapshot();
+  Psd_File->close();
+
+  for(int islot=0; islot<Num_Slots; islot++)
+    {
+    delete[] Seg_Slots[islot].time_seg;
+    delete[] Seg_Slots[islot].periodogram;
+    }
+  delete[] Seg_Slots;
+  delete[] Time_Seg;
+  delete[] Submit_Win_Seg;
+  delete[] Submit_Freq_Seg;
+  delete[] Psd_Est;
+  if(Pdgm_History != NULL)
+    {
+    for(int ih=0; ih<Num_Segs_To_Avg; ih++)
+      {
+      delete[] Pdgm_History[ih];
+      }
+    delete[] Pdgm_History;
+    delete[] Pdgm_Sum;
+    }
+};
+//======================================================
+template <class T>
+void SpectrumMonitor<T>::Initialize(void)
+{
+  int is, ih;
+  int header_val;
+
+  Samp_Intvl = In_Sig->GetSampIntvl();
+  Delta_F = 1.0/(Samp_Intvl*Fft_Len);
+  Samps_Needed = Seg_Len;
+  Samps_Consumed = 0;
+  Next_Seq_To_Fill = 0;
+  Next_Seq_To_Harvest = 0;
+  Num_Segs_Waited = 0;
+  Segs_In_Est = 0;
+  Segs_Since_Snapshot = 0;
+  History_Idx = 0;
+
+  // started here rather than in the constructor so that a
+  // process forked for block size tuning starts its own
+  if(Worker_Threads.empty())
+    {
+    for(int iw=0; iw<Num_Workers; iw++)
+      {
+      Worker_Threads.push_back(
+            new std::thread(&SpectrumMonitor<T>::WorkerLoop, this));
+      }
+    }
+
+  for(is=0; is<Fft_Len; is++)
+    {
+    Psd_Est[is] = 0.0;
+    }
+  if(!Using_Exponential_Avg)
+    {
+    for(is=0; is<Fft_Len; is++)
+      {
+      Pdgm_Sum[is] = 0.0;
+      }
+    for(ih=0; ih<Num_Segs_To_Avg; ih++)
+      {
+      for(is=0; is<Fft_Len; is++)
+        {
+        Pdgm_History[ih][is] = 0.0;
+        }
+      }
+    }
+
+  //-------------------------------------------
+  //  file header:  "PSDSNAP1", FFT length,
+  //  frequency spacing, averaging mode (0=sliding
+  //  window, 1=exponential) and averaging length
+
+  Psd_File->seekp(0);
+  Psd_File->write("PSDSNAP1", 8);
+  Psd_File->write((char*)&Fft_Len, sizeof(int));
+  Psd_File->write((char*)&Delta_F, sizeof(double));
+  header_val = Using_Exponential_Avg ? 1 : 0;
+  Psd_File->write((char*)&header_val, sizeof(int));
+  if(Using_Exponential_Avg)
+    Psd_File->write((char*)&Exp_Avg_Time_Const, sizeof(double));
+  else
+    {
+    double seg_count = Num_Segs_To_Avg;
+    Psd_File->write((char*)&seg_count, sizeof(double));
+    }
+};
+//======================================================
+template <class T>
+int SpectrumMonitor<T>::Execute()
+{
+  int is;
+  int samps_avail;
+  T *in_sig_ptr;
+
+  #ifdef _DEBUG
+    *DebugFile << "In SpectrumMonitor::Execute\0" << endl;
+  #endif
+
+  if(PassNumber < Hold_Off) return(_MES_AOK);
+
+  in_sig_ptr = GET_INPUT_PTR(In_Sig);
+  samps_avail = In_Sig->GetValidBlockSize();
+  Samps_Consumed += samps_avail;
+
+  while(Samps_Needed <= samps_avail)
+    {
+    //  The new input block has enough samples to finish a segment.
+
+    for(is=Samps_Needed; is>0; is--)
+      {
+      Time_Seg[Seg_Len - is] = *in_sig_ptr++;
+      }
+    samps_avail -= Samps_Needed;
+
+    SubmitSegment();
+
+    // copy overlap samples down to start of buffer
+    for(is=0; is<Overlap_Len; is++)
+      {
+      Time_Seg[is] = Time_Seg[is + Shift_Between_Segs];
+      }
+    Samps_Needed = Shift_Between_Segs;
+    }
+
+  //  Not enough samples left to finish a segment.  Keep
+  //  them and wait for the next pass to get some more.
+
+  for(is=0; is<samps_avail; is++)
+    {
+    Time_Seg[Seg_Len - Samps_Needed + is] = *in_sig_ptr++;
+    }
+  Samps_Needed -= samps_avail;
+
+  HarvestSegments();
+  if( (PassNumber % Snapshot_Interval) == 0 &&
+      Segs_Since_Snapshot > 0 ) WriteSnapshot();
+
+  return(_MES_AOK);
+}
+//======================================================
+//  Copies the completed segment into the next slot in
+//  sequence.  That slot holds the oldest segment still
+//  outstanding, so until it is harvested this thread
+//  takes queued segments off the workers' hands.
+
+template <class T>
+void SpectrumMonitor<T>::SubmitSegment(void)
+{
+  seg_slot_type *slot;
+
+  slot = &Seg_Slots[Next_Seq_To_Fill % Num_Slots];
+  if(slot->state.load(std::memory_order_acquire) != SEG_SLOT_FREE)
+    {
+    Num_Segs_Waited++;
+    for(;;)
+      {
+      HarvestSegments();
+      if(slot->state.load(std::memory_order_acquire) == SEG_SLOT_FREE) break;
+      if(!ProcessOneSegment(Submit_Win_Seg, Submit_Freq_Seg))
+        {
+        // the oldest segment is being worked on
+        std::this_thread::yield();
+        }
+      }
+    }
+  for(int is=0; is<Seg_Len; is++)
+    {
+    slot->time_seg[is] = Time_Seg[is];
+    }
+  slot->seq_num = Next_Seq_To_Fill;
+  Next_Seq_To_Fill++;
+  slot->state.store(SEG_SLOT_FILLED, std::memory_order_release);
+
+  {
+    std::lock_guard<std::mutex> lock(Wakeup_Mutex);
+    Num_Pending_Segs++;
+  }
+  Wakeup_Cond.notify_one();
+}
+//======================================================
+//  Body of each worker thread.  The window and FFT work
+//  buffers belong to the worker, so the only shared data
+//  are the slots, which are claimed with an atomic
+//  compare-and-swap.
+
+template <class T>
+void SpectrumMonitor<T>::WorkerLoop(void)
+{
+  T *win_seg = new T[Seg_Len];
+  std::complex<double> *freq_seg = new std::complex<double>[Fft_Len];
+
+  for(;;)
+    {
+    if(ProcessOneSegment(win_seg, freq_seg)) continue;
+
+    std::unique_lock<std::mutex> lock(Wakeup_Mutex);
+    if(Num_Pending_Segs.load() > 0) continue;
+    if(Shutdown_Requested.load()) break;
+    Wakeup_Cond.wait(lock);
+    }
+  delete[] win_seg;
+  delete[] freq_seg;
+}
+//======================================================
+template <class T>
+bool SpectrumMonitor<T>::ProcessOneSegment( T *win_seg,
+                                std::complex<double> *freq_seg )
+{
+  seg_slot_type *slot;
+  int expected;
+  int islot, is;
+  double scale;
+
+  for(islot=0; islot<Num_Slots; islot++)
+    {
+    slot = &Seg_Slots[islot];
+    expected = SEG_SLOT_FILLED;
+    if(slot->state.compare_exchange_strong(expected, SEG_SLOT_BUSY,
+                                          std::memory_order_acquire)) break;
+    }
+  if(islot == Num_Slots) return(false);
+  Num_Pending_Segs--;
+
+  if(Using_Window)
+    {
+    Data_Window->Apply(slot->time_seg, win_seg);
+    }
+  else
+    {
+    for(is=0; is<Seg_Len; is++)
+      {
+      win_seg[is] = slot->time_seg[is];
+      }
+    }
+
+  FFT<double>( win_seg, freq_seg, Seg_Len, Fft_Len);
+
+  scale = Samp_Intvl / Seg_Len;
+  for(is=0; is<Fft_Len; is++)
+    {
+    slot->periodogram[is] = scale * std::norm(freq_seg[is]);
+    }
+  slot->state.store(SEG_SLOT_DONE, std::memory_order_release);
+  return(true);
+}
+//======================================================
+//  Folds finished periodograms into the running average
+//  in segment order, stopping at the first segment that
+//  is still being worked on.
+
+template <class T>
+void SpectrumMonitor<T>::HarvestSegments(void)
+{
+  seg_slot_type *slot;
+  double *pdgm;
+  double *oldest;
+  double exp_weight;
+  int is;
+
+  while(Next_Seq_To_Harvest < Next_Seq_To_Fill)
+    {
+    slot = &Seg_Slots[Next_Seq_To_Harvest % Num_Slots];
+    if(slot->state.load(std::memory_order_acquire) != SEG_SLOT_DONE) break;
+    pdgm = slot->periodogram;
+
+    if(Using_Exponential_Avg)
+      {
+      // weight ramps down to 1/time_const so the
+      // estimate is unbiased from the first segment
+      exp_weight = 1.0/(Segs_In_Est+1);
+      if(exp_weight < 1.0/Exp_Avg_Time_Const) exp_weight = 1.0/Exp_Avg_Time_Const;
+      for(is=0; is<Fft_Len; is++)
+        {
+        Psd_Est[is] += exp_weight * (pdgm[is] - Psd_Est[is]);
+        }
+      }
+    else
+      {
+      oldest = Pdgm_History[History_Idx];
+      for(is=0; is<Fft_Len; is++)
+        {
+        Pdgm_Sum[is] += pdgm[is] - oldest[is];
+        oldest[is] = pdgm[is];
+        }
+      History_Idx = (History_Idx + 1) % Num_Segs_To_Avg;
+      }
+    Segs_In_Est++;
+    Segs_Since_Snapshot++;
+
+    slot->state.store(SEG_SLOT_FREE, std::memory_order_release);
+    Next_Seq_To_Harvest++;
+    }
+}
+//======================================================
+//  Record layout:  pass number, simulation time, segments
+//  in estimate, segments that waited for a slot so far,
+//  then Fft_Len PSD values (all in native byte order).
+
+template <class T>
+void SpectrumMonitor<T>::WriteSnapshot(void)
+{
+  int num_segs;
+  long segs_in_avg;
+  double samp_time;
+  int waited;
+  int is;
+
+  segs_in_avg = Segs_In_Est;
+  if(!Using_Exponential_Avg)
+    {
+    segs_in_avg = (Segs_In_Est < Num_Segs_To_Avg) ? Segs_In_Est : Num_Segs_To_Avg;
+    for(is=0; is<Fft_Len; is++)
+      {
+      Psd_Est[is] = Pdgm_Sum[is] / double(segs_in_avg);
+      }
+    }
+  samp_time = Samps_Consumed * Samp_Intvl;
+  num_segs = int(Segs_In_Est);
+  waited = int(Num_Segs_Waited);
+
+  Psd_File->write((char*)&PassNumber, sizeof(int));
+  Psd_File->write((char*)&samp_time, sizeof(double));
+  Psd_File->write((char*)&num_segs, sizeof(int));
+  Psd_File->write((char*)&waited, sizeof(int));
+  Psd_File->write((char*)Psd_Est, Fft_Len*sizeof(double));
+  Psd_File->flush();
+
+  SpectRegistry.Publish( GetInstanceName(),
+                         Psd_Est,
+                         Fft_Len,
+                         Delta_F,
+                         Using_Exponential_Avg ? int(Exp_Avg_Time_Const) : int(segs_in_avg),
+                         Window_Enbw );
+
+  Segs_Since_Snapshot = 0;
+  #ifdef _DEBUG
+    *DebugFile << GetModelName() << " PSD snapshot at pass "
+               << PassNumber << " (" << num_segs << " segments, "
+               << waited << " waited for a slot)" << endl;
+  #endif
+}
+template class SpectrumMonitor<float>;
+template class SpectrumMonitor< std::complex<float> >;
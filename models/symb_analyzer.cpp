@@ -30,82 +30,45 @@ SymbSeqAnalyzer::SymbSeqAnalyzer( char* instance_name,
   GET_INT_PARM(Report_Intvl_In_Blocks);
   GET_INT_PARM(Bits_Per_Symb);
 
+  // statistics are kept for 1-grams thru Ngram_Order-grams;
+  // with Continuous_Run the n-grams span block boundaries
+  GET_INT_PARM_OPT(Ngram_Order, 2);
+  GET_BOOL_PARM_OPT(Continuous_Run, false);
+  GET_INT_PARM_OPT(Num_Threads, 1);
+
   MAKE_INPUT(In_Sig);
 
   Num_Diff_Symbs = 1<<Bits_Per_Symb;
-  Symb_Count = new int[Num_Diff_Symbs];
-  Double_Count = new int[Num_Diff_Symbs*Num_Diff_Symbs];
-
+  Stats = new NgramStats( Num_Diff_Symbs, 0,
+                          Ngram_Order,
+                          Continuous_Run,
+                          Num_Threads );
 }
 //======================================================
-SymbSeqAnalyzer::~SymbSeqAnalyzer( void ){ };
+SymbSeqAnalyzer::~SymbSeqAnalyzer( void )
+{
+  delete Stats;
+};
 
 //======================================================
 void SymbSeqAnalyzer::Initialize(void)
 {
-   int i;
    Block_Size = In_Sig->GetBlockSize();
-
-   for(i=0; i<Num_Diff_Symbs; i++)
-      Symb_Count[i] = 0;
-   for(i=0; i<Num_Diff_Symbs*Num_Diff_Symbs; i++)
-      Double_Count[i] = 0;
+   Stats->Reset();
 };
 
 //======================================================
 int SymbSeqAnalyzer::Execute()
 {
-   byte_t *in_byte_ptr, in_byte;
-   byte_t old_byte;
-   int is, i,j;
+   byte_t *in_byte_ptr;
 
    in_byte_ptr = GET_INPUT_PTR( In_Sig );
+   Stats->Tally(in_byte_ptr, Block_Size);
 
-   for( is=0; is < Block_Size; is++)
-   {
-      in_byte = *in_byte_ptr++;
-      Symb_Count[in_byte]++;
-      if(is%2)
-      {
-         Double_Count[old_byte*Num_Diff_Symbs + in_byte]++;
-      }
-      else
-      {
-         old_byte = in_byte;
-      }
-     
-
-   }
    if( (PassNumber % Report_Intvl_In_Blocks) == 0)
    {
-      float total_count = float(Symb_Count[0]);
-      for( i=1; i<Num_Diff_Symbs; i++)
-         total_count += Symb_Count[i];
-
-      BasicResults << Instance_Name << ": "
-              << PassNumber << "  symbol %'s: "
-              << (Symb_Count[0]/total_count);
-
-      for( i=1; i<Num_Diff_Symbs; i++)
-      {
-         BasicResults << ", " << (Symb_Count[i]/total_count);
-      }
-      BasicResults << "\n" << endl;
-
-      total_count = float(Double_Count[0]);
-      for( i=1; i<Num_Diff_Symbs*Num_Diff_Symbs; i++)
-         total_count += Double_Count[i];
-
-      for( i=0; i<Num_Diff_Symbs; i++)
-      {
-         for( j=0; j<Num_Diff_Symbs; j++)
-         {
-            BasicResults << ", " << (Double_Count[i*Num_Diff_Symbs+j]/total_count);
-         }
-         BasicResults << "\n" << endl;
-      }
+      Stats->Report(Instance_Name, PassNumber);
    }
 
    return(_MES_AOK);
 }
-
@@ -93,7 +93,7 @@ int Upsampler<T>::Execute()
    return(_MES_AOK);
 
 }
-template Upsampler< int >;
-template Upsampler< float >;
-template Upsampler< bit_t >;
+template class Upsampler< int >;
+template class Upsampler< float >;
+template class Upsampler< bit_t >;
 
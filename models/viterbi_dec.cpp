@@ -0,0 +1,95 @@
+//
+//  File = viterbi_dec.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <strstream>
+#include "parmfile.h"
+#include "model_error.h"
+#include "viterbi_dec.h"
+#include "typedefs.h"
+#include "model_graph.h"
+extern ParmFile *ParmInput;
+extern ofstream *DebugFile;
+using namespace std;
+
+//======================================================
+
+ViterbiDecoder::ViterbiDecoder( char* instance_name,
+                                PracSimModel* outer_model,
+                                Signal<float>* in_signal,
+                                Signal<bit_t>* out_signal )
+               :PracSimModel(instance_name,
+                             outer_model)
+{
+  MODEL_NAME(ViterbiDecoder);
+  ENABLE_MULTIRATE;
+  In_Sig = in_signal;
+  Out_Sig = out_signal;
+
+  OPEN_PARM_BLOCK;
+  GET_INT_PARM(Constr_Len);
+  GET_INT_PARM(Num_Outputs);
+  if(Num_Outputs < 2 || Num_Outputs > VIT_MAX_OUTPUTS)
+    {
+    ostrstream temp_stream;
+    temp_stream << "ViterbiDecoder Num_Outputs must be 2 thru "
+                << VIT_MAX_OUTPUTS << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Gen_Polys = new int[Num_Outputs];
+  GET_INT_PARM_ARRAY(Gen_Polys, Num_Outputs);
+  GET_INT_PARM(Traceback_Depth);
+  GET_FLOAT_PARM(Soft_Scale);
+
+  MAKE_INPUT(In_Sig);
+  MAKE_OUTPUT(Out_Sig);
+  CHANGE_RATE(In_Sig, Out_Sig, 1.0/Num_Outputs);
+  SET_BLOCK_GRANULARITY(In_Sig, Num_Outputs);
+
+  Kernel = new k_ViterbiDecoder( Constr_Len,
+                                 Num_Outputs,
+                                 Gen_Polys,
+                                 Traceback_Depth,
+                                 Soft_Scale );
+}
+//======================================================
+ViterbiDecoder::~ViterbiDecoder( void )
+{
+  delete Kernel;
+  delete[] Gen_Polys;
+};
+
+//======================================================
+void ViterbiDecoder::Initialize(void)
+{
+  Block_Size = In_Sig->GetBlockSize();
+  if(Block_Size % Num_Outputs)
+    {
+    ostrstream temp_stream;
+    temp_stream << "ViterbiDecoder input block size " << Block_Size
+                << " is not a multiple of Num_Outputs" << ends;
+    char *message = temp_stream.str();
+    PsModelError(FATAL, message);
+    delete []message;
+    }
+  Num_Bits = Block_Size/Num_Outputs;
+};
+
+//======================================================
+int ViterbiDecoder::Execute()
+{
+  float *soft_in;
+  bit_t *bits_out;
+
+  soft_in = GET_INPUT_PTR( In_Sig );
+  bits_out = GET_OUTPUT_PTR( Out_Sig );
+
+  Kernel->Execute(soft_in, bits_out, Num_Bits);
+
+  Out_Sig->SetValidBlockSize(Num_Bits);
+  return(_MES_AOK);
+}
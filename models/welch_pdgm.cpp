@@ -7,20 +7,18 @@
 #include "parmfile.h"
 #include "model_graph.h"
 #include "welch_pdgm.h"
-#include "trianglr.h"
-#include "hamming.h"
-#include "hann.h"
+#include "win_cache.h"
 #include "fft_T.h"
 #include "dump_spect.h"
+#include "spect_result.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
 #endif
-#define _NO_ZERO_ENDS 0
-#define _ZERO_ENDS 1
 
 extern ParmFile *ParmInput;
 extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
 
 //======================================================
 
@@ -52,46 +50,35 @@ WelchPeriodogram<T>::WelchPeriodogram( char* instance_name,
   if(Using_Window)
   {
       Window_Shape = GetWindowShapeParm("Window_Shape\0");
-      switch(Window_Shape)
+      Kaiser_Beta = 0.0;
+      if(Window_Shape == WINDOW_SHAPE_KAISER)
       {
-      case WINDOW_SHAPE_TRIANGULAR:
-        Data_Window = new TriangularWindow( Seg_Len, _NO_ZERO_ENDS );
-        break;
-      case WINDOW_SHAPE_HAMMING:
-        Data_Window = new HammingWindow( Seg_Len );
-        break;
-      case WINDOW_SHAPE_HANN:
-        Data_Window = new HannWindow( Seg_Len, _NO_ZERO_ENDS );
-        break;
-      default:
-        break;
-      }
-      ofstream* lag_win_file = new ofstream("lag_win.txt\0", ios::out);
-//      Data_Window->DumpHalfLagWindow(lag_win_file);
-      Window_Taps = Data_Window->GetDataWindow();
-      Window_Power = 0.0;
-      for(is=0; is<Seg_Len; is++)
-      {
-         Window_Power += Window_Taps[is]*Window_Taps[is];
-      }
-      Window_Power /= double(Seg_Len);
-      double window_scale = sqrt(Window_Power);
-      for(is=0; is<Seg_Len; is++)
-      {
-         Window_Taps[is] /= window_scale;
+         GET_DOUBLE_PARM(Kaiser_Beta);
       }
+
+      // unit power taps keep the PSD level unbiased
+      Data_Window = GetCachedWindow( Window_Shape,
+                                     Seg_Len,
+                                     WINDOW_NORM_UNIT_POWER,
+                                     Kaiser_Beta );
+      Window_Enbw = Data_Window->GetEnbw();
    }
+  else
+  {
+      Data_Window = NULL;
+      Window_Enbw = 1.0;
+  }
 
   In_Sig = in_sig;
   MAKE_INPUT(In_Sig);
 
 
   Time_Seg = new T[Seg_Len];
-  Overlap_Len = Seg_Len - Shift_Between_Segs;
-  Overlap_Seg = Time_Seg + Shift_Between_Segs;
-  Win_Time_Seg = new T[Seg_Len];
   Sample_Spectrum = new double[Fft_Len];
-  Freq_Seg = new std::complex<double>[Fft_Len];
+  Packed_Seg = new std::complex<double>[Fft_Len/2];
+  Freq_Seg = new std::complex<double>[Fft_Len/2 + 1];
+  Fft_Twiddles = new std::complex<double>[Fft_Len/2];
+  RealFftTwiddles<double>(Fft_Twiddles, Fft_Len);
 
   for(is=0; is<Fft_Len; is++)
     {
@@ -111,16 +98,22 @@ void WelchPeriodogram<T>::Initialize(void)
 {
   Segs_In_Est = 0;
   Samps_Needed = Seg_Len;
+  Write_Idx = 0;
   Block_Size = In_Sig->GetBlockSize();
   Samp_Intvl = In_Sig->GetSampIntvl();
   Delta_F = 1.0/(Samp_Intvl*Fft_Len);
 
+  // periodogram and averaging normalization, applied once at dump time
+  Psd_Scale = Samp_Intvl / (double(Seg_Len) * Num_Segs_To_Avg);
+
 };
 
 template <class T>
 int WelchPeriodogram<T>::Execute()
 {
    int i,is;
+   int first_run;
+   double *pack_ptr;
    #ifdef _DEBUG
       *DebugFile << "In WelchPeriodogram::Execute\0" << endl;
    #endif
@@ -142,48 +135,51 @@ int WelchPeriodogram<T>::Execute()
       //  Fill up FFT buffer by getting Samps_Needed input samples.
       for(is=Samps_Needed; is>0; is--)
       {
-         Time_Seg[Seg_Len - is] = *in_sig_ptr++;
+         Time_Seg[Write_Idx++] = *in_sig_ptr++;
+         if(Write_Idx == Seg_Len) Write_Idx = 0;
       }
       samps_avail -= Samps_Needed;
 
+      //  The oldest sample of the segment is at Write_Idx.  Window
+      //  the segment as it is packed two samples per complex value
+      //  (unwrapping the circular buffer in two runs) and zero-pad.
+      pack_ptr = (double*)Packed_Seg;
+      first_run = Seg_Len - Write_Idx;
       if(Using_Window)
       {
-         for(is=0; is<Seg_Len; is++)
-         {
-            Win_Time_Seg[is] = Window_Taps[is]*Time_Seg[is];
-         }
+         Data_Window->Apply( Time_Seg + Write_Idx, pack_ptr,
+                             0, first_run );
+         Data_Window->Apply( Time_Seg, pack_ptr + first_run,
+                             first_run, Seg_Len - first_run );
       }
       else
       {
-         for(is=0; is<Seg_Len; is++)
+         for(is=0; is<first_run; is++)
+         {
+            pack_ptr[is] = Time_Seg[Write_Idx + is];
+         }
+         for(is=first_run; is<Seg_Len; is++)
          {
-            Win_Time_Seg[is] = Time_Seg[is];
+            pack_ptr[is] = Time_Seg[is - first_run];
          }
       }
+      for(is=Seg_Len; is<Fft_Len; is++)
+      {
+         pack_ptr[is] = 0.0;
+      }
 
       //  Perform FFT
-      FFT<double>(   Win_Time_Seg,
-                     Freq_Seg,
-                     Seg_Len,
-                     Fft_Len);
+      RealFFT<double>(  Packed_Seg,
+                        Fft_Twiddles,
+                        Freq_Seg,
+                        Fft_Len);
 
-      for(i=0; i<Seg_Len; i++)
+      for(i=0; i<Fft_Len/2; i++)
       {
-         //Sample_Spectrum[i] += Samp_Intvl * std::norm(Freq_Seg[i])/(Window_Power*Seg_Len);
-         Sample_Spectrum[i] += Samp_Intvl * std::norm(Freq_Seg[i])/Seg_Len;
+         Sample_Spectrum[i] += std::norm(Freq_Seg[i]);
       }
 
-      //for(is=0; is<Seg_Len; is++)
-      //{
-      //   Time_Seg[is] = 0.0;
-      //}
-      // copy overlap samples down to start of buffer
-      //memmove( Time_Seg, Overlap_Seg, 
-      //        (sizeof(T)/sizeof(char))*Overlap_Len);
-      for(i=0; i<Overlap_Len; i++)
-      {
-         Time_Seg[i] = Overlap_Seg[i];
-      }
+      // overlap samples are left in place for the next segment
       Samps_Needed = Shift_Between_Segs;
 
       Segs_In_Est++;
@@ -191,10 +187,16 @@ int WelchPeriodogram<T>::Execute()
       // is it time to dump the results?
       if(Segs_In_Est == Num_Segs_To_Avg)
       {
-         for(i=0; i<Seg_Len; i++)
+         for(i=0; i<Fft_Len/2; i++)
          {
-            Sample_Spectrum[i] /= double(Num_Segs_To_Avg);
+            Sample_Spectrum[i] *= Psd_Scale;
          }
+         SpectRegistry.Publish(  GetInstanceName(),
+                                 Sample_Spectrum,
+                                 Fft_Len/2,
+                                 Delta_F,
+                                 Num_Segs_To_Avg,
+                                 Window_Enbw);
          DumpSpectrum(  Sample_Spectrum,
                         Fft_Len,
                         Delta_F,
@@ -221,11 +223,12 @@ int WelchPeriodogram<T>::Execute()
 
    for(is=0; is<samps_avail; is++)
    {
-      Time_Seg[Seg_Len - Samps_Needed + is] = *in_sig_ptr++;
+      Time_Seg[Write_Idx++] = *in_sig_ptr++;
+      if(Write_Idx == Seg_Len) Write_Idx = 0;
    }
    Samps_Needed -= samps_avail;
 
    return(_MES_AOK);
 
 }
-template WelchPeriodogram<float>;
+template class WelchPeriodogram<float>;
@@ -11,9 +11,8 @@
 #include "hann.h"
 #include "fft_T.h"
 #include "dump_spect.h"
-#include "autometh.h"
-#include "levin.h"
-#include "ar_spec.h"
+#include "spect_result.h"
+#include "ar_estim.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -23,6 +22,7 @@
 
 extern ParmFile *ParmInput;
 extern int PassNumber;
+extern SpectrumRegistry SpectRegistry;
 
 //======================================================
 
@@ -47,20 +47,43 @@ YuleWalkerPsdEstim::YuleWalkerPsdEstim(
    GET_BOOL_PARM(Output_In_Decibels);
    GET_BOOL_PARM(Plot_Two_Sided);
    GET_BOOL_PARM(Halt_When_Completed);
+   // Ar_Method and Num_Segs_To_Avg default to the original single-segment
+   // Yule-Walker behavior so that older parameter files still run
+   if(ParmInput->ParmIsPresent("Ar_Method\0"))
+      Ar_Method = GetArMethodParm("Ar_Method\0");
+   else
+      Ar_Method = AR_METHOD_YULE_WALKER;
+   BasicResults << "   " << "Ar_Method = " << Ar_Method << endl;
+   GET_INT_PARM_OPT(Num_Segs_To_Avg, 1);
 
    In_Sig = in_sig;
    MAKE_INPUT(In_Sig);
 
+   // estimator may round Num_Freq_Pts up to suit its FFT
+   Ar_Estimator = new ArEstimator( Ar_Method,
+                                   Seg_Len,
+                                   Ar_Order,
+                                   Num_Freq_Pts );
+   Num_Freq_Pts = Ar_Estimator->GetNumFreqPts();
+
    Time_Seg = new double[Seg_Len];
-   Sample_Spectrum = new double[Seg_Len];
+   Psd_Est = new double[Num_Freq_Pts];
 
-   for(int is=0; is<Seg_Len; is++){
-      Sample_Spectrum[is] = 0.0;
+   for(int is=0; is<Num_Freq_Pts; is++){
+      Psd_Est[is] = 0.0;
    }
+   Psd_File = new ofstream(Psd_File_Name, ios::out);
    Processing_Completed = false;
 }
 //======================================================
-YuleWalkerPsdEstim::~YuleWalkerPsdEstim( void ){ };
+YuleWalkerPsdEstim::~YuleWalkerPsdEstim( void )
+{
+   Psd_File->close();
+   delete Psd_File;
+   delete Ar_Estimator;
+   delete[] Time_Seg;
+   delete[] Psd_Est;
+};
 
 //======================================================
 void YuleWalkerPsdEstim::Initialize(void)
@@ -69,6 +92,7 @@ void YuleWalkerPsdEstim::Initialize(void)
    Samps_Needed = Seg_Len;
    Block_Size = In_Sig->GetBlockSize();
    Samp_Intvl = In_Sig->GetSampIntvl();
+   Delta_F = 1.0/(Samp_Intvl*2*(Num_Freq_Pts-1));
 };
 
 //======================================================
@@ -76,6 +100,7 @@ int YuleWalkerPsdEstim::Execute()
 {
    int is;
    int error_status;
+   double *ar_psd;
 #ifdef _DEBUG
    *DebugFile << "In YuleWalkerPsdEstim::Execute\0" 
               << endl;
@@ -101,40 +126,58 @@ int YuleWalkerPsdEstim::Execute()
          Time_Seg[Seg_Len - is] = *in_sig_ptr++;
       }
       samps_avail -= Samps_Needed;
+      Samps_Needed = Seg_Len;
 
-      AutocorrMethCorrMtx *corr_mtx = 
-            new AutocorrMethCorrMtx(  
-                  Time_Seg, 
-                  Seg_Len, 
-                  Ar_Order);
-
-      double *correl_vec = corr_mtx->GetCol(1);
-      double *a_vec = new double[Ar_Order+1];
-      double driving_noise_var;
-
-      error_status = LevinsonRecursion(   
-         correl_vec,
-         Ar_Order,
-         a_vec,
-         &driving_noise_var);
-
-      ArSpectrum *ar_spectrum = new ArSpectrum( 
-               Ar_Order,
-               a_vec,
-               Samp_Intvl,
-               driving_noise_var, //true_ar_drv_var );
-               Num_Freq_Pts,
-               1.0/(2*Samp_Intvl));
-
-      ar_spectrum->DumpSpectrum( Psd_File_Name, true);
-
-      if(Halt_When_Completed)
-      {
+      error_status = Ar_Estimator->Estimate(Time_Seg);
+      if(error_status != 0){
+#ifdef _DEBUG
+         *DebugFile << GetModelName() 
+                    << " skipped segment with unstable AR fit" 
+                    << endl;
+#endif
+         continue;
+      }
+      Ar_Estimator->ComputeSpectrum(Samp_Intvl);
+      ar_psd = Ar_Estimator->GetSpectrum();
+      for(is=0; is<Num_Freq_Pts; is++){
+         Psd_Est[is] += ar_psd[is];
+      }
+      Segs_In_Est++;
+
+      // is it time to dump the results?
+      if(Segs_In_Est == Num_Segs_To_Avg){
+         for(is=0; is<Num_Freq_Pts; is++){
+            Psd_Est[is] /= double(Num_Segs_To_Avg);
+         }
+         SpectRegistry.Publish(  
+            GetInstanceName(),
+            Psd_Est,
+            Num_Freq_Pts,
+            Delta_F,
+            Num_Segs_To_Avg,
+            1.0);
+         DumpSpectrum(  
+            Psd_Est,
+            2*(Num_Freq_Pts-1),
+            Delta_F,
+            Freq_Norm_Factor,
+            Output_In_Decibels,
+            Plot_Two_Sided,
+            Psd_File);
+         *Psd_File << endl;
+
+         for(is=0; is<Num_Freq_Pts; is++){
+            Psd_Est[is] = 0.0;
+         }
+         Segs_In_Est = 0;
+
+         if(Halt_When_Completed){
 #ifdef _DEBUG
-         *DebugFile << "Execution halted by " 
-                    << GetModelName() << endl;
+            *DebugFile << "Execution halted by " 
+                       << GetModelName() << endl;
 #endif
-         exit(0);
+            exit(0);
+         }
       }
    }// end of while
 
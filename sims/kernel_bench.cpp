@@ -0,0 +1,446 @@
+//
+//  File = kernel_bench.cpp
+//
+//  Standalone timing of the inner-loop kernels that the
+//  models spend most of their time in.  Each case is run
+//  with a fixed seed and a repetition count scaled so one
+//  trial takes roughly the same time at every size; the
+//  fastest of BENCH_NUM_TRIALS trials is reported, in
+//  nanoseconds per call and per sample, to the console
+//  and to kernel_bench.json so runs can be compared
+//  before and after a change.
+//
+//  The second half is a short simulation, driven by the
+//  KernelBench.dat that it writes for itself, in which
+//  every model is fed the same Gaussian noise: Butterworth
+//  AnalogFilterByIir at orders 2 thru 12, a fixed
+//  ContinuousDelay with sinc interpolation, and a Hann
+//  windowed WelchPeriodogram.  Per-model ns/sample and the
+//  pass rate go to KernelBench_profile.json.
+//
+//  End-to-end pass throughput of any other simulation
+//  (e.g. qpsk_sim, bpsk_sim) is measured by building it
+//  with _PROFILE defined, which writes the same figures to
+//  <SIM_NAME>_profile.json.  Seeds come from the .dat
+//  file, so repeated runs do identical work.
+//
+
+#define SIM_NAME "KernelBench\0"
+#define SIM_TITLE "Kernel Microbenchmarks\0"
+
+#include "global_stuff.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <complex>
+#include <vector>
+#include "cmpx_kernels.h"
+#include "k_berctr.h"
+#include "noise_gen.h"
+#include "butt_filt_iir.h"
+#include "contin_delay_T.h"
+#include "welch_pdgm.h"
+#include "siganchr.h"
+#include "dit_nipo_T.h"
+#include "dit_pino_T.h"
+#include "fft_plan_T.h"
+#include "gausrand.h"
+#include "uni_rand.h"
+
+#define BENCH_NUM_TRIALS 5
+#define BENCH_SAMPS_PER_TRIAL 4000000
+#define BENCH_MIN_FFT_LOG2 6
+#define BENCH_MAX_FFT_LOG2 20
+#define BENCH_RNG_BLOCK 4096
+#define BENCH_CMPX_BLOCK 4096
+#define BENCH_SEED 7733L
+#define BENCH_BER_BLOCK 4096
+#define BENCH_BER_LAG 5
+#define BENCH_MIN_IIR_ORDER 2
+#define BENCH_MAX_IIR_ORDER 12
+#define BENCH_MODEL_BLOCK 4096
+#define BENCH_MODEL_PASSES 250
+
+typedef struct{
+   const char *kernel;
+   int size;
+   int reps;
+   double ns_per_call;
+   double ns_per_samp;
+   } bench_result_type;
+
+static std::vector<bench_result_type> Bench_Results;
+
+//  defeats dead-code elimination of the RNG loops
+static volatile double Bench_Sink;
+
+static double NowNs(void)
+{
+   return( double( std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now().time_since_epoch()).count() ));
+}
+//=========================================================
+static void RecordResult( const char *kernel,
+                          int size,
+                          int reps,
+                          double best_ns )
+{
+   bench_result_type result;
+   result.kernel = kernel;
+   result.size = size;
+   result.reps = reps;
+   result.ns_per_call = best_ns/reps;
+   result.ns_per_samp = result.ns_per_call/size;
+   Bench_Results.push_back(result);
+
+   cout << kernel << "  size = " << size
+        << "  ns/call = " << result.ns_per_call
+        << "  ns/samp = " << result.ns_per_samp << endl;
+}
+//=========================================================
+//  kernel_id: 0 = FftDitNipo, 1 = FftDitPino, 2 = FftPlan
+
+static void BenchFft( int kernel_id,
+                      const char *kernel,
+                      int fft_len )
+{
+   int reps, trial, rep, is;
+   long seed;
+   double t_start, t_elap, best_ns;
+   std::complex<float> *source, *work;
+   FftPlan<float> *plan = NULL;
+
+   reps = BENCH_SAMPS_PER_TRIAL/fft_len;
+   if(reps < 1) reps = 1;
+
+   source = new std::complex<float>[fft_len];
+   work = new std::complex<float>[fft_len];
+   seed = BENCH_SEED;
+   for(is=0; is<fft_len; is++) GaussRandom(&seed, &source[is]);
+   if(kernel_id == 2) plan = GetFftPlan<float>(fft_len);
+
+   best_ns = 0.0;
+   for(trial=0; trial<BENCH_NUM_TRIALS; trial++){
+      t_elap = 0.0;
+      for(rep=0; rep<reps; rep++){
+         // refresh the input outside the timed region so
+         // values stay bounded across repetitions
+         memcpy(work, source, fft_len*sizeof(std::complex<float>));
+         t_start = NowNs();
+         switch(kernel_id){
+         case 0:
+            FftDitNipo(work, fft_len);
+            break;
+         case 1:
+            FftDitPino(work, fft_len);
+            break;
+         default:
+            plan->Forward(work);
+            break;
+         }
+         t_elap += NowNs() - t_start;
+      }
+      if(trial == 0 || t_elap < best_ns) best_ns = t_elap;
+   }
+   Bench_Sink = work[0].real();
+   RecordResult(kernel, fft_len, reps, best_ns);
+
+   delete[] source;
+   delete[] work;
+}
+//=========================================================
+//  kernel_id: 0 = GaussRandom(float), 1 = RandomBit
+
+static void BenchRandom( int kernel_id,
+                         const char *kernel )
+{
+   int reps, trial, rep, is;
+   long seed;
+   double t_start, best_ns, accum;
+   float gauss_val;
+
+   reps = BENCH_SAMPS_PER_TRIAL/BENCH_RNG_BLOCK;
+   best_ns = 0.0;
+   accum = 0.0;
+   for(trial=0; trial<BENCH_NUM_TRIALS; trial++){
+      seed = BENCH_SEED;
+      t_start = NowNs();
+      for(rep=0; rep<reps; rep++){
+         if(kernel_id == 0){
+            for(is=0; is<BENCH_RNG_BLOCK; is++){
+               GaussRandom(&seed, &gauss_val);
+               accum += gauss_val;
+            }
+         }
+         else{
+            for(is=0; is<BENCH_RNG_BLOCK; is++){
+               accum += RandomBit(&seed);
+            }
+         }
+      }
+      t_start = NowNs() - t_start;
+      if(trial == 0 || t_start < best_ns) best_ns = t_start;
+   }
+   Bench_Sink = accum;
+   RecordResult(kernel, BENCH_RNG_BLOCK, reps, best_ns);
+}
+//=========================================================
+//  kernel_id: 0 = CmpxMultiply, 1 = CmpxPhase; runs on
+//  whichever instruction set SetCmpxKernelIsa() selected
+
+static void BenchCmpx( int kernel_id,
+                       const char *kernel )
+{
+   int reps, trial, rep, is;
+   long seed;
+   double t_start, best_ns;
+   std::complex<float> *source_1, *source_2, *work;
+   float *phase;
+
+   reps = BENCH_SAMPS_PER_TRIAL/BENCH_CMPX_BLOCK;
+   source_1 = new std::complex<float>[BENCH_CMPX_BLOCK];
+   source_2 = new std::complex<float>[BENCH_CMPX_BLOCK];
+   work = new std::complex<float>[BENCH_CMPX_BLOCK];
+   phase = new float[BENCH_CMPX_BLOCK];
+   seed = BENCH_SEED;
+   for(is=0; is<BENCH_CMPX_BLOCK; is++){
+      GaussRandom(&seed, &source_1[is]);
+      GaussRandom(&seed, &source_2[is]);
+   }
+
+   best_ns = 0.0;
+   for(trial=0; trial<BENCH_NUM_TRIALS; trial++){
+      t_start = NowNs();
+      for(rep=0; rep<reps; rep++){
+         if(kernel_id == 0){
+            CmpxMultiply(source_1, source_2, work, BENCH_CMPX_BLOCK);
+         }
+         else{
+            CmpxPhase(source_1, phase, BENCH_CMPX_BLOCK);
+         }
+      }
+      t_start = NowNs() - t_start;
+      if(trial == 0 || t_start < best_ns) best_ns = t_start;
+   }
+   Bench_Sink = work[0].real() + phase[0];
+   RecordResult(kernel, BENCH_CMPX_BLOCK, reps, best_ns);
+
+   delete[] source_1;
+   delete[] source_2;
+   delete[] work;
+   delete[] phase;
+}
+//=========================================================
+//  k_BerCounter::Execute on blocks with about one error in
+//  100.  With max_lag > 0 the decisions trail the reference
+//  by BENCH_BER_LAG bits and the counter has to find and
+//  track that lag; the reference repeats every block so the
+//  stream stays continuous across calls.
+
+static void BenchBerCounter( int max_lag,
+                             const char *kernel )
+{
+   int reps, trial, rep, is, lag;
+   long seed;
+   double t_start, best_ns;
+   bit_t *ref_bits, *in_bits;
+   k_BerCounter *ber_ctr;
+   char instance_name[] = "bench_ber_ctr\0";
+
+   reps = BENCH_SAMPS_PER_TRIAL/BENCH_BER_BLOCK;
+   lag = (max_lag > 0) ? BENCH_BER_LAG : 0;
+   ref_bits = new bit_t[BENCH_BER_BLOCK];
+   in_bits = new bit_t[BENCH_BER_BLOCK];
+   seed = BENCH_SEED;
+   for(is=0; is<BENCH_BER_BLOCK; is++) ref_bits[is] = RandomBit(&seed);
+   for(is=0; is<BENCH_BER_BLOCK; is++){
+      in_bits[is] = ref_bits[(is - lag + BENCH_BER_BLOCK)%BENCH_BER_BLOCK];
+      if(UniformRandom(&seed) < 0.01) in_bits[is] ^= 1;
+   }
+
+   // no holdoff and no reports inside the timed region
+   PassNumber = 2;
+   ber_ctr = new k_BerCounter(instance_name, 0, 1<<30);
+   if(max_lag > 0) ber_ctr->SetDelaySearch(max_lag, 1024, 100);
+
+   best_ns = 0.0;
+   for(trial=0; trial<BENCH_NUM_TRIALS; trial++){
+      t_start = NowNs();
+      for(rep=0; rep<reps; rep++){
+         ber_ctr->Execute(in_bits, ref_bits, BENCH_BER_BLOCK);
+      }
+      t_start = NowNs() - t_start;
+      if(trial == 0 || t_start < best_ns) best_ns = t_start;
+   }
+   Bench_Sink = double(ber_ctr->GetErrorCount());
+   RecordResult(kernel, BENCH_BER_BLOCK, reps, best_ns);
+
+   delete ber_ctr;
+   delete[] ref_bits;
+   delete[] in_bits;
+}
+//=========================================================
+//  parameter file for the model-level simulation
+
+static void WriteBenchParmFile( const char *sim_name )
+{
+   int order;
+   char file_name[64];
+
+   strcpy(file_name, sim_name);
+   strcat(file_name, ".dat\0");
+   ofstream parm_file(file_name, ios::out);
+
+   parm_file << "system\n"
+             << "Date_In_Short_Rpt_Name = false\n"
+             << "Date_In_Full_Rpt_Name = false\n"
+             << "Max_Pass_Number = " << BENCH_MODEL_PASSES << "\n"
+             << "$\n"
+             << "SignalPlotter\n"
+             << "Num_Plot_Sigs = 0\n"
+             << "$\n"
+             << "bench_noise\n"
+             << "Seed = " << BENCH_SEED << "\n"
+             << "Noise_Sigma = 1.0\n"
+             << "$\n";
+   for(order=BENCH_MIN_IIR_ORDER; order<=BENCH_MAX_IIR_ORDER; order++){
+      parm_file << "iir_ord_" << order << "\n"
+                << "Bypass_Enabled = false\n"
+                << "Filt_Order = " << order << "\n"
+                << "Filt_Band_Config = LOWPASS_FILT_BAND_CONFIG\n"
+                << "Norm_Hz_Pass_Edge = 0.1\n"
+                << "Resp_Plot_Enabled = false\n"
+                << "$\n";
+   }
+   parm_file << "sinc_delay\n"
+             << "Delay_Mode = DELAY_MODE_FIXED\n"
+             << "Interp_Mode = INTERP_MODE_SINC\n"
+             << "Num_Sidelobes = 8\n"
+             << "Max_Delay = 16.0\n"
+             << "Initial_Delay = 3.37\n"
+             << "$\n"
+             << "welch_pdgm\n"
+             << "Seg_Len = 1024\n"
+             << "Fft_Len = 1024\n"
+             << "Hold_Off = 0\n"
+             << "Shift_Between_Segs = 512\n"
+             << "Num_Segs_To_Avg = 1000000000\n"
+             << "Psd_File_Name = kernel_bench_welch.txt\n"
+             << "Freq_Norm_Factor = 1.0\n"
+             << "Output_In_Decibels = true\n"
+             << "Plot_Two_Sided = false\n"
+             << "Halt_When_Completed = false\n"
+             << "Using_Window = true\n"
+             << "Window_Shape = WINDOW_SHAPE_HANN\n"
+             << "$\n"
+             << "$EOF" << endl;
+   parm_file.close();
+}
+//=========================================================
+static void WriteBenchJson( const char *json_file_name )
+{
+   ofstream json_file(json_file_name, ios::out);
+   json_file << "{\"sim\": \"KernelBench\", \"trials\": "
+             << BENCH_NUM_TRIALS << ", \"results\": [";
+   for(int i=0; i<int(Bench_Results.size()); i++){
+      if(i > 0) json_file << ",";
+      json_file << "\n  {\"kernel\": \"" << Bench_Results[i].kernel
+                << "\", \"size\": " << Bench_Results[i].size
+                << ", \"reps\": " << Bench_Results[i].reps
+                << ", \"ns_per_call\": " << Bench_Results[i].ns_per_call
+                << ", \"ns_per_sample\": " << Bench_Results[i].ns_per_samp
+                << "}";
+   }
+   json_file << "\n]}" << endl;
+   json_file.close();
+}
+
+//=========================================================
+
+main()
+{
+   static const char *cmpx_mult_names[] =
+      {"CmpxMultiply(scalar)", "CmpxMultiply(AVX2)", "CmpxMultiply(AVX-512)"};
+   static const char *cmpx_phase_names[] =
+      {"CmpxPhase(scalar)", "CmpxPhase(AVX2)", "CmpxPhase(AVX-512)"};
+   int log2_len, fft_len, isa, max_isa;
+
+   for(log2_len=BENCH_MIN_FFT_LOG2; log2_len<=BENCH_MAX_FFT_LOG2; log2_len++){
+      fft_len = 1 << log2_len;
+      BenchFft(0, "FftDitNipo", fft_len);
+      BenchFft(1, "FftDitPino", fft_len);
+      BenchFft(2, "FftPlan", fft_len);
+   }
+   BenchRandom(0, "GaussRandom");
+   BenchRandom(1, "RandomBit");
+   BenchBerCounter(0, "k_BerCounter");
+   BenchBerCounter(16, "k_BerCounter(lag search)");
+
+   // each instruction set the CPU supports, widest last
+   max_isa = GetCmpxKernelIsa();
+   for(isa=CMPX_ISA_SCALAR; isa<=max_isa; isa++){
+      SetCmpxKernelIsa(CMPX_ISA_T(isa));
+      BenchCmpx(0, cmpx_mult_names[isa]);
+      BenchCmpx(1, cmpx_phase_names[isa]);
+   }
+
+   WriteBenchJson("kernel_bench.json\0");
+
+   //------------------------------------------------------
+   //  model-level simulation
+
+   int order;
+   char *name, *sig_name;
+
+   WriteBenchParmFile(SIM_NAME);
+   #include "sim_preamble.cpp"
+
+   FLOAT_SIGNAL(bench_sig);
+
+   GaussianNoiseGenerator* noise_gen = new GaussianNoiseGenerator(
+                                                "bench_noise\0",
+                                                CommSystem,
+                                                bench_sig );
+
+   for(order=BENCH_MIN_IIR_ORDER; order<=BENCH_MAX_IIR_ORDER; order++){
+      // instance and signal names are kept by the models
+      name = new char[16];
+      sig_name = new char[16];
+      sprintf(name, "iir_ord_%d", order);
+      sprintf(sig_name, "iir_out_%d", order);
+      Signal<float>* filt_sig = new Signal<float>(sig_name);
+      new ButterworthFilterByIir<float>( name,
+                                         CommSystem,
+                                         bench_sig,
+                                         filt_sig );
+   }
+
+   FLOAT_SIGNAL(delayed_sig);
+   ContinuousDelay<float>* sinc_delay = new ContinuousDelay<float>(
+                                                "sinc_delay\0",
+                                                CommSystem,
+                                                bench_sig,
+                                                delayed_sig );
+
+   WelchPeriodogram<float>* welch_pdgm = new WelchPeriodogram<float>(
+                                                "welch_pdgm\0",
+                                                CommSystem,
+                                                bench_sig );
+
+   SignalAnchor* bench_anchor = new SignalAnchor( "bench_anchor\0",
+                                                  CommSystem,
+                                                  bench_sig,
+                                                  1.0, //samp_intvl
+                                                  BENCH_MODEL_BLOCK );
+
+   Exec.MultirateSetup();
+   CommSystemGraph.EnableProfiling( PROFILE_MODE_FULL, 1,
+                                    SIM_NAME, 0 );
+   for( int pass_number=1; pass_number<=Max_Pass_Number; pass_number++){
+      PassNumber = pass_number;
+      CommSystemGraph.RunSimulation();
+   }
+   CommSystemGraph.DeleteModels();
+   return 0;
+}
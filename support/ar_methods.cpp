@@ -0,0 +1,71 @@
+//
+//  File = ar_methods.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "parmfile.h"
+#include "ar_methods.h"
+#include "psstream.h"
+extern ParmFile *ParmInput;
+
+//======================================================
+
+AR_METHOD_T GetArMethodParm(const char* parm_nam)
+{
+  char parm_str[30];
+
+  if(ParmInput->GetParmStr(parm_nam, parm_str)!=0)
+    {
+    ParmInput->RestartBlock();
+    if(ParmInput->GetParmStr(parm_nam, parm_str) !=0)
+      {
+      ErrorStream <<  "Error: parameter '" << parm_nam 
+                  << "' not found after 2 attempts" << endl;
+      exit(-1);
+      }
+    }
+
+  if(!strcmp(parm_str,"AR_METHOD_YULE_WALKER")) return(AR_METHOD_YULE_WALKER);
+  if(!strcmp(parm_str,"AR_METHOD_BURG")) return(AR_METHOD_BURG);
+  if(!strcmp(parm_str,"AR_METHOD_COVARIANCE")) return(AR_METHOD_COVARIANCE);
+  ErrorStream <<  "Error: '" << parm_str 
+              << "' is not a legal value for type AR_METHOD_T" << endl;
+  exit(-1);
+}
+ostream& operator<<( ostream& s, const AR_METHOD_T& ar_method_val)
+{
+  switch (ar_method_val)
+    {
+    case AR_METHOD_YULE_WALKER:
+      s << "AR_METHOD_YULE_WALKER";
+      break;
+    case AR_METHOD_BURG:
+      s << "AR_METHOD_BURG";
+      break;
+    case AR_METHOD_COVARIANCE:
+      s << "AR_METHOD_COVARIANCE";
+      break;
+    default:
+      s << "unknown AR_METHOD_T";
+    } // end of switch on ar_method_val
+ return s;
+}
+PracSimStream& operator<<( PracSimStream& s, const AR_METHOD_T& ar_method_val)
+{
+  switch (ar_method_val)
+    {
+    case AR_METHOD_YULE_WALKER:
+      s << "AR_METHOD_YULE_WALKER";
+      break;
+    case AR_METHOD_BURG:
+      s << "AR_METHOD_BURG";
+      break;
+    case AR_METHOD_COVARIANCE:
+      s << "AR_METHOD_COVARIANCE";
+      break;
+    default:
+      s << "unknown AR_METHOD_T";
+    } // end of switch on ar_method_val
+ return s;
+}
@@ -19,7 +19,7 @@ extern int PassNumber;
 //======================================================
 
 template< class T >
-Control<T>::Control<T>( char* name, PracSimModel* model )
+Control<T>::Control( char* name, PracSimModel* model )
           :GenericControl( name, model )
 {
   Cntrl_Value = 0;
@@ -27,14 +27,14 @@ Control<T>::Control<T>( char* name, PracSimModel* model )
 //======================================================
 
 template< class T >
-Control<T>::Control<T>( char* name )
+Control<T>::Control( char* name )
           :GenericControl( name, CommSystem )
 {
   Cntrl_Value = 0;
 }
 //======================================================
 template< class T >
-Control<T>::~Control<T>( void )
+Control<T>::~Control( void )
 {
 };
 
@@ -59,8 +59,8 @@ void Control<T>::SetValue(T value)
 //  out_file << GetName() << " = " << Cntrl_Value << endl;
 //  return;
 //}
-template Control<bool>;
-template Control<int>;
-template Control<float>;
-template Control<double>;
+template class Control<bool>;
+template class Control<int>;
+template class Control<float>;
+template class Control<double>;
 
@@ -4,10 +4,18 @@
 
 #include <stdlib.h>
 #include <fstream>
+#include <chrono>
+#ifndef _WIN32
+  #include <stdio.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/wait.h>
+#endif
 #include "exec.h"
 #include "syst_graph.h"
 #include "model_graph.h"
 #include "sigplot.h"
+#include "psstream.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -16,13 +24,17 @@
 extern SystemGraph CommSystemGraph;
 extern SignalPlotter SigPlot;
 extern int PassNumber;
+extern int MaxPassNumber;
 extern PracSimModel *PrevModelConstr;
+extern PracSimStream DetailedResults;
 
 //============================================
 // constructor
 
 Executive::Executive()
 {
+  Block_Tuning_Enabled = false;
+  Num_Tuning_Passes = 0;
   return;
 }
 //============================================
@@ -37,6 +49,13 @@ void Executive::MultirateSetup(void)
 {
     PrevModelConstr->CloseoutModelGraph(2);
     PrevModelConstr = NULL;
+
+  //--------------------------------------------
+  //  Optional calibration runs to pick the block
+  //  size.  Done ahead of plotting setup so that
+  //  no plot data are issued.
+
+  if(Block_Tuning_Enabled) TuneBlockSize();
   //SigMgr.DumpInputs();
   //SigMgr.DumpInternals();
   //SigMgr.DumpOutputs();
@@ -98,6 +117,13 @@ void Executive::MultirateSetup(void)
 
   CommSystemGraph.DistributeSignalParms();
 
+  //------------------------------------------------
+  //  Alias the outputs of static pass-through models
+  //  to their inputs so that no buffer is allocated,
+  //  copied, or executed for them.
+
+  CommSystemGraph.AliasPassThruSignals();
+
   //-----------------------------------------------
   // Allocate node buffer arrays for each active node
 
@@ -131,4 +157,219 @@ void Executive::MultirateSetup(void)
 /////////////////////////////////////////////////////  CommSystemGraph.SecondInit();
 
   return;
-}
\ No newline at end of file
+}
+//============================================
+//  Called from a sim's main() before sim_postamble to have
+//  MultirateSetup() choose the block size.  Each candidate
+//  is timed over the same number of samples as
+//  num_tuning_passes passes at the SignalAnchor block size.
+
+void Executive::EnableBlockSizeTuning(int num_tuning_passes)
+{
+  Block_Tuning_Enabled = true;
+  Num_Tuning_Passes = num_tuning_passes;
+}
+//============================================
+//  Runs the system at each power-of-two scaling of the
+//  SignalAnchor block sizes that is consistent with the SDG
+//  (including any block granularity the models declared),
+//  then leaves the SDG set to the fastest one.
+//
+//  Each candidate runs in a forked child process, so the
+//  calibration passes see a throwaway copy of every model
+//  -- counters, RNG seeds, decoder history, stop requests
+//  and buffers all vanish with the child, and whatever it
+//  writes to files or the console is sent to the null
+//  device.  The parent only resolves the SDG.  Without
+//  fork() (Windows) the SignalAnchor sizes are kept.
+
+void Executive::TuneBlockSize(void)
+{
+  int scale_log2, scale_numer, scale_denom;
+  int best_numer, best_denom;
+  double secs_per_pass, best_secs_per_pass;
+  GenericSignal *anchor_sig;
+
+  CommSystemGraph.ResolveSignalParms();
+  anchor_sig = CommSystemGraph.GetTunableSignal();
+  if(anchor_sig == NULL)
+    {
+    DetailedResults << "Block size tuning skipped -- no SignalAnchor block size" << endl;
+    return;
+    }
+#ifdef _WIN32
+  DetailedResults << "Block size tuning skipped -- calibration runs need fork()" << endl;
+  return;
+#else
+
+  DetailedResults << "\nBlock size tuning for signal "
+                  << anchor_sig->GetName() << endl;
+  best_numer = 1;
+  best_denom = 1;
+  best_secs_per_pass = -1.0;
+
+  for( scale_log2 = BLOCK_TUNE_MIN_LOG2;
+       scale_log2 <= BLOCK_TUNE_MAX_LOG2;
+       scale_log2++)
+    {
+    scale_numer = (scale_log2 > 0) ? (1 << scale_log2) : 1;
+    scale_denom = (scale_log2 < 0) ? (1 << (-scale_log2)) : 1;
+    if(!CommSystemGraph.ScaleBlockSizes(scale_numer, scale_denom)) continue;
+    CommSystemGraph.DistributeSignalParms();
+
+    secs_per_pass = TimeBlockSizeCandidate(scale_numer, scale_denom);
+    if(secs_per_pass < 0.0)
+      {
+      DetailedResults << "   block size " << anchor_sig->GetBlockSize()
+                      << ": calibration run failed" << endl;
+      continue;
+      }
+
+    DetailedResults << "   block size " << anchor_sig->GetBlockSize()
+                    << ": " << secs_per_pass
+                    << " sec per " << (anchor_sig->GetBlockSize() * scale_denom / scale_numer)
+                    << " samples" << endl;
+
+    if( (best_secs_per_pass < 0.0) || (secs_per_pass < best_secs_per_pass) )
+      {
+      best_secs_per_pass = secs_per_pass;
+      best_numer = scale_numer;
+      best_denom = scale_denom;
+      }
+    }
+
+  CommSystemGraph.ScaleBlockSizes(best_numer, best_denom);
+  CommSystemGraph.DistributeSignalParms();
+  DetailedResults << "   chosen block size is " << anchor_sig->GetBlockSize()
+                  << endl;
+#endif
+}
+#ifndef _WIN32
+//============================================
+//  In the calibration child: points every descriptor except
+//  keep_fd at the null device.  A file that is only being
+//  read is reopened instead, at the same offset, so the
+//  child's reads do not move the parent's file position.
+
+static void DetachChildFiles(int keep_fd)
+{
+  int fd, max_fd, null_fd, new_fd, flags;
+  char link_name[32];
+  char file_name[1024];
+  ssize_t name_len;
+  off_t offset;
+
+  null_fd = open("/dev/null", O_RDWR);
+  max_fd = int(sysconf(_SC_OPEN_MAX));
+  if(max_fd < 0 || max_fd > 65536) max_fd = 65536;
+
+  for(fd = 0; fd < max_fd; fd++)
+    {
+    if(fd == keep_fd || fd == null_fd) continue;
+    flags = fcntl(fd, F_GETFL);
+    if(flags == -1) continue;
+
+    new_fd = -1;
+    if((flags & O_ACCMODE) == O_RDONLY)
+      {
+      sprintf(link_name, "/proc/self/fd/%d", fd);
+      name_len = readlink(link_name, file_name, sizeof(file_name)-1);
+      offset = lseek(fd, 0, SEEK_CUR);
+      if(name_len > 0 && offset >= 0)
+        {
+        file_name[name_len] = '\0';
+        new_fd = open(file_name, O_RDONLY);
+        if(new_fd >= 0) lseek(new_fd, offset, SEEK_SET);
+        }
+      }
+    if(new_fd >= 0)
+      {
+      dup2(new_fd, fd);
+      close(new_fd);
+      }
+    else if(null_fd >= 0)
+      {
+      dup2(null_fd, fd);
+      }
+    }
+}
+//============================================
+//  Returns the time for one pass's worth of samples at the
+//  SignalAnchor block size when the SDG is scaled by
+//  scale_numer/scale_denom, or -1 if the calibration child
+//  did not report (e.g. a model rejected the block size).
+
+double Executive::TimeBlockSizeCandidate( int scale_numer,
+                                          int scale_denom )
+{
+  int pipe_fds[2];
+  int pass_num, num_passes, child_status;
+  double elapsed_secs, secs_per_pass;
+  std::chrono::steady_clock::time_point start_time;
+  pid_t child_pid;
+
+  if(pipe(pipe_fds) != 0) return(-1.0);
+  cout.flush();
+  fflush(NULL);
+
+  child_pid = fork();
+  if(child_pid < 0)
+    {
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+    return(-1.0);
+    }
+
+  if(child_pid == 0)
+    {
+    close(pipe_fds[0]);
+    DetachChildFiles(pipe_fds[1]);
+
+    CommSystemGraph.AliasPassThruSignals();
+    CommSystemGraph.AllocateStorageBuffers();
+    CommSystemGraph.InitializeReadPtrs();
+    CommSystemGraph.InitializeModels();
+
+    //-----------------------------------------
+    // same number of samples for every candidate,
+    // plus one untimed pass to warm the caches
+
+    num_passes = (Num_Tuning_Passes * scale_denom) / scale_numer;
+    if(num_passes < 1) num_passes = 1;
+
+    PassNumber = 1;
+    CommSystemGraph.RunSimulation();
+    start_time = std::chrono::steady_clock::now();
+    for(pass_num = 2; pass_num <= num_passes+1; pass_num++)
+      {
+      PassNumber = pass_num;
+      CommSystemGraph.RunSimulation();
+      }
+    // wall time -- clock() would count CPU time summed over
+    // every thread the models run
+    elapsed_secs = std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - start_time).count();
+
+    // time for the samples in one pass at the anchor block size
+    secs_per_pass = elapsed_secs * scale_denom / (double(scale_numer) * num_passes);
+
+    if(write(pipe_fds[1], &secs_per_pass, sizeof(double)) != sizeof(double))
+      {
+      _exit(1);
+      }
+    _exit(0);
+    }
+
+  //--------------------------------------------
+  //  parent
+
+  close(pipe_fds[1]);
+  if(read(pipe_fds[0], &secs_per_pass, sizeof(double)) != sizeof(double))
+    {
+    secs_per_pass = -1.0;
+    }
+  close(pipe_fds[0]);
+  waitpid(child_pid, &child_status, 0);
+  return(secs_per_pass);
+}
+#endif
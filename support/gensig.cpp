@@ -22,13 +22,17 @@ GenericSignal::GenericSignal( char* name,
    Name = new char[strlen(name)+2];
    strcpy(Name, name);
    Connected_Sigs = new std::vector<GenericSignal*>;
+   Alias_Sigs = new std::vector<GenericSignal*>;
    Root_Id = this;
    Sig_Is_Root = true;
    Plot_Setup_Complete = false;
    Plotting_Enabled = false;
    Time_At_Beg = 0.0;
    Alloc_Mem_Depth = 0;
+   Block_Granularity = 1;
    Cumul_Samp_Cnt = 0;
+   Alias_Src = NULL;
+   Producer_Model = NULL;
 }
 //======================================================
 GenericSignal::~GenericSignal( void )
@@ -121,6 +125,98 @@ void GenericSignal::SetAllocMemDepth(int req_mem_depth)
    }
 }
 //======================================================
+int GenericSignal::GetAllocMemDepth(void)
+{
+   return(Alloc_Mem_Depth);
+}
+//======================================================
+//  Makes this signal an alias of src_sig, so that it will
+//  share src_sig's buffer instead of getting its own.
+//  Only root signals are aliased.  The source keeps a list
+//  of its aliases so that read pointers it is given at run
+//  time can be passed along to them.
+
+void GenericSignal::SetAliasSource( GenericSignal* src_sig )
+{
+   if(!Sig_Is_Root){
+      Root_Id->SetAliasSource(src_sig);
+      return;
+   }
+   Alias_Src = src_sig->GetId();
+   Alias_Src->Alias_Sigs->push_back(this);
+#ifdef _DEBUG
+   *DebugFile << "signal " << Name << " aliased to "
+      << Alias_Src->GetName() << endl;
+#endif
+}
+//======================================================
+bool GenericSignal::IsAliased(void)
+{
+   if(!Sig_Is_Root) return(Root_Id->IsAliased());
+   return(Alias_Src != NULL);
+}
+//======================================================
+//  Follows a chain of aliases back to the signal whose
+//  buffer is actually allocated.
+
+GenericSignal* GenericSignal::GetAliasRoot(void)
+{
+   GenericSignal *sig_id;
+
+   sig_id = GetId();
+   while(sig_id->Alias_Src != NULL){
+      sig_id = sig_id->Alias_Src;
+   }
+   return(sig_id);
+}
+//======================================================
+//  Returns true if any model reads this signal or if the
+//  signal is being plotted.  Models can use this to skip
+//  generating outputs that nobody looks at.
+
+bool GenericSignal::HasConsumers(void)
+{
+   if(!Sig_Is_Root) return(Root_Id->HasConsumers());
+   return( (Connected_Sigs->size() > 0) || Plotting_Enabled );
+}
+//======================================================
+bool GenericSignal::PlottingIsEnabled(void)
+{
+   if(!Sig_Is_Root) return(Root_Id->PlottingIsEnabled());
+   return(Plotting_Enabled);
+}
+//======================================================
+//  The producer is the system-level model that writes the
+//  signal (set by MAKE_OUTPUT).  The consumers are the
+//  models that own its connections (made by MAKE_INPUT).
+
+void GenericSignal::SetProducer( PracSimModel* model )
+{
+   if(!Sig_Is_Root){
+      Root_Id->SetProducer(model);
+      return;
+   }
+   Producer_Model = model;
+}
+//======================================================
+PracSimModel* GenericSignal::GetProducer(void)
+{
+   if(!Sig_Is_Root) return(Root_Id->GetProducer());
+   return(Producer_Model);
+}
+//======================================================
+int GenericSignal::GetNumConsumers(void)
+{
+   if(!Sig_Is_Root) return(Root_Id->GetNumConsumers());
+   return(int(Connected_Sigs->size()));
+}
+//======================================================
+PracSimModel* GenericSignal::GetConsumer(int conn_num)
+{
+   if(!Sig_Is_Root) return(Root_Id->GetConsumer(conn_num));
+   return(Connected_Sigs->at(conn_num)->Owning_Model);
+}
+//======================================================
 void GenericSignal::SetupPlotFile(GenericSignal* sig_id,
                                   double start_time,
                                   double stop_time,
@@ -172,3 +268,34 @@ void GenericSignal::SetTimeAtBeg(double time_at_beg)
    Time_At_Beg = time_at_beg;
    return;
 }
+//======================================================
+//  A model whose Execute() works in whole frames calls this
+//  (via SET_BLOCK_GRANULARITY) so that the block size tuner
+//  only tries block sizes that are a multiple of the frame.
+//  Requests from several models are combined by their least
+//  common multiple.
+
+void GenericSignal::SetBlockGranularity( int samps_per_frame )
+{
+   int a, b, rem;
+
+   if(!Sig_Is_Root){
+      Root_Id->SetBlockGranularity(samps_per_frame);
+      return;
+   }
+   if(samps_per_frame <= 1) return;
+   a = Block_Granularity;
+   b = samps_per_frame;
+   while(b != 0){
+      rem = a % b;
+      a = b;
+      b = rem;
+   }
+   Block_Granularity = (Block_Granularity / a) * samps_per_frame;
+}
+//======================================================
+int GenericSignal::GetBlockGranularity(void)
+{
+   if(!Sig_Is_Root) return(Root_Id->GetBlockGranularity());
+   return(Block_Granularity);
+}
@@ -25,6 +25,7 @@ ModelGraph::ModelGraph(PracSimModel* owning_model)
    Vertex_Kind = new std::vector<SignalKinds_type>;
    Node_Is_Feedback = new std::vector<bool>;
    Block_Size = new std::vector<int>;
+   Block_Size_Is_Tunable = new std::vector<bool>;
    Samp_Intvl = new std::vector<double>;
    Resamp_Rate = new std::vector<double>;
    Const_Intvl = new std::vector<bool>;
@@ -56,6 +57,7 @@ void ModelGraph::InsertSignal( GenericSignal *new_sig_id,
    Vertex_Kind->push_back(SK_REGULAR_SIGNAL);
    Node_Is_Feedback->push_back(false);
    Block_Size->push_back(0);
+   Block_Size_Is_Tunable->push_back(false);
    Samp_Intvl->push_back(0.0);
 
    //------------------------------------------------------------
@@ -175,6 +177,24 @@ void ModelGraph::SetBlockSize( GenericSignal* sig_id,
 {
    int sig_num = Sig_Dep_Graph->GetVertexNum(sig_id->GetId());
    Block_Size->at(sig_num) = block_size;
+   Block_Size_Is_Tunable->at(sig_num) = false;
+}
+//===============================================================
+//  Used by SignalAnchor.  Unlike a block size that a model
+//  requires (e.g. one tied to an FFT size), a tunable block
+//  size may be scaled by the block size tuner.
+
+void ModelGraph::SetTunableBlockSize( GenericSignal* sig_id,
+                                      int block_size)
+{
+   int sig_num = Sig_Dep_Graph->GetVertexNum(sig_id->GetId());
+   Block_Size->at(sig_num) = block_size;
+   Block_Size_Is_Tunable->at(sig_num) = true;
+}
+//===============================================================
+bool ModelGraph::BlockSizeIsTunable(int vtx_num)
+{
+   return(Block_Size_Is_Tunable->at(vtx_num));
 }
 //===============================================================
 double ModelGraph::GetSampIntvl(int vtx_num)
@@ -290,6 +310,7 @@ void ModelGraph::Closeout( PracSimModel* model_ptr)
 
          Vertex_Kind->push_back(SK_DUMMY_DEST_SIGNAL);
          Block_Size->push_back(0);
+         Block_Size_Is_Tunable->push_back(false);
          Samp_Intvl->push_back(0.0);
 
          //-------------------------------------------------------
@@ -324,6 +345,7 @@ void ModelGraph::Closeout( PracSimModel* model_ptr)
 
          Vertex_Kind->push_back(SK_DUMMY_SOURCE_SIGNAL);
          Block_Size->push_back(0);
+         Block_Size_Is_Tunable->push_back(false);
          Samp_Intvl->push_back(0.0);
 
          //-------------------------------------------------------
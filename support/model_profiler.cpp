@@ -0,0 +1,238 @@
+//
+//  File = model_profiler.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <iomanip>
+#include <chrono>
+#include "model_profiler.h"
+
+//======================================================
+//  constructor
+
+ModelProfiler::ModelProfiler( PROFILE_MODE_T profile_mode,
+                              int sample_intvl )
+{
+   Profile_Mode = profile_mode;
+   Sample_Intvl = (sample_intvl > 0) ? sample_intvl : 1;
+   Timed_Pass = -1;
+   Num_Timed_Passes = 0;
+   Pass_Ns = 0;
+   Clock_Origin = ReadClock();
+
+   Trace_File = NULL;
+   Trace_File_Name = NULL;
+   Max_Trace_Passes = 0;
+   Num_Traced_Passes = 0;
+   Trace_Pass = false;
+   First_Trace_Event = true;
+}
+//======================================================
+ModelProfiler::~ModelProfiler(void)
+{
+   CloseTrace();
+   delete[] Trace_File_Name;
+   for(int i=0; i<int(Model_Prof.size()); i++){
+      delete Model_Prof[i];
+   }
+}
+//======================================================
+void ModelProfiler::EnableTrace( const char *trace_file_name,
+                                 int max_trace_passes )
+{
+   CloseTrace();
+   if(trace_file_name != Trace_File_Name){
+      delete[] Trace_File_Name;
+      Trace_File_Name = new char[strlen(trace_file_name)+1];
+      strcpy(Trace_File_Name, trace_file_name);
+   }
+   Trace_File = new ofstream(Trace_File_Name, ios::out);
+   *Trace_File << "{\"traceEvents\":[";
+   Max_Trace_Passes = max_trace_passes;
+   Num_Traced_Passes = 0;
+   First_Trace_Event = true;
+}
+//======================================================
+void ModelProfiler::CloseTrace(void)
+{
+   if(Trace_File == NULL) return;
+   *Trace_File << "\n]}" << endl;
+   Trace_File->close();
+   delete Trace_File;
+   Trace_File = NULL;
+}
+//======================================================
+void ModelProfiler::AddModel( PracSimModel *model )
+{
+   model_prof_type *prof = new model_prof_type;
+   prof->model_id = model;
+   prof->exec_ns = 0;
+   prof->num_samps = 0;
+   prof->num_calls = 0;
+   Model_Prof.push_back(prof);
+}
+//======================================================
+void ModelProfiler::AddCountedSignal( int model_num,
+                                      GenericSignal *sig_id )
+{
+   Model_Prof.at(model_num)->counted_sigs.push_back(sig_id);
+}
+//======================================================
+bool ModelProfiler::PassIsTimed( int pass_number )
+{
+   if(Profile_Mode == PROFILE_MODE_OFF) return(false);
+   if( (Profile_Mode == PROFILE_MODE_SAMPLED) &&
+       ((pass_number % Sample_Intvl) != 0) ) return(false);
+
+   // first model of a newly timed pass
+   if(pass_number != Timed_Pass){
+      Timed_Pass = pass_number;
+      Num_Timed_Passes++;
+      Trace_Pass = (Trace_File != NULL) &&
+                   (Num_Traced_Passes < Max_Trace_Passes);
+      if(Trace_Pass) Num_Traced_Passes++;
+   }
+   return(true);
+}
+//======================================================
+long long ModelProfiler::ReadClock(void)
+{
+   return( std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now().time_since_epoch()).count() );
+}
+//======================================================
+void ModelProfiler::RecordExec( int model_num,
+                                long long start_ns,
+                                long long stop_ns )
+{
+   model_prof_type *prof = Model_Prof[model_num];
+   long long num_samps = 0;
+   int num_sigs = int(prof->counted_sigs.size());
+
+   for(int i=0; i<num_sigs; i++){
+      num_samps += prof->counted_sigs[i]->GetValidBlockSize();
+   }
+   prof->exec_ns += stop_ns - start_ns;
+   prof->num_samps += num_samps;
+   prof->num_calls++;
+
+   if(!Trace_Pass) return;
+   if(!First_Trace_Event) *Trace_File << ",";
+   First_Trace_Event = false;
+   *Trace_File << "\n{\"name\":\"" << prof->model_id->GetInstanceName()
+               << "\",\"cat\":\"" << prof->model_id->GetModelName()
+               << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+               << ",\"ts\":" << (start_ns - Clock_Origin)/1000.0
+               << ",\"dur\":" << (stop_ns - start_ns)/1000.0
+               << ",\"args\":{\"pass\":" << Timed_Pass
+               << ",\"samps\":" << num_samps << "}}";
+}
+//======================================================
+void ModelProfiler::RecordPass( long long start_ns,
+                                long long stop_ns )
+{
+   Pass_Ns += stop_ns - start_ns;
+}
+//======================================================
+void ModelProfiler::Reset(void)
+{
+   for(int i=0; i<int(Model_Prof.size()); i++){
+      Model_Prof[i]->exec_ns = 0;
+      Model_Prof[i]->num_samps = 0;
+      Model_Prof[i]->num_calls = 0;
+   }
+   Timed_Pass = -1;
+   Num_Timed_Passes = 0;
+   Pass_Ns = 0;
+   if(Trace_File != NULL) EnableTrace(Trace_File_Name, Max_Trace_Passes);
+}
+//======================================================
+void ModelProfiler::WriteReport( ofstream &report_file )
+{
+   int i;
+   long long total_ns = 0;
+   double share, ns_per_samp, msamps_per_sec;
+   model_prof_type *prof;
+
+   CloseTrace();
+   for(i=0; i<int(Model_Prof.size()); i++){
+      total_ns += Model_Prof[i]->exec_ns;
+   }
+   if(total_ns <= 0) return;
+
+   report_file << "\nModel execution profile (" << Num_Timed_Passes
+               << " timed passes, " << total_ns*1.0e-9
+               << " sec in Execute, " << Pass_Ns*1.0e-6/Num_Timed_Passes
+               << " ms per pass)" << endl;
+   report_file << setw(24) << left << "instance"
+               << setw(24) << "model" << right
+               << setw(10) << "share %"
+               << setw(14) << "samples"
+               << setw(12) << "ns/sample"
+               << setw(12) << "Msamp/s" << endl;
+
+   for(i=0; i<int(Model_Prof.size()); i++){
+      prof = Model_Prof[i];
+      if(prof->num_calls == 0) continue;
+      share = 100.0 * double(prof->exec_ns) / double(total_ns);
+      report_file << setw(24) << left << prof->model_id->GetInstanceName()
+                  << setw(24) << prof->model_id->GetModelName() << right
+                  << setw(10) << fixed << setprecision(2) << share
+                  << setw(14) << setprecision(0) << double(prof->num_samps)
+                  << setprecision(1);
+      if(prof->num_samps > 0){
+         ns_per_samp = double(prof->exec_ns) / double(prof->num_samps);
+         msamps_per_sec = 1.0e3 / ns_per_samp;
+         report_file << setw(12) << ns_per_samp
+                     << setw(12) << setprecision(3) << msamps_per_sec;
+      }
+      else{
+         report_file << setw(12) << "-" << setw(12) << "-";
+      }
+      report_file << endl;
+      report_file.unsetf(ios::fixed);
+   }
+   report_file << setprecision(6);
+}
+//======================================================
+void ModelProfiler::WriteJson( const char *json_file_name,
+                               const char *sim_name )
+{
+   int i;
+   long long total_ns = 0;
+   model_prof_type *prof;
+   bool first_entry = true;
+   ofstream json_file(json_file_name, ios::out);
+
+   for(i=0; i<int(Model_Prof.size()); i++){
+      total_ns += Model_Prof[i]->exec_ns;
+   }
+   json_file << setprecision(9);
+   json_file << "{\"sim\":\"" << sim_name << "\""
+             << ",\"timed_passes\":" << Num_Timed_Passes
+             << ",\"exec_sec\":" << total_ns*1.0e-9
+             << ",\"pass_sec\":" << Pass_Ns*1.0e-9
+             << ",\"passes_per_sec\":"
+             << ((Pass_Ns > 0) ? Num_Timed_Passes*1.0e9/Pass_Ns : 0.0)
+             << ",\"models\":[";
+   for(i=0; i<int(Model_Prof.size()); i++){
+      prof = Model_Prof[i];
+      if(prof->num_calls == 0) continue;
+      if(!first_entry) json_file << ",";
+      first_entry = false;
+      json_file << "\n{\"instance\":\"" << prof->model_id->GetInstanceName()
+                << "\",\"model\":\"" << prof->model_id->GetModelName()
+                << "\",\"calls\":" << prof->num_calls
+                << ",\"exec_ns\":" << prof->exec_ns
+                << ",\"samples\":" << prof->num_samps
+                << ",\"share\":"
+                << ((total_ns > 0) ? double(prof->exec_ns)/total_ns : 0.0)
+                << ",\"ns_per_sample\":"
+                << ((prof->num_samps > 0) ?
+                    double(prof->exec_ns)/prof->num_samps : 0.0)
+                << "}";
+   }
+   json_file << "\n]}" << endl;
+   json_file.close();
+}
@@ -5,7 +5,15 @@
 #include <stdlib.h>
 #include <fstream>
 #include <string.h>
-#include <direct.h>
+#include <ctype.h>
+#ifdef _WIN32
+  #include <direct.h>
+#else
+  #include <unistd.h>
+  #include <limits.h>
+  #define _getcwd getcwd
+  #define _MAX_PATH PATH_MAX
+#endif
 #include "parmfile.h"
 
 
@@ -38,7 +46,8 @@ ParmFile::~ParmFile( void ){ };
 void ParmFile::FindBlock(const char* block_nam)
 {
   char linebuf[80];
-  strcpy(Block_Name, block_nam);
+  // RestartBlock() passes Block_Name itself
+  if(block_nam != Block_Name) strcpy(Block_Name, block_nam);
   
    char buffer[_MAX_PATH];
 
@@ -48,7 +57,11 @@ void ParmFile::FindBlock(const char* block_nam)
    else
       cout << "%s\n" << buffer << endl;
 
-  if(Input_File != NULL) Input_File->close();
+  if(Input_File != NULL)
+    {
+    Input_File->close();
+    delete Input_File;
+    }
   Input_File = new ifstream(Input_File_Name, ios::in);
   //
   // find block
@@ -72,6 +85,32 @@ void ParmFile::RestartBlock(void)
   FindBlock(Block_Name);
 }
 //======================================================
+// Scans the current block for parm_nam without reporting a missing
+// parameter, then rewinds to the start of the block so that the
+// next Get*Parm call finds the value.
+bool ParmFile::ParmIsPresent(const char* parm_nam)
+{
+  char linebuf[80], scanbuf[80];
+  char *token;
+  bool found = false;
+
+  FindBlock(Block_Name);
+  for(;;)
+    {
+    Input_File->getline(linebuf,80);
+    if(Input_File->fail() || strstr(linebuf,"$") != NULL) break;
+    strcpy(scanbuf,linebuf);
+    token = strtok( scanbuf, " =\n");
+    if(token != NULL && !strcmp(token,parm_nam))
+      {
+      found = true;
+      break;
+      }
+    }
+  FindBlock(Block_Name);
+  return(found);
+}
+//======================================================
 void ParmFile::GetPlotSpec( char *sig_name,
                             double *start_time,
                             double *stop_time,
@@ -368,6 +407,47 @@ long ParmFile::GetLongParm(const char* parm_nam)
   return(num);
 }
 
+//======================================================
+//  Value given as up to 16 hex digits, with or without a
+//  leading 0x.  Used for polynomials and tap masks, which
+//  need all 64 bits.
+
+unsigned long long ParmFile::GetHexParm(const char* parm_nam)
+{
+  unsigned long long num;
+  char parm_str[30];
+  char *digits, *c_ptr;
+
+  if(GetParmStr(parm_nam, parm_str)!=0)
+    {
+    FindBlock(Block_Name);
+    if(GetParmStr(parm_nam, parm_str) !=0)
+      {
+      ErrorStream <<  "Error: parameter '" << parm_nam 
+                  << "' not found after 2 attempts" << endl;
+      exit(-1);
+      }
+    }
+  cout << "str = " << parm_str << endl;
+  digits = parm_str;
+  if(digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) digits += 2;
+  if(strlen(digits) == 0 || strlen(digits) > 16)
+    {
+    ErrorStream << "Error: parameter '" << parm_nam
+                << "' needs 1 to 16 hex digits" << endl;
+    exit(-1);
+    }
+  for(c_ptr=digits; *c_ptr != '\0'; c_ptr++)
+    {
+    if(!isxdigit(*c_ptr))
+      {
+      ErrorStream << "Error: non-hex data where hex expected" << endl;
+      exit(-1);
+      }
+    }
+  num = strtoull(digits, NULL, 16);
+  return(num);
+}
 //======================================================
 float ParmFile::GetFloatParm(const char* parm_nam)
 {
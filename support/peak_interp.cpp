@@ -0,0 +1,71 @@
+//
+//  File = peak_interp.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "parmfile.h"
+#include "peak_interp.h"
+#include "psstream.h"
+extern ParmFile *ParmInput;
+
+//======================================================
+
+PEAK_INTERP_T GetPeakInterpParm(const char* parm_nam)
+{
+  char parm_str[30];
+
+  if(ParmInput->GetParmStr(parm_nam, parm_str)!=0)
+    {
+    ParmInput->RestartBlock();
+    if(ParmInput->GetParmStr(parm_nam, parm_str) !=0)
+      {
+      ErrorStream <<  "Error: parameter '" << parm_nam 
+                  << "' not found after 2 attempts" << endl;
+      exit(-1);
+      }
+    }
+
+  if(!strcmp(parm_str,"PEAK_INTERP_NONE")) return(PEAK_INTERP_NONE);
+  if(!strcmp(parm_str,"PEAK_INTERP_PARABOLIC")) return(PEAK_INTERP_PARABOLIC);
+  if(!strcmp(parm_str,"PEAK_INTERP_SINC")) return(PEAK_INTERP_SINC);
+  ErrorStream <<  "Error: '" << parm_str 
+              << "' is not a legal value for type PEAK_INTERP_T" << endl;
+  exit(-1);
+}
+ostream& operator<<( ostream& s, const PEAK_INTERP_T& peak_interp_val)
+{
+  switch (peak_interp_val)
+    {
+    case PEAK_INTERP_NONE:
+      s << "PEAK_INTERP_NONE";
+      break;
+    case PEAK_INTERP_PARABOLIC:
+      s << "PEAK_INTERP_PARABOLIC";
+      break;
+    case PEAK_INTERP_SINC:
+      s << "PEAK_INTERP_SINC";
+      break;
+    default:
+      s << "unknown PEAK_INTERP_T";
+    } // end of switch on peak_interp_val
+ return s;
+}
+PracSimStream& operator<<( PracSimStream& s, const PEAK_INTERP_T& peak_interp_val)
+{
+  switch (peak_interp_val)
+    {
+    case PEAK_INTERP_NONE:
+      s << "PEAK_INTERP_NONE";
+      break;
+    case PEAK_INTERP_PARABOLIC:
+      s << "PEAK_INTERP_PARABOLIC";
+      break;
+    case PEAK_INTERP_SINC:
+      s << "PEAK_INTERP_SINC";
+      break;
+    default:
+      s << "unknown PEAK_INTERP_T";
+    } // end of switch on peak_interp_val
+ return s;
+}
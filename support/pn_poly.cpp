@@ -0,0 +1,92 @@
+//
+//  File = pn_poly.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "parmfile.h"
+#include "pn_poly.h"
+#include "psstream.h"
+extern ParmFile *ParmInput;
+
+//======================================================
+
+PN_POLY_T GetPnPolyParm(const char* parm_nam)
+{
+  char parm_str[30];
+
+  if(ParmInput->GetParmStr(parm_nam, parm_str)!=0)
+    {
+    ParmInput->RestartBlock();
+    if(ParmInput->GetParmStr(parm_nam, parm_str) !=0)
+      {
+      ErrorStream <<  "Error: parameter '" << parm_nam 
+                  << "' not found after 2 attempts" << endl;
+      exit(-1);
+      }
+    }
+
+  if(!strcmp(parm_str,"PN_POLY_PRBS7")) return(PN_POLY_PRBS7);
+  if(!strcmp(parm_str,"PN_POLY_PRBS15")) return(PN_POLY_PRBS15);
+  if(!strcmp(parm_str,"PN_POLY_PRBS23")) return(PN_POLY_PRBS23);
+  if(!strcmp(parm_str,"PN_POLY_PRBS31")) return(PN_POLY_PRBS31);
+  if(!strcmp(parm_str,"PN_POLY_SIMPLEST")) return(PN_POLY_SIMPLEST);
+  if(!strcmp(parm_str,"PN_POLY_CUSTOM")) return(PN_POLY_CUSTOM);
+  ErrorStream <<  "Error: '" << parm_str 
+              << "' is not a legal value for type PN_POLY_T" << endl;
+  exit(-1);
+}
+ostream& operator<<( ostream& s, const PN_POLY_T& pn_poly_val)
+{
+  switch (pn_poly_val)
+    {
+    case PN_POLY_PRBS7:
+      s << "PN_POLY_PRBS7";
+      break;
+    case PN_POLY_PRBS15:
+      s << "PN_POLY_PRBS15";
+      break;
+    case PN_POLY_PRBS23:
+      s << "PN_POLY_PRBS23";
+      break;
+    case PN_POLY_PRBS31:
+      s << "PN_POLY_PRBS31";
+      break;
+    case PN_POLY_SIMPLEST:
+      s << "PN_POLY_SIMPLEST";
+      break;
+    case PN_POLY_CUSTOM:
+      s << "PN_POLY_CUSTOM";
+      break;
+    default:
+      s << "unknown PN_POLY_T";
+    } // end of switch on pn_poly_val
+ return s;
+}
+PracSimStream& operator<<( PracSimStream& s, const PN_POLY_T& pn_poly_val)
+{
+  switch (pn_poly_val)
+    {
+    case PN_POLY_PRBS7:
+      s << "PN_POLY_PRBS7";
+      break;
+    case PN_POLY_PRBS15:
+      s << "PN_POLY_PRBS15";
+      break;
+    case PN_POLY_PRBS23:
+      s << "PN_POLY_PRBS23";
+      break;
+    case PN_POLY_PRBS31:
+      s << "PN_POLY_PRBS31";
+      break;
+    case PN_POLY_SIMPLEST:
+      s << "PN_POLY_SIMPLEST";
+      break;
+    case PN_POLY_CUSTOM:
+      s << "PN_POLY_CUSTOM";
+      break;
+    default:
+      s << "unknown PN_POLY_T";
+    } // end of switch on pn_poly_val
+ return s;
+}
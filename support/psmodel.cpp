@@ -44,6 +44,11 @@ PracSimModel::PracSimModel( char* instance_name,
    Instance_Name = new char[strlen(instance_name)+2];
    strcpy(Instance_Name, instance_name);
    Input_Sigs = NULL;
+   Pass_Thru_In_Sigs = new std::vector<GenericSignal*>;
+   Pass_Thru_Out_Sigs = new std::vector<GenericSignal*>;
+   Block_Alias_In_Sigs = new std::vector<GenericSignal*>;
+   Block_Alias_Out_Sigs = new std::vector<GenericSignal*>;
+   Exec_Is_Skipped = false;
    //-----------------------------
    //  Register model
    if(Nest_Depth == 1){
@@ -72,6 +77,11 @@ PracSimModel::PracSimModel(int sys_key,char* model_name)
    //  Output_Sigs = NULL;
    Input_Sigs = NULL;
    Nest_Depth = 0;
+   Pass_Thru_In_Sigs = new std::vector<GenericSignal*>;
+   Pass_Thru_Out_Sigs = new std::vector<GenericSignal*>;
+   Block_Alias_In_Sigs = new std::vector<GenericSignal*>;
+   Block_Alias_Out_Sigs = new std::vector<GenericSignal*>;
+   Exec_Is_Skipped = false;
 }
 //======================================================
 PracSimModel::~PracSimModel()
@@ -105,3 +115,82 @@ int PracSimModel::GetNestDepth(void)
 {
   return(Nest_Depth);
 }
+//======================================================
+//  A model calls this from its constructor (via the
+//  DECLARE_PASS_THRU macro) when, for the configuration
+//  it has been given, out_sig will always be an exact copy
+//  of in_sig.  If every output of the model is declared
+//  this way, the system graph can alias the outputs to the
+//  inputs and skip the model's Execute() altogether.
+
+void PracSimModel::DeclarePassThru( GenericSignal* in_sig,
+                                    GenericSignal* out_sig )
+{
+   Pass_Thru_In_Sigs->push_back(in_sig);
+   Pass_Thru_Out_Sigs->push_back(out_sig);
+}
+//======================================================
+int PracSimModel::GetNumPassThrus(void)
+{
+   return(int(Pass_Thru_In_Sigs->size()));
+}
+//======================================================
+GenericSignal* PracSimModel::GetPassThruInput(int pair_num)
+{
+   return(Pass_Thru_In_Sigs->at(pair_num));
+}
+//======================================================
+GenericSignal* PracSimModel::GetPassThruOutput(int pair_num)
+{
+   return(Pass_Thru_Out_Sigs->at(pair_num));
+}
+//======================================================
+//  A model calls this from its constructor (via the
+//  DECLARE_BLOCK_ALIAS macro) if its Execute() may call
+//  out_sig->AliasBlock(in_sig).  The buffer planner then
+//  keeps in_sig's buffer live until out_sig's last reader.
+
+void PracSimModel::DeclareBlockAlias( GenericSignal* in_sig,
+                                      GenericSignal* out_sig )
+{
+   Block_Alias_In_Sigs->push_back(in_sig);
+   Block_Alias_Out_Sigs->push_back(out_sig);
+}
+//======================================================
+int PracSimModel::GetNumBlockAliases(void)
+{
+   return(int(Block_Alias_In_Sigs->size()));
+}
+//======================================================
+GenericSignal* PracSimModel::GetBlockAliasInput(int pair_num)
+{
+   return(Block_Alias_In_Sigs->at(pair_num));
+}
+//======================================================
+GenericSignal* PracSimModel::GetBlockAliasOutput(int pair_num)
+{
+   return(Block_Alias_Out_Sigs->at(pair_num));
+}
+//======================================================
+void PracSimModel::SetExecSkipped(bool exec_is_skipped)
+{
+   Exec_Is_Skipped = exec_is_skipped;
+}
+//======================================================
+bool PracSimModel::ExecIsSkipped(void)
+{
+   return(Exec_Is_Skipped);
+}
+//======================================================
+//  Stands in for Execute() when the outputs have been
+//  aliased to the inputs -- the samples are already in
+//  place, so only the valid block sizes are passed along.
+
+void PracSimModel::PassThruUpdate(void)
+{
+   int num_pairs = int(Pass_Thru_In_Sigs->size());
+   for(int pair_num=0; pair_num<num_pairs; pair_num++){
+      Pass_Thru_Out_Sigs->at(pair_num)->SetValidBlockSize(
+         Pass_Thru_In_Sigs->at(pair_num)->GetValidBlockSize());
+   }
+}
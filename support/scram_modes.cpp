@@ -0,0 +1,65 @@
+//
+//  File = scram_modes.cpp
+//
+
+#include <stdlib.h>
+#include <fstream>
+#include <string.h>
+#include "parmfile.h"
+#include "scram_modes.h"
+#include "psstream.h"
+extern ParmFile *ParmInput;
+
+//======================================================
+
+SCRAM_MODE_T GetScramModeParm(const char* parm_nam)
+{
+  char parm_str[30];
+
+  if(ParmInput->GetParmStr(parm_nam, parm_str)!=0)
+    {
+    ParmInput->RestartBlock();
+    if(ParmInput->GetParmStr(parm_nam, parm_str) !=0)
+      {
+      ErrorStream <<  "Error: parameter '" << parm_nam 
+                  << "' not found after 2 attempts" << endl;
+      exit(-1);
+      }
+    }
+
+  if(!strcmp(parm_str,"SCRAM_MODE_SCRAMBLE")) return(SCRAM_MODE_SCRAMBLE);
+  if(!strcmp(parm_str,"SCRAM_MODE_DESCRAMBLE")) return(SCRAM_MODE_DESCRAMBLE);
+  ErrorStream <<  "Error: '" << parm_str 
+              << "' is not a legal value for type SCRAM_MODE_T" << endl;
+  exit(-1);
+}
+ostream& operator<<( ostream& s, const SCRAM_MODE_T& scram_mode_val)
+{
+  switch (scram_mode_val)
+    {
+    case SCRAM_MODE_SCRAMBLE:
+      s << "SCRAM_MODE_SCRAMBLE";
+      break;
+    case SCRAM_MODE_DESCRAMBLE:
+      s << "SCRAM_MODE_DESCRAMBLE";
+      break;
+    default:
+      s << "unknown SCRAM_MODE_T";
+    } // end of switch on scram_mode_val
+ return s;
+}
+PracSimStream& operator<<( PracSimStream& s, const SCRAM_MODE_T& scram_mode_val)
+{
+  switch (scram_mode_val)
+    {
+    case SCRAM_MODE_SCRAMBLE:
+      s << "SCRAM_MODE_SCRAMBLE";
+      break;
+    case SCRAM_MODE_DESCRAMBLE:
+      s << "SCRAM_MODE_DESCRAMBLE";
+      break;
+    default:
+      s << "unknown SCRAM_MODE_T";
+    } // end of switch on scram_mode_val
+ return s;
+}
@@ -0,0 +1,129 @@
+//
+//  File = sig_arena.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include "sig_arena.h"
+#include "psstream.h"
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <sys/mman.h>
+#endif
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+// constructor
+
+SignalArena::SignalArena(void)
+{
+  Arena_Beg = NULL;
+  Arena_Size = 0;
+  Mapped_Size = 0;
+  Huge_Pages_Used = false;
+}
+//======================================================
+SignalArena::~SignalArena(void)
+{
+  Release();
+}
+//======================================================
+//  Returns a zero-filled block of at least num_bytes
+//  that starts on a page (and so SIG_ARENA_ALIGN)
+//  boundary.  Any previous block is released first.
+
+char* SignalArena::Allocate(size_t num_bytes)
+{
+  void *mem_ptr;
+
+  Release();
+  if(num_bytes == 0) num_bytes = SIG_ARENA_ALIGN;
+  Arena_Size = num_bytes;
+  mem_ptr = NULL;
+
+#ifdef _WIN32
+  //---------------------------------------------------
+  //  large pages need SeLockMemoryPrivilege and a size
+  //  that is a multiple of the large page size
+
+  size_t large_page = GetLargePageMinimum();
+  if(large_page != 0)
+    {
+    Mapped_Size = ((num_bytes + large_page - 1)/large_page) * large_page;
+    mem_ptr = VirtualAlloc( NULL, Mapped_Size,
+                            MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+                            PAGE_READWRITE);
+    if(mem_ptr != NULL) Huge_Pages_Used = true;
+    }
+  if(mem_ptr == NULL)
+    {
+    Mapped_Size = num_bytes;
+    mem_ptr = VirtualAlloc( NULL, Mapped_Size,
+                            MEM_COMMIT | MEM_RESERVE,
+                            PAGE_READWRITE);
+    }
+#else
+  //---------------------------------------------------
+  //  try explicit huge pages, then fall back to normal
+  //  pages with a transparent huge page hint
+
+  #ifdef MAP_HUGETLB
+    const size_t huge_page = 2*1024*1024;
+    Mapped_Size = ((num_bytes + huge_page - 1)/huge_page) * huge_page;
+    mem_ptr = mmap( NULL, Mapped_Size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if(mem_ptr == MAP_FAILED)
+      mem_ptr = NULL;
+    else
+      Huge_Pages_Used = true;
+  #endif
+  if(mem_ptr == NULL)
+    {
+    Mapped_Size = num_bytes;
+    mem_ptr = mmap( NULL, Mapped_Size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(mem_ptr == MAP_FAILED) mem_ptr = NULL;
+    #ifdef MADV_HUGEPAGE
+      if(mem_ptr != NULL) madvise(mem_ptr, Mapped_Size, MADV_HUGEPAGE);
+    #endif
+    }
+#endif
+
+  if(mem_ptr == NULL)
+    {
+    ErrorStream << "unable to allocate signal buffer arena of "
+                << double(num_bytes) << " bytes" << endl;
+    exit(98);
+    }
+  // fresh pages from the OS are already zero
+  Arena_Beg = (char*)mem_ptr;
+  return(Arena_Beg);
+}
+//======================================================
+void SignalArena::Release(void)
+{
+  if(Arena_Beg == NULL) return;
+#ifdef _WIN32
+  VirtualFree(Arena_Beg, 0, MEM_RELEASE);
+#else
+  munmap(Arena_Beg, Mapped_Size);
+#endif
+  Arena_Beg = NULL;
+  Arena_Size = 0;
+  Mapped_Size = 0;
+  Huge_Pages_Used = false;
+}
+//======================================================
+size_t SignalArena::GetSize(void)
+{
+  return(Arena_Size);
+}
+//======================================================
+bool SignalArena::UsesHugePages(void)
+{
+  return(Huge_Pages_Used);
+}
@@ -10,6 +10,7 @@
 #include "sigplot.h"
 #include "typedefs.h"
 #include "complex_io.h"
+#include "sig_arena.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
@@ -38,6 +39,7 @@ Signal<T>::Signal( Signal<T>* root_id,
 {
   Root_Id = root_id;
   Sig_Is_Root = false;
+  Block_Is_Aliased = false;
 }
 //========================================================
 //  Constructor used for creating Signal objects in main
@@ -49,17 +51,32 @@ Signal<T>::Signal( char* name )
 {
   Root_Id = this;
   Sig_Is_Root = true;
+  Block_Is_Aliased = false;
 }
 //===============================================
 template< class T >
 Signal<T>::~Signal( void )
 {
-  delete Buf_Beg;
+  // buffer belongs to the system graph's signal arena
 };
 
 //===============================================
 template< class T >
-void Signal<T>::AllocateSignalBuffer(void)
+int Signal<T>::GetSampleSize(void)
+{
+  return(sizeof(T));
+}
+//===============================================
+//  The system graph plans where each signal lives in the
+//  signal arena and hands this signal its share, which
+//  has room for Block_Size samples plus the memory area
+//  rounded up to whole SIG_ARENA_ALIGN units.  The memory
+//  area is placed at the end of that rounded space so it
+//  stays contiguous with the block and Buf_Beg keeps the
+//  arena's alignment.
+
+template< class T >
+void Signal<T>::AllocateSignalBuffer(char* phys_buf_beg)
 {
   *DebugFile << "now in Signal<T>::AllocateSignalBuffer" << endl;
   if(Block_Size <= 0)
@@ -67,14 +84,9 @@ void Signal<T>::AllocateSignalBuffer(void)
     *DebugFile << "attempt to allocate zero-length buffer in "
               << GetName() << endl;
     }
-  Phys_Buf_Beg = NULL;
-  Phys_Buf_Beg = new T[Block_Size + Alloc_Mem_Depth];
-  if(Phys_Buf_Beg == NULL)
-  {
-      *DebugFile << "buffer allocation failed in "
-              << GetName() << endl;
-              exit(98);
-  }
+  Phys_Buf_Beg = (T*)( phys_buf_beg
+                 + SIG_ARENA_ROUND_UP(size_t(Alloc_Mem_Depth) * sizeof(T))
+                 - size_t(Alloc_Mem_Depth) * sizeof(T) );
 
   Buf_Beg = Phys_Buf_Beg + Alloc_Mem_Depth;
   // area from Phys_Buf_Beg to Buf_Beg is block-to-block carryover
@@ -85,6 +97,23 @@ void Signal<T>::AllocateSignalBuffer(void)
   Cumul_Samps_Thru_Prev_Block = 0;
 }
 //===============================================
+//  Used instead of AllocateSignalBuffer for a signal that
+//  has been aliased to the input of a static pass-through
+//  model.  The signal shares the buffer (including the
+//  memory area) of the signal at the end of the alias chain.
+
+template< class T >
+void Signal<T>::AliasSignalBuffer(void)
+{
+  Signal<T>* src_sig;
+
+  src_sig = (Signal<T>*)GetAliasRoot();
+  Phys_Buf_Beg = src_sig->Phys_Buf_Beg;
+  Buf_Beg = src_sig->Buf_Beg;
+  Buf_Final_Mem_Beg = src_sig->Buf_Final_Mem_Beg;
+  Cumul_Samps_Thru_Prev_Block = 0;
+}
+//===============================================
 template< class T >
 void Signal<T>::InitializeReadPtrs(void)
 {
@@ -105,6 +134,66 @@ void Signal<T>::InitializeReadPtrs(void)
     }
 }
 //===============================================
+//  Points this signal, its connections, and every signal
+//  statically aliased to it (directly or through a chain of
+//  aliases) at buf_beg.
+
+template< class T >
+void Signal<T>::SetReadPtrs( T* buf_beg )
+{
+  int num_sigs;
+  num_sigs = int(Connected_Sigs->size());
+  Buf_Beg = buf_beg;
+  for(int sig_num = 0; sig_num < num_sigs; sig_num++)
+    {
+    ((Signal<T>*)Connected_Sigs->at(sig_num))->Buf_Beg = buf_beg;
+    }
+  num_sigs = int(Alias_Sigs->size());
+  for(int sig_num = 0; sig_num < num_sigs; sig_num++)
+    {
+    ((Signal<T>*)Alias_Sigs->at(sig_num))->SetReadPtrs(buf_beg);
+    }
+}
+//===============================================
+//  Called by a model's Execute() to declare that its output
+//  for the current block is identical to src_sig (one of
+//  its inputs).  The output, its connections, and any signals
+//  statically aliased to it read directly from the input
+//  buffer for this block and revert to the signal's own
+//  buffer in PassUpdate().
+//
+//  A signal with memory must keep its own history, so in
+//  that case the block is copied instead.
+
+template< class T >
+void Signal<T>::AliasBlock( Signal<T>* src_sig )
+{
+  Signal<T>* root_sig;
+  T *src_ptr;
+  T *dest_ptr;
+  int valid_block_size;
+
+  root_sig = (Signal<T>*)Root_Id;
+  if(root_sig->Alias_Src != NULL)
+    {
+    // statically aliased -- already shares the buffer
+    return;
+    }
+  if(root_sig->Alloc_Mem_Depth != 0)
+    {
+    valid_block_size = src_sig->GetValidBlockSize();
+    src_ptr = src_sig->Buf_Beg;
+    dest_ptr = root_sig->Buf_Beg;
+    for(int is=0; is<valid_block_size; is++)
+      {
+      *dest_ptr++ = *src_ptr++;
+      }
+    return;
+    }
+  root_sig->SetReadPtrs(src_sig->Buf_Beg);
+  root_sig->Block_Is_Aliased = true;
+}
+//===============================================
 template< class T >
 T* Signal<T>::GetRawOutputPtr(PracSimModel* model)
 {
@@ -165,8 +254,16 @@ void Signal<T>::PassUpdate(void)
   Prev_Block_Size = Valid_Block_Size;
   Cumul_Samps_Thru_Prev_Block += Valid_Block_Size;
 
-  // copy samples for signals with memory
-  if(Alloc_Mem_Depth != 0)
+  // a block borrowed from another signal is given back
+  if(Block_Is_Aliased)
+    {
+    SetReadPtrs(Phys_Buf_Beg + Alloc_Mem_Depth);
+    Block_Is_Aliased = false;
+    }
+
+  // copy samples for signals with memory (an aliased signal's
+  // memory is updated along with its alias root)
+  if(Alloc_Mem_Depth != 0 && Alias_Src == NULL)
     {
     for(int ix=0; ix<Alloc_Mem_Depth; ix++)
       {
@@ -429,10 +526,10 @@ void Signal<T>::IssuePlotterData(void)
   return;
 }
 //#endif //_VAR_BLOCKS
-template Signal<float>;
+template class Signal<float>;
 //template Signal<bit_t>;
-template Signal<byte_t>;
-template Signal< std::complex<float> >;
-template Signal< int >;
+template class Signal<byte_t>;
+template class Signal< std::complex<float> >;
+template class Signal< int >;
 
 
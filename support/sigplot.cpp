@@ -43,7 +43,7 @@ void SignalPlotter::Initialize(void)
   num_plot_sigs = 0;
 
   //Model_Name = COPY("SignalPlotter");
-  instance_name = new char[strlen("SignalPlotter\0")];
+  instance_name = new char[strlen("SignalPlotter\0")+1];
   strcpy(instance_name, "SignalPlotter\0");
 
 
@@ -3,13 +3,21 @@
 //
 
 //#include "global_stuff.h" 
-#include <direct.h>
 #include <stdlib.h> 
 #include <iostream> 
 #include <fstream>
+#ifdef _WIN32
+  #include <direct.h>
+#else
+  #include <unistd.h>
+  #include <limits.h>
+  #define _getcwd getcwd
+  #define _MAX_PATH PATH_MAX
+#endif
 #include "parmfile.h"
 #include "psmodel.h"
 #include "reports.h"
+#include "spect_result.h"
 
 //#include "gausrand.h"
 //#include "bitgen.h"
@@ -32,6 +40,7 @@ extern ofstream *DebugFile;
 extern PracSimModel *CommSystem;
 extern PracSimModel *PrevModelConstr;
 extern bool DateInFileNames;
+extern SpectrumRegistry SpectRegistry;
 
 //=========================================================
 
@@ -72,6 +81,23 @@ void SimulationStartup(char *sim_name, char *sim_title)
 
   DateInFileNames = Date_In_Short_Rpt_Name || Date_In_Full_Rpt_Name;
 
+  // the spectral models' results are kept in memory only as
+  // far back as Psd_History_Depth (latest one by default);
+  // Psd_Export_Enab also appends each one to <sim>_psd.bin
+  int Psd_History_Depth = 1;
+  bool Psd_Export_Enab = false;
+  if(ParmInput->ParmIsPresent("Psd_History_Depth\0"))
+    Psd_History_Depth = ParmInput->GetIntParm("Psd_History_Depth\0");
+  if(ParmInput->ParmIsPresent("Psd_Export_Enab\0"))
+    Psd_Export_Enab = ParmInput->GetBoolParm("Psd_Export_Enab\0");
+  SpectRegistry.SetHistoryDepth(Psd_History_Depth);
+  if(Psd_Export_Enab)
+    {
+    strcpy(filnam, sim_name);
+    strcat(filnam, "_psd.bin\0");
+    SpectRegistry.SetExportFile(filnam, false);
+    }
+
   CreateReportFiles( sim_name,
                      Date_In_Short_Rpt_Name,
                      Date_In_Full_Rpt_Name );
@@ -0,0 +1,201 @@
+//
+//  File = spect_result.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "spect_result.h"
+
+extern int PassNumber;
+
+//======================================================
+void PsdToDecibels( double *psd,
+                    double *psd_db,
+                    int num_pts )
+{
+   int i;
+   double db_per_ln = 10.0/log(10.0);
+
+   // clamp first so the log loop has no branches
+   for(i=0; i<num_pts; i++){
+      psd_db[i] = (psd[i] > 0.0) ? psd[i] : 1.0;
+   }
+   for(i=0; i<num_pts; i++){
+      psd_db[i] = db_per_ln * log(psd_db[i]);
+   }
+   for(i=0; i<num_pts; i++){
+      if(psd[i] <= 0.0) psd_db[i] = SPECT_RESULT_FLOOR_DB;
+   }
+}
+
+//======================================================
+//  constructor
+
+SpectrumResult::SpectrumResult( const char *source_name,
+                                int pass_number,
+                                double *psd,
+                                int num_bins,
+                                double delta_f,
+                                int num_avg,
+                                double window_enbw )
+{
+   Source_Name = new char[strlen(source_name)+1];
+   strcpy(Source_Name, source_name);
+   Pass_Number = pass_number;
+   Num_Bins = num_bins;
+   Delta_F = delta_f;
+   Num_Avg = num_avg;
+   Window_Enbw = window_enbw;
+
+   Psd = new double[Num_Bins];
+   memcpy(Psd, psd, Num_Bins*sizeof(double));
+}
+//======================================================
+SpectrumResult::~SpectrumResult(void)
+{
+   delete[] Source_Name;
+   delete[] Psd;
+}
+//======================================================
+void SpectrumResult::GetPsdInDecibels( double *psd_db )
+{
+   PsdToDecibels(Psd, psd_db, Num_Bins);
+}
+//======================================================
+void SpectrumResult::WriteBinary( ofstream *out_file,
+                                  bool in_decibels )
+{
+   int name_len = int(strlen(Source_Name));
+   int db_flag = in_decibels ? 1 : 0;
+
+   out_file->write((char*)&name_len, sizeof(int));
+   out_file->write(Source_Name, name_len);
+   out_file->write((char*)&Pass_Number, sizeof(int));
+   out_file->write((char*)&Num_Bins, sizeof(int));
+   out_file->write((char*)&Delta_F, sizeof(double));
+   out_file->write((char*)&Num_Avg, sizeof(int));
+   out_file->write((char*)&Window_Enbw, sizeof(double));
+   out_file->write((char*)&db_flag, sizeof(int));
+
+   if(in_decibels){
+      double *psd_db = new double[Num_Bins];
+      PsdToDecibels(Psd, psd_db, Num_Bins);
+      out_file->write((char*)psd_db, Num_Bins*sizeof(double));
+      delete[] psd_db;
+   }
+   else{
+      out_file->write((char*)Psd, Num_Bins*sizeof(double));
+   }
+}
+
+//======================================================
+//  constructor
+
+SpectrumRegistry::SpectrumRegistry(void)
+{
+   Export_File_Name = NULL;
+   Export_File = NULL;
+   Export_In_Decibels = false;
+   History_Depth = 1;
+}
+//======================================================
+SpectrumRegistry::~SpectrumRegistry(void)
+{
+   for(int i=0; i<int(Results.size()); i++){
+      delete Results[i];
+   }
+   if(Export_File != NULL){
+      Export_File->close();
+      delete Export_File;
+   }
+   delete[] Export_File_Name;
+}
+//======================================================
+//  The file is not created until the first result is
+//  published, so simulations without spectral models
+//  leave nothing behind.
+
+void SpectrumRegistry::SetExportFile( const char *file_name,
+                                      bool in_decibels )
+{
+   delete[] Export_File_Name;
+   Export_File_Name = new char[strlen(file_name)+1];
+   strcpy(Export_File_Name, file_name);
+   Export_In_Decibels = in_decibels;
+}
+//======================================================
+void SpectrumRegistry::SetHistoryDepth( int results_per_source )
+{
+   History_Depth = results_per_source;
+}
+//======================================================
+SpectrumResult* SpectrumRegistry::Publish( const char *source_name,
+                                           double *psd,
+                                           int num_bins,
+                                           double delta_f,
+                                           int num_avg,
+                                           double window_enbw )
+{
+   SpectrumResult *result = new SpectrumResult( source_name,
+                                                PassNumber,
+                                                psd,
+                                                num_bins,
+                                                delta_f,
+                                                num_avg,
+                                                window_enbw );
+   int num_kept, i;
+
+   // drop this source's oldest results to make room
+   if(History_Depth > 0){
+      num_kept = 0;
+      for(i=int(Results.size())-1; i>=0; i--){
+         if(strcmp(Results[i]->GetSourceName(), source_name)) continue;
+         num_kept++;
+         if(num_kept >= History_Depth){
+            delete Results[i];
+            Results.erase(Results.begin()+i);
+         }
+      }
+   }
+   Results.push_back(result);
+
+   if(Export_File_Name != NULL){
+      if(Export_File == NULL){
+         Export_File = new ofstream(Export_File_Name, ios::out | ios::binary);
+         Export_File->write("PSDRSLT1", 8);
+      }
+      result->WriteBinary(Export_File, Export_In_Decibels);
+      Export_File->flush();
+   }
+   return(result);
+}
+//======================================================
+int SpectrumRegistry::GetNumResults(void)
+{
+   return(int(Results.size()));
+}
+//======================================================
+SpectrumResult* SpectrumRegistry::GetResult( int result_idx )
+{
+   return(Results.at(result_idx));
+}
+//======================================================
+SpectrumResult* SpectrumRegistry::GetLatest( const char *source_name )
+{
+   for(int i=int(Results.size())-1; i>=0; i--){
+      if(!strcmp(Results[i]->GetSourceName(), source_name)) return(Results[i]);
+   }
+   return(NULL);
+}
+//======================================================
+void SpectrumRegistry::ExportBinary( const char *file_name,
+                                     bool in_decibels )
+{
+   ofstream out_file(file_name, ios::out | ios::binary);
+   out_file.write("PSDRSLT1", 8);
+   for(int i=0; i<int(Results.size()); i++){
+      Results[i]->WriteBinary(&out_file, in_decibels);
+   }
+   out_file.close();
+}
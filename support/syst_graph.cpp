@@ -4,6 +4,7 @@
 
 #include <stdlib.h>
 #include <fstream>
+#include <string.h>
 #include "syst_graph.h"
 #include "globals.h"
 #include "sigplot.h"
@@ -23,6 +24,7 @@ extern int PassNumber;
 extern int EnclaveNumber;
 extern int EnclaveOffset[10];
 extern PracSimModel *ActiveModel;
+extern ofstream LongReport;
 
 //============================================
 // constructor
@@ -36,6 +38,12 @@ SystemGraph::SystemGraph()
   Syst_Lev_Models = new std::vector<PracSimModel*>;
   Sig_Dep_Graph = new DirectedGraph;
   Num_Regular_Sigs = 0;
+  Sig_Arena = new SignalArena;
+  Signal_Parms_Resolved = false;
+  Base_Block_Size = NULL;
+  Profiler = NULL;
+  Profiler_Is_Setup = false;
+  Profile_Base_Name = NULL;
   return;
 }
 //============================================
@@ -43,6 +51,9 @@ SystemGraph::SystemGraph()
 
 SystemGraph::~SystemGraph()
 {
+  delete Sig_Arena;
+  delete Profiler;
+  delete[] Profile_Base_Name;
 }
 //============================================
 
@@ -125,6 +136,12 @@ void SystemGraph::MergeCurrModelGraph( ModelGraph* curr_mod_graph )
             //  If there is, a fatal error condition exists.
 
             cmg_block_size = curr_mod_graph->GetBlockSize(cmg_vert_num);
+            if( cmg_block_size > 0 ) {
+               if(curr_mod_graph->BlockSizeIsTunable(cmg_vert_num))
+                  (Sdg_Vert_Descr->at(sdg_sig_num))->block_size_is_tunable = true;
+               else
+                  (Sdg_Vert_Descr->at(sdg_sig_num))->block_size_is_pinned = true;
+            }
             if( ((Sdg_Vert_Descr->at(sdg_sig_num))->block_size) == 0 ) {
                ((Sdg_Vert_Descr->at(sdg_sig_num))->block_size) = cmg_block_size;
             }
@@ -163,6 +180,10 @@ void SystemGraph::MergeCurrModelGraph( ModelGraph* curr_mod_graph )
                      curr_mod_graph->GetSampIntvl(cmg_vert_num);
          new_sig_desc->kind_of_signal = 
                      curr_mod_graph->GetVertexKind(cmg_vert_num);
+         new_sig_desc->block_size_is_tunable = (new_sig_desc->block_size > 0) &&
+                     curr_mod_graph->BlockSizeIsTunable(cmg_vert_num);
+         new_sig_desc->block_size_is_pinned = (new_sig_desc->block_size > 0) &&
+                     !curr_mod_graph->BlockSizeIsTunable(cmg_vert_num);
 
          if(new_sig_desc->kind_of_signal == SK_REGULAR_SIGNAL) Num_Regular_Sigs++;
          Sdg_Vert_Descr->push_back(new_sig_desc);
@@ -316,6 +337,9 @@ void SystemGraph::ResolveSignalParms(void)
   GenericSignal *sig_id;
   bool is_forward;
 
+  // already done if the block size tuner has run
+  if(Signal_Parms_Resolved) return;
+
   int num_nodes = Sig_Dep_Graph->GetNumVerts();
   bool *used_as_base = new bool[num_nodes];
 
@@ -437,9 +461,72 @@ void SystemGraph::ResolveSignalParms(void)
         Propagate( base_sig_num, edge_num, sig_num, is_forward);
       }
     } // end of while(num_base_sigs_used < Num_Regular_Sigs)
+  Signal_Parms_Resolved = true;
   return;
 }
 //============================================================
+//  Multiplies the resolved block size of every signal by
+//  scale_numer/scale_denom.  Because every CHANGE_RATE edge
+//  fixes only the ratio of the block sizes it connects, a
+//  uniform scaling keeps the SDG consistent, provided every
+//  new block size is a whole number, no model has pinned
+//  a block size of its own, and every block size stays a
+//  multiple of the signal's declared granularity.  Returns false (and changes
+//  nothing) if the scaling is not allowed.  Scaling is always
+//  relative to the block sizes as originally resolved.
+
+bool SystemGraph::ScaleBlockSizes( int scale_numer, int scale_denom )
+{
+  int sig_num;
+  long scaled_size;
+  sdg_sig_desc_type *sig_desc;
+  int num_nodes = Sig_Dep_Graph->GetNumVerts();
+
+  if(Base_Block_Size == NULL)
+    {
+    Base_Block_Size = new std::vector<int>;
+    for(sig_num = 0; sig_num < num_nodes; sig_num++)
+      {
+      Base_Block_Size->push_back((Sdg_Vert_Descr->at(sig_num))->block_size);
+      }
+    }
+
+  for(sig_num = 0; sig_num < num_nodes; sig_num++)
+    {
+    sig_desc = Sdg_Vert_Descr->at(sig_num);
+    if(sig_desc->kind_of_signal != SK_REGULAR_SIGNAL) continue;
+    if(sig_desc->block_size_is_pinned && (scale_numer != scale_denom)) return(false);
+    scaled_size = long(Base_Block_Size->at(sig_num)) * scale_numer;
+    if( (scaled_size % scale_denom) != 0 ) return(false);
+    if( (scaled_size / scale_denom) < 1 ) return(false);
+    if( ((scaled_size / scale_denom)
+          % sig_desc->signal_id->GetBlockGranularity()) != 0 ) return(false);
+    }
+
+  for(sig_num = 0; sig_num < num_nodes; sig_num++)
+    {
+    sig_desc = Sdg_Vert_Descr->at(sig_num);
+    if(sig_desc->kind_of_signal != SK_REGULAR_SIGNAL) continue;
+    sig_desc->block_size = int( long(Base_Block_Size->at(sig_num))
+                                * scale_numer / scale_denom );
+    }
+  return(true);
+}
+//============================================================
+//  Returns the first signal whose block size was set by a
+//  SignalAnchor, or NULL if there is none.
+
+GenericSignal* SystemGraph::GetTunableSignal(void)
+{
+  int num_nodes = Sig_Dep_Graph->GetNumVerts();
+  for(int sig_num = 0; sig_num < num_nodes; sig_num++)
+    {
+    if((Sdg_Vert_Descr->at(sig_num))->block_size_is_tunable)
+      return((Sdg_Vert_Descr->at(sig_num))->signal_id);
+    }
+  return(NULL);
+}
+//============================================================
 void SystemGraph::TopoSortSDG(void)
 {
   int num_nodes = Sig_Dep_Graph->GetNumVerts();
@@ -1016,10 +1103,123 @@ void SystemGraph::DistributeSignalParms(void)
   return;
 }
 //====================================================================
+//  Finds models that declared a static pass-through (output
+//  is just a copy of input) and, when the block size and
+//  sampling interval on both sides agree, aliases each such
+//  output signal to its input.  The output then shares the
+//  input's buffer and the model's Execute() is never called,
+//  so this is only done when every output of the model is
+//  a declared pass-through.
+
+void SystemGraph::AliasPassThruSignals(void)
+{
+  PracSimModel *model_id;
+  GenericSignal *in_sig;
+  GenericSignal *out_sig;
+  GenericSignal *alias_root;
+  int model_num, pair_num, num_pairs;
+  int sig_num, num_outputs, num_covered;
+  bool can_alias;
+  int num_nodes = Sig_Dep_Graph->GetNumVerts();
+
+  for(model_num = 0; model_num < Num_Sys_Lev_Models; model_num++)
+    {
+    model_id = Syst_Lev_Models->at(model_num);
+    num_pairs = model_id->GetNumPassThrus();
+    if(num_pairs == 0) continue;
+
+    can_alias = true;
+    for(pair_num = 0; pair_num < num_pairs; pair_num++)
+      {
+      in_sig = model_id->GetPassThruInput(pair_num);
+      out_sig = model_id->GetPassThruOutput(pair_num);
+      if( (in_sig->GetBlockSize() != out_sig->GetBlockSize()) ||
+          (in_sig->GetSampIntvl() != out_sig->GetSampIntvl()) ||
+          out_sig->IsAliased() )
+        {
+        can_alias = false;
+        }
+      }
+    if(!can_alias) continue;
+
+    // any output that is not a declared pass-through still
+    // has to be written by Execute()
+    num_outputs = 0;
+    num_covered = 0;
+    for(sig_num = 0; sig_num < num_nodes; sig_num++)
+      {
+      if( ((Sdg_Vert_Descr->at(sig_num))->kind_of_signal) != SK_REGULAR_SIGNAL) continue;
+      out_sig = (Sdg_Vert_Descr->at(sig_num))->signal_id;
+      if(out_sig->GetProducer() != model_id) continue;
+      num_outputs++;
+      for(pair_num = 0; pair_num < num_pairs; pair_num++)
+        {
+        if(model_id->GetPassThruOutput(pair_num)->GetId() == out_sig->GetId())
+          {
+          num_covered++;
+          break;
+          }
+        }
+      }
+    if(num_covered != num_outputs) continue;
+
+    for(pair_num = 0; pair_num < num_pairs; pair_num++)
+      {
+      model_id->GetPassThruOutput(pair_num)->SetAliasSource(
+                        model_id->GetPassThruInput(pair_num));
+      }
+    model_id->SetExecSkipped(true);
+    #ifdef _DEBUG
+      *DebugFile << "Execute for " << model_id->GetModelName() << ":"
+                 << model_id->GetInstanceName()
+                 << " skipped, output aliased to input" << endl;
+    #endif
+    }
+  //--------------------------------------------------------
+  //  The buffer that is actually allocated at the end of a
+  //  chain of aliases must carry enough memory for every
+  //  signal that shares it.
+
+  for(sig_num = 0; sig_num < num_nodes; sig_num++)
+    {
+    if( ((Sdg_Vert_Descr->at(sig_num))->kind_of_signal) != SK_REGULAR_SIGNAL) continue;
+      //
+      // else
+      out_sig = (Sdg_Vert_Descr->at(sig_num))->signal_id;
+      if(!out_sig->IsAliased()) continue;
+      alias_root = out_sig->GetAliasRoot();
+      alias_root->SetAllocMemDepth(out_sig->GetAllocMemDepth());
+    }
+}
+//====================================================================
+static sig_buf_plan_type* FindBufPlan(
+                  std::vector<sig_buf_plan_type*> *buf_plan,
+                  GenericSignal *sig_id )
+{
+  for(int plan_num = 0; plan_num < int(buf_plan->size()); plan_num++)
+    {
+    if(buf_plan->at(plan_num)->signal_id == sig_id) return(buf_plan->at(plan_num));
+    }
+  return(NULL);
+}
+//====================================================================
+//  All signal buffers are carved out of one arena.  Within a pass,
+//  a signal's buffer is live from the model that writes it through
+//  the last model that reads it, and signals whose lifetimes do not
+//  overlap are given the same piece of the arena.
+
 void SystemGraph::AllocateStorageBuffers(void)
 {
-  int sig_num;
+  int sig_num, plan_num, num_plans;
+  int model_num, pair_num;
+  int first_use, last_use;
+  size_t arena_size, unshared_size;
+  char *arena_beg;
   GenericSignal *sig_id;
+  GenericSignal *alias_root;
+  PracSimModel *model_id;
+  sig_buf_plan_type *plan, *out_plan;
+  std::vector<sig_buf_plan_type*> buf_plan;
   int num_nodes = Sig_Dep_Graph->GetNumVerts();
 
   for(sig_num = 0; sig_num < num_nodes; sig_num++)
@@ -1031,7 +1231,115 @@ void SystemGraph::AllocateStorageBuffers(void)
       //
       // else
       sig_id = (Sdg_Vert_Descr->at(sig_num))->signal_id;
-      sig_id->AllocateSignalBuffer();
+      if(sig_id->IsAliased()) continue;
+
+      plan = new sig_buf_plan_type;
+      plan->signal_id = sig_id;
+      // the memory area is padded so that the block itself
+      // starts on an alignment boundary (see AllocateSignalBuffer)
+      plan->num_bytes = SIG_ARENA_ROUND_UP( size_t(sig_id->GetAllocMemDepth())
+                                            * sig_id->GetSampleSize() )
+                        + SIG_ARENA_ROUND_UP( size_t(sig_id->GetBlockSize())
+                                              * sig_id->GetSampleSize() );
+      GetSignalLifetime(sig_id, &(plan->first_use), &(plan->last_use));
+      plan->arena_offset = 0;
+      buf_plan.push_back(plan);
+    }
+  num_plans = int(buf_plan.size());
+
+  //------------------------------------------------
+  // a signal that shares its alias root's buffer
+  // keeps that buffer alive for its own readers
+
+  for(sig_num = 0; sig_num < num_nodes; sig_num++)
+    {
+    if( ((Sdg_Vert_Descr->at(sig_num))->kind_of_signal) != SK_REGULAR_SIGNAL) continue;
+      //
+      // else
+      sig_id = (Sdg_Vert_Descr->at(sig_num))->signal_id;
+      if(!sig_id->IsAliased()) continue;
+      alias_root = sig_id->GetAliasRoot();
+      GetSignalLifetime(sig_id, &first_use, &last_use);
+      for(plan_num = 0; plan_num < num_plans; plan_num++)
+        {
+        plan = buf_plan.at(plan_num);
+        if(plan->signal_id != alias_root) continue;
+        if(first_use < plan->first_use) plan->first_use = first_use;
+        if(last_use > plan->last_use) plan->last_use = last_use;
+        }
+    }
+
+  //------------------------------------------------
+  // a model that may call AliasBlock() at run time
+  // points its output's readers at the input buffer,
+  // so that buffer must stay live until the output's
+  // last reader.  Working back from the last model
+  // lets a chain of such models carry through.
+
+  for(model_num = Num_Sys_Lev_Models - 1; model_num >= 0; model_num--)
+    {
+    model_id = Syst_Lev_Models->at(model_num);
+    for(pair_num = 0; pair_num < model_id->GetNumBlockAliases(); pair_num++)
+      {
+      sig_id = model_id->GetBlockAliasOutput(pair_num)->GetAliasRoot();
+      out_plan = FindBufPlan(&buf_plan, sig_id);
+      if(out_plan != NULL)
+        {
+        first_use = out_plan->first_use;
+        last_use = out_plan->last_use;
+        }
+      else
+        {
+        GetSignalLifetime(sig_id, &first_use, &last_use);
+        }
+      plan = FindBufPlan(&buf_plan,
+                         model_id->GetBlockAliasInput(pair_num)->GetAliasRoot());
+      if(plan == NULL) continue;
+      if(first_use < plan->first_use) plan->first_use = first_use;
+      if(last_use > plan->last_use) plan->last_use = last_use;
+      }
+    }
+
+  //------------------------------------------------
+  // place the buffers and hand them out
+
+  arena_size = PackSignalBuffers(&buf_plan);
+  arena_beg = Sig_Arena->Allocate(arena_size);
+
+  unshared_size = 0;
+  for(plan_num = 0; plan_num < num_plans; plan_num++)
+    {
+    plan = buf_plan.at(plan_num);
+    plan->signal_id->AllocateSignalBuffer(arena_beg + plan->arena_offset);
+    unshared_size += plan->num_bytes;
+    #ifdef _DEBUG
+      *DebugFile << "signal " << plan->signal_id->GetName()
+                 << " live over models " << plan->first_use
+                 << " to " << plan->last_use << ", "
+                 << (unsigned long)plan->num_bytes << " bytes at arena offset "
+                 << (unsigned long)plan->arena_offset << endl;
+    #endif
+    delete plan;
+    }
+  #ifdef _DEBUG
+    *DebugFile << "signal arena is " << (unsigned long)arena_size
+               << " bytes for " << (unsigned long)unshared_size
+               << " bytes of signal buffers"
+               << (Sig_Arena->UsesHugePages() ? " (huge pages)" : "")
+               << endl;
+  #endif
+  //------------------------------------------------
+  // aliased signals share the buffer of their alias
+  // root, so that buffer must already exist
+
+  for(sig_num = 0; sig_num < num_nodes; sig_num++)
+    {
+    if( ((Sdg_Vert_Descr->at(sig_num))->kind_of_signal) != SK_REGULAR_SIGNAL) continue;
+      //
+      // else
+      sig_id = (Sdg_Vert_Descr->at(sig_num))->signal_id;
+      if(!sig_id->IsAliased()) continue;
+      sig_id->AliasSignalBuffer();
     }
 }
 //============================================================
@@ -1066,11 +1374,144 @@ void SystemGraph::InitializeModels(void)
     }
 }
 //==============================================================================
+//  Returns the position of a system-level model in the execution
+//  order, or -1 if it is not a system-level model.
+
+int SystemGraph::GetExecPosition( PracSimModel* model )
+{
+  for(int model_num = 0; model_num < Num_Sys_Lev_Models; model_num++)
+    {
+    if(Syst_Lev_Models->at(model_num) == model) return(model_num);
+    }
+  return(-1);
+}
+//==============================================================================
+//  Finds the range of model positions over which a signal's buffer
+//  must hold valid data during a pass.  The buffer must be held for
+//  the whole pass if its contents carry over into the next pass
+//  (memory depth, or a reader that runs before the writer), if it
+//  is plotted at the end of the pass, or if its writer is unknown.
+
+void SystemGraph::GetSignalLifetime( GenericSignal* sig_id,
+                                     int* first_use,
+                                     int* last_use )
+{
+  int prod_pos, cons_pos;
+  int num_consumers;
+
+  prod_pos = GetExecPosition(sig_id->GetProducer());
+  *first_use = 0;
+  *last_use = Num_Sys_Lev_Models - 1;
+
+  if( (prod_pos < 0) ||
+      (sig_id->GetAllocMemDepth() > 0) ||
+      sig_id->PlottingIsEnabled() ) return;
+
+  *first_use = prod_pos;
+  *last_use = prod_pos;
+  num_consumers = sig_id->GetNumConsumers();
+  for(int conn_num = 0; conn_num < num_consumers; conn_num++)
+    {
+    cons_pos = GetExecPosition(sig_id->GetConsumer(conn_num));
+    if(cons_pos <= prod_pos)
+      {
+      *first_use = 0;
+      *last_use = Num_Sys_Lev_Models - 1;
+      return;
+      }
+    if(cons_pos > *last_use) *last_use = cons_pos;
+    }
+}
+//==============================================================================
+//  Assigns arena offsets, largest buffer first.  Each buffer goes
+//  in the lowest gap that does not overlap any already placed buffer
+//  whose lifetime overlaps its own.  Returns the arena size needed.
+
+size_t SystemGraph::PackSignalBuffers(
+                        std::vector<sig_buf_plan_type*> *buf_plan )
+{
+  int num_plans = int(buf_plan->size());
+  int plan_num, placed_num, idx;
+  size_t offset, arena_size;
+  sig_buf_plan_type *plan, *other;
+  std::vector<sig_buf_plan_type*> by_size(*buf_plan);
+  std::vector<sig_buf_plan_type*> placed;
+  std::vector<sig_buf_plan_type*> conflicts;
+
+  //-------------------------------------------
+  //  order by decreasing size (insertion sort)
+
+  for(plan_num = 1; plan_num < num_plans; plan_num++)
+    {
+    plan = by_size.at(plan_num);
+    for(idx = plan_num; idx > 0; idx--)
+      {
+      if(by_size.at(idx-1)->num_bytes >= plan->num_bytes) break;
+      by_size.at(idx) = by_size.at(idx-1);
+      }
+    by_size.at(idx) = plan;
+    }
+
+  arena_size = 0;
+  for(plan_num = 0; plan_num < num_plans; plan_num++)
+    {
+    plan = by_size.at(plan_num);
+
+    //-------------------------------------------
+    //  placed buffers that are live at the same
+    //  time, in order of increasing offset
+
+    conflicts.clear();
+    for(placed_num = 0; placed_num < int(placed.size()); placed_num++)
+      {
+      other = placed.at(placed_num);
+      if( (other->last_use < plan->first_use) ||
+          (other->first_use > plan->last_use) ) continue;
+      conflicts.push_back(other);
+      for(idx = int(conflicts.size())-1; idx > 0; idx--)
+        {
+        if(conflicts.at(idx-1)->arena_offset <= other->arena_offset) break;
+        conflicts.at(idx) = conflicts.at(idx-1);
+        }
+      conflicts.at(idx) = other;
+      }
+
+    //-------------------------------------------
+    //  lowest gap big enough for this buffer
+
+    offset = 0;
+    for(idx = 0; idx < int(conflicts.size()); idx++)
+      {
+      other = conflicts.at(idx);
+      if(offset + plan->num_bytes <= other->arena_offset) break;
+      if(other->arena_offset + other->num_bytes > offset)
+        offset = other->arena_offset + other->num_bytes;
+      }
+    plan->arena_offset = offset;
+    placed.push_back(plan);
+    if(offset + plan->num_bytes > arena_size)
+      arena_size = offset + plan->num_bytes;
+    }
+  return(arena_size);
+}
+//==============================================================================
 void SystemGraph::DeleteModels(void)
 {
   PracSimModel *model_id;
   *DebugFile << "In SystemGraph::InitializeModels()" << endl;
   int num_edges = Sig_Dep_Graph->GetNumEdges();
+  if(Profiler != NULL)
+    {
+    Profiler->WriteReport(LongReport);
+    if(Profile_Base_Name != NULL)
+      {
+      char *json_name = new char[strlen(Profile_Base_Name)+16];
+      strcpy(json_name, Profile_Base_Name);
+      strcat(json_name, "_profile.json\0");
+      Profiler->WriteJson(json_name, Profile_Base_Name);
+      delete[] json_name;
+      }
+    }
   for(int model_num = 0; model_num < Num_Sys_Lev_Models; model_num++)
     {
     model_id = Syst_Lev_Models->at(model_num);
@@ -1087,9 +1528,18 @@ void SystemGraph::RunSimulation(void)
 {
   int model_num;
   int model_exec_status;
+  bool pass_is_timed;
+  long long start_ns, pass_start_ns;
 
   EnclaveNumber = 0;
   EnclaveOffset[0] = 0;
+  pass_is_timed = false;
+  if(Profiler != NULL)
+    {
+    if(!Profiler_Is_Setup) SetupProfiler();
+    pass_is_timed = Profiler->PassIsTimed(PassNumber);
+    }
+  pass_start_ns = pass_is_timed ? ModelProfiler::ReadClock() : 0;
   for(model_num = 0; model_num < Num_Sys_Lev_Models; model_num++)
     {
     ActiveModel = Syst_Lev_Models->at(model_num);
@@ -1097,7 +1547,22 @@ void SystemGraph::RunSimulation(void)
       *DebugFile << "ASG launching Execute for " << ActiveModel->GetModelName() 
                   << ":" << ActiveModel->GetInstanceName() << endl;
     #endif
-    model_exec_status = ActiveModel->Execute();
+    if(ActiveModel->ExecIsSkipped())
+      {
+      // output is aliased to input; only the block size moves
+      ActiveModel->PassThruUpdate();
+      continue;
+      }
+    if(pass_is_timed)
+      {
+      start_ns = ModelProfiler::ReadClock();
+      model_exec_status = ActiveModel->Execute();
+      Profiler->RecordExec(model_num, start_ns, ModelProfiler::ReadClock());
+      }
+    else
+      {
+      model_exec_status = ActiveModel->Execute();
+      }
     if( model_exec_status == _MES_AOK ) continue;
       // else take action appropriate for returned status code
       switch (model_exec_status)
@@ -1125,6 +1590,82 @@ signal_update:
       sig_id = (Sdg_Vert_Descr->at(sig_num))->signal_id;
       sig_id->PassUpdate();
     }
+  if(pass_is_timed)
+    Profiler->RecordPass(pass_start_ns, ModelProfiler::ReadClock());
+}
+//=========================================================================
+//  Profiling is enabled by the simulation before the pass loop; the
+//  per-model records are built on the first pass, once every model
+//  has been registered and its signals connected.  If an output base
+//  name is given, the figures are also written to
+//  <base>_profile.json and the first max_trace_passes timed passes
+//  to <base>_trace.json.
+
+void SystemGraph::EnableProfiling( PROFILE_MODE_T profile_mode,
+                                   int sample_intvl,
+                                   const char* output_base_name,
+                                   int max_trace_passes )
+{
+  delete Profiler;
+  Profiler = new ModelProfiler(profile_mode, sample_intvl);
+  Profiler_Is_Setup = false;
+
+  delete[] Profile_Base_Name;
+  Profile_Base_Name = NULL;
+  if(output_base_name == NULL) return;
+
+  Profile_Base_Name = new char[strlen(output_base_name)+1];
+  strcpy(Profile_Base_Name, output_base_name);
+  if(max_trace_passes > 0)
+    {
+    char *trace_name = new char[strlen(output_base_name)+16];
+    strcpy(trace_name, output_base_name);
+    strcat(trace_name, "_trace.json\0");
+    Profiler->EnableTrace(trace_name, max_trace_passes);
+    delete[] trace_name;
+    }
+}
+//=========================================================================
+void SystemGraph::ResetProfiler(void)
+{
+  if(Profiler != NULL) Profiler->Reset();
+}
+//=========================================================================
+//  Samples are counted on each model's output signals; models with
+//  no outputs (sinks) are charged for their inputs instead.
+
+void SystemGraph::SetupProfiler(void)
+{
+  int model_num, sig_num, conn_num;
+  int num_sigs = int(Sdg_Vert_Descr->size());
+  GenericSignal *sig_id;
+  std::vector<bool> has_outputs(Num_Sys_Lev_Models, false);
+
+  for(model_num = 0; model_num < Num_Sys_Lev_Models; model_num++)
+    {
+    Profiler->AddModel(Syst_Lev_Models->at(model_num));
+    }
+  for(sig_num = 0; sig_num < num_sigs; sig_num++)
+    {
+    if( ((Sdg_Vert_Descr->at(sig_num))->kind_of_signal) != SK_REGULAR_SIGNAL) continue;
+    sig_id = (Sdg_Vert_Descr->at(sig_num))->signal_id;
+    model_num = GetExecPosition(sig_id->GetProducer());
+    if(model_num < 0) continue;
+    Profiler->AddCountedSignal(model_num, sig_id);
+    has_outputs[model_num] = true;
+    }
+  for(sig_num = 0; sig_num < num_sigs; sig_num++)
+    {
+    if( ((Sdg_Vert_Descr->at(sig_num))->kind_of_signal) != SK_REGULAR_SIGNAL) continue;
+    sig_id = (Sdg_Vert_Descr->at(sig_num))->signal_id;
+    for(conn_num = 0; conn_num < sig_id->GetNumConsumers(); conn_num++)
+      {
+      model_num = GetExecPosition(sig_id->GetConsumer(conn_num));
+      if( (model_num < 0) || has_outputs[model_num] ) continue;
+      Profiler->AddCountedSignal(model_num, sig_id);
+      }
+    }
+  Profiler_Is_Setup = true;
 }
 //=========================================================================
 void SystemGraph::RegisterModel(PracSimModel* model)
@@ -1159,4 +1700,4 @@ GenericSignal* SystemGraph::GetSignalId( char* sig_name)
       return(sig_id);      
     }
   return(NULL);
-}
\ No newline at end of file
+}
\ No newline at end of file
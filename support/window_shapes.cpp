@@ -30,6 +30,10 @@ WINDOW_SHAPE_T GetWindowShapeParm(const char* parm_nam)
   if(!strcmp(parm_str,"WINDOW_SHAPE_TRIANGULAR")) return(WINDOW_SHAPE_TRIANGULAR);
   if(!strcmp(parm_str,"WINDOW_SHAPE_HAMMING")) return(WINDOW_SHAPE_HAMMING);
   if(!strcmp(parm_str,"WINDOW_SHAPE_HANN")) return(WINDOW_SHAPE_HANN);
+  if(!strcmp(parm_str,"WINDOW_SHAPE_RECTANGULAR")) return(WINDOW_SHAPE_RECTANGULAR);
+  if(!strcmp(parm_str,"WINDOW_SHAPE_KAISER")) return(WINDOW_SHAPE_KAISER);
+  if(!strcmp(parm_str,"WINDOW_SHAPE_BLACKMAN_HARRIS")) return(WINDOW_SHAPE_BLACKMAN_HARRIS);
+  if(!strcmp(parm_str,"WINDOW_SHAPE_FLAT_TOP")) return(WINDOW_SHAPE_FLAT_TOP);
   ErrorStream <<  "Error: '" << parm_str 
               << "' is not a legal value for type WINDOW_SHAPE_T" << endl;
   exit(-1);
@@ -47,6 +51,18 @@ ostream& operator<<( ostream& s, const WINDOW_SHAPE_T& win_shape_val)
     case WINDOW_SHAPE_HANN:
       s << "WINDOW_SHAPE_HANN";
       break;
+    case WINDOW_SHAPE_RECTANGULAR:
+      s << "WINDOW_SHAPE_RECTANGULAR";
+      break;
+    case WINDOW_SHAPE_KAISER:
+      s << "WINDOW_SHAPE_KAISER";
+      break;
+    case WINDOW_SHAPE_BLACKMAN_HARRIS:
+      s << "WINDOW_SHAPE_BLACKMAN_HARRIS";
+      break;
+    case WINDOW_SHAPE_FLAT_TOP:
+      s << "WINDOW_SHAPE_FLAT_TOP";
+      break;
     default:
       s << "unknown WINDOW_SHAPE_T";
     } // end of switch on win_shape_val
@@ -65,6 +81,18 @@ PracSimStream& operator<<( PracSimStream& s, const WINDOW_SHAPE_T& win_shape_val
     case WINDOW_SHAPE_HANN:
       s << "WINDOW_SHAPE_HANN";
       break;
+    case WINDOW_SHAPE_RECTANGULAR:
+      s << "WINDOW_SHAPE_RECTANGULAR";
+      break;
+    case WINDOW_SHAPE_KAISER:
+      s << "WINDOW_SHAPE_KAISER";
+      break;
+    case WINDOW_SHAPE_BLACKMAN_HARRIS:
+      s << "WINDOW_SHAPE_BLACKMAN_HARRIS";
+      break;
+    case WINDOW_SHAPE_FLAT_TOP:
+      s << "WINDOW_SHAPE_FLAT_TOP";
+      break;
     default:
       s << "unknown WINDOW_SHAPE_T";
     } // end of switch on win_shape_val
@@ -0,0 +1,341 @@
+//
+//  File = ar_estim.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include "ar_estim.h"
+#include "levin.h"
+#include "fft_T.h"
+using std::complex;
+
+//======================================================
+//  constructor
+
+ArEstimator::ArEstimator( AR_METHOD_T ar_method,
+                          int seg_len,
+                          int ar_order,
+                          int num_freq_pts )
+{
+   int log2_len;
+
+   Ar_Method = ar_method;
+   Seg_Len = seg_len;
+   Ar_Order = ar_order;
+   A_Coeffs = new double[Ar_Order+1];
+   Drv_Var = 0.0;
+
+   Autocorr = NULL;
+   Corr_Packed = NULL;
+   Corr_Spect = NULL;
+   Corr_Twiddles = NULL;
+   Using_Fft_Autocorr = false;
+   Fwd_Err = NULL;
+   Bwd_Err = NULL;
+   Cov_Mtx = NULL;
+   Chol_Fact = NULL;
+   Rhs_Vec = NULL;
+
+   switch(Ar_Method){
+   case AR_METHOD_YULE_WALKER:
+      Autocorr = new double[Ar_Order+1];
+
+      // zero padding to at least seg_len + ar_order keeps the
+      // circular correlation from wrapping into the lags used
+      Corr_Fft_Len = 2;
+      log2_len = 1;
+      while(Corr_Fft_Len < Seg_Len + Ar_Order){
+         Corr_Fft_Len *= 2;
+         log2_len++;
+      }
+
+      // the FFT method costs two real FFTs of Corr_Fft_Len
+      // points, versus Seg_Len products for each direct lag
+      if( double(Seg_Len)*(Ar_Order+1) > 4.0*Corr_Fft_Len*log2_len ){
+         Using_Fft_Autocorr = true;
+         Corr_Packed = new complex<double>[Corr_Fft_Len/2];
+         Corr_Spect = new complex<double>[Corr_Fft_Len/2 + 1];
+         Corr_Twiddles = new complex<double>[Corr_Fft_Len/2];
+         RealFftTwiddles<double>(Corr_Twiddles, Corr_Fft_Len);
+      }
+      break;
+   case AR_METHOD_BURG:
+      Fwd_Err = new double[Seg_Len];
+      Bwd_Err = new double[Seg_Len];
+      break;
+   case AR_METHOD_COVARIANCE:
+      Cov_Mtx = new double[(Ar_Order+1)*(Ar_Order+1)];
+      Chol_Fact = new double[Ar_Order*Ar_Order];
+      Rhs_Vec = new double[Ar_Order];
+      break;
+   default:
+      break;
+   }
+
+   //----------------------------------------------
+   //  spectrum is one real FFT of the coefficients
+
+   Spec_Fft_Len = 2;
+   while( Spec_Fft_Len < 2*(num_freq_pts-1) ||
+          Spec_Fft_Len < Ar_Order+1 ){
+      Spec_Fft_Len *= 2;
+   }
+   Num_Freq_Pts = Spec_Fft_Len/2 + 1;
+   Psd_Buf = new double[Num_Freq_Pts];
+   Spec_Packed = new complex<double>[Spec_Fft_Len/2];
+   Spec_Freq = new complex<double>[Spec_Fft_Len/2 + 1];
+   Spec_Twiddles = new complex<double>[Spec_Fft_Len/2];
+   RealFftTwiddles<double>(Spec_Twiddles, Spec_Fft_Len);
+}
+//======================================================
+//  destructor
+
+ArEstimator::~ArEstimator(void)
+{
+   delete[] A_Coeffs;
+   delete[] Autocorr;
+   delete[] Corr_Packed;
+   delete[] Corr_Spect;
+   delete[] Corr_Twiddles;
+   delete[] Fwd_Err;
+   delete[] Bwd_Err;
+   delete[] Cov_Mtx;
+   delete[] Chol_Fact;
+   delete[] Rhs_Vec;
+   delete[] Psd_Buf;
+   delete[] Spec_Packed;
+   delete[] Spec_Freq;
+   delete[] Spec_Twiddles;
+}
+//======================================================
+int ArEstimator::Estimate( double *signal )
+{
+   switch(Ar_Method){
+   case AR_METHOD_BURG:
+      return(Burg(signal));
+   case AR_METHOD_COVARIANCE:
+      return(Covariance(signal));
+   default:
+      return(YuleWalker(signal));
+   }
+}
+//======================================================
+//  PSD = samp_intvl * drv_var / |A(f)|**2 where A(f) is
+//  the transform of the coefficient vector
+
+void ArEstimator::ComputeSpectrum( double samp_intvl )
+{
+   int i;
+   double *pack_ptr = (double*)Spec_Packed;
+   double numer = samp_intvl * Drv_Var;
+
+   for(i=0; i<=Ar_Order; i++){
+      pack_ptr[i] = A_Coeffs[i];
+   }
+   for(i=Ar_Order+1; i<Spec_Fft_Len; i++){
+      pack_ptr[i] = 0.0;
+   }
+   RealFFT<double>( Spec_Packed, Spec_Twiddles, Spec_Freq, Spec_Fft_Len );
+
+   for(i=0; i<Num_Freq_Pts; i++){
+      Psd_Buf[i] = numer / std::norm(Spec_Freq[i]);
+   }
+}
+//======================================================
+//  biased autocorrelation estimate, lags 0 thru Ar_Order
+
+void ArEstimator::DirectAutocorr( double *signal )
+{
+   int j, k;
+   double sum;
+
+   for(k=0; k<=Ar_Order; k++){
+      sum = 0.0;
+      for(j=0; j<(Seg_Len-k); j++){
+         sum += signal[j+k] * signal[j];
+      }
+      Autocorr[k] = sum/Seg_Len;
+   }
+}
+//======================================================
+//  Same lags as DirectAutocorr() computed as the inverse
+//  transform of |X(f)|**2.  The power spectrum is real and
+//  even, so its inverse transform is the same as its
+//  forward transform scaled by 1/Corr_Fft_Len, and both
+//  transforms can use the real-input FFT.
+
+void ArEstimator::FftAutocorr( double *signal )
+{
+   int i;
+   int half_len = Corr_Fft_Len/2;
+   double *pack_ptr = (double*)Corr_Packed;
+   double scale = 1.0/(double(Corr_Fft_Len) * Seg_Len);
+
+   for(i=0; i<Seg_Len; i++){
+      pack_ptr[i] = signal[i];
+   }
+   for(i=Seg_Len; i<Corr_Fft_Len; i++){
+      pack_ptr[i] = 0.0;
+   }
+   RealFFT<double>( Corr_Packed, Corr_Twiddles, Corr_Spect, Corr_Fft_Len );
+
+   // full even power spectrum, bins 0 thru Corr_Fft_Len-1
+   for(i=0; i<=half_len; i++){
+      pack_ptr[i] = std::norm(Corr_Spect[i]);
+   }
+   for(i=half_len+1; i<Corr_Fft_Len; i++){
+      pack_ptr[i] = pack_ptr[Corr_Fft_Len - i];
+   }
+   RealFFT<double>( Corr_Packed, Corr_Twiddles, Corr_Spect, Corr_Fft_Len );
+
+   for(i=0; i<=Ar_Order; i++){
+      Autocorr[i] = scale * Corr_Spect[i].real();
+   }
+}
+//======================================================
+int ArEstimator::YuleWalker( double *signal )
+{
+   if(Using_Fft_Autocorr)
+      FftAutocorr(signal);
+   else
+      DirectAutocorr(signal);
+
+   if(Autocorr[0] <= 0.0) return(1);
+
+   return( LevinsonRecursion( Autocorr,
+                              Ar_Order,
+                              A_Coeffs,
+                              &Drv_Var) );
+}
+//======================================================
+//  Burg's method:  each reflection coefficient minimizes
+//  the sum of forward and backward prediction error power,
+//  and the coefficients are then updated as in the
+//  Levinson recursion.
+
+int ArEstimator::Burg( double *signal )
+{
+   int m, n, j, m_minus_j;
+   double numer, denom, refl_coef;
+   double fwd_val, temp;
+
+   Drv_Var = 0.0;
+   for(n=0; n<Seg_Len; n++){
+      Fwd_Err[n] = signal[n];
+      Bwd_Err[n] = signal[n];
+      Drv_Var += signal[n]*signal[n];
+   }
+   Drv_Var /= Seg_Len;
+   if(Drv_Var <= 0.0) return(1);
+
+   A_Coeffs[0] = 1.0;
+   for(m=1; m<=Ar_Order; m++) A_Coeffs[m] = 0.0;
+
+   for(m=1; m<=Ar_Order; m++){
+      numer = 0.0;
+      denom = 0.0;
+      for(n=m; n<Seg_Len; n++){
+         numer += Fwd_Err[n] * Bwd_Err[n-1];
+         denom += Fwd_Err[n]*Fwd_Err[n] + Bwd_Err[n-1]*Bwd_Err[n-1];
+      }
+      if(denom <= 0.0) return(1);
+      refl_coef = -2.0*numer/denom;
+
+      for(j=1; j<=m/2; j++){
+         m_minus_j = m-j;
+         temp = A_Coeffs[j];
+         A_Coeffs[j] = temp + refl_coef*A_Coeffs[m_minus_j];
+         if(j != m_minus_j){
+            A_Coeffs[m_minus_j] += refl_coef*temp;
+         }
+      }
+      A_Coeffs[m] = refl_coef;
+      Drv_Var *= (1.0 - refl_coef*refl_coef);
+
+      // running downward lets both errors update in place
+      for(n=Seg_Len-1; n>=m; n--){
+         fwd_val = Fwd_Err[n];
+         Fwd_Err[n] = fwd_val + refl_coef*Bwd_Err[n-1];
+         Bwd_Err[n] = Bwd_Err[n-1] + refl_coef*fwd_val;
+      }
+   }
+   return(0);
+}
+//======================================================
+//  Covariance method:  least-squares fit of the forward
+//  predictor over samples Ar_Order thru Seg_Len-1.  Only
+//  the first row of the covariance matrix is summed
+//  directly; the rest follows from
+//     c(i,j) = c(i-1,j-1) + x[p-i]x[p-j] - x[N-i]x[N-j]
+//  and the normal equations are solved by Cholesky
+//  factorization.
+
+int ArEstimator::Covariance( double *signal )
+{
+   int i, j, k, n;
+   int p = Ar_Order;
+   int dim = Ar_Order+1;
+   double sum;
+
+   if(Seg_Len <= p) return(1);
+
+   for(j=0; j<=p; j++){
+      sum = 0.0;
+      for(n=p; n<Seg_Len; n++){
+         sum += signal[n] * signal[n-j];
+      }
+      Cov_Mtx[j] = sum;
+   }
+   for(i=1; i<=p; i++){
+      for(j=i; j<=p; j++){
+         Cov_Mtx[i*dim + j] = Cov_Mtx[(i-1)*dim + j-1]
+                              + signal[p-i]*signal[p-j]
+                              - signal[Seg_Len-i]*signal[Seg_Len-j];
+         Cov_Mtx[j*dim + i] = Cov_Mtx[i*dim + j];
+      }
+   }
+
+   //-------------------------------------------
+   //  factor the p x p lower-right block
+
+   for(i=0; i<p; i++){
+      for(j=0; j<=i; j++){
+         sum = Cov_Mtx[(i+1)*dim + j+1];
+         for(k=0; k<j; k++){
+            sum -= Chol_Fact[i*p + k] * Chol_Fact[j*p + k];
+         }
+         if(i == j){
+            if(sum <= 0.0) return(1);
+            Chol_Fact[i*p + i] = sqrt(sum);
+         }
+         else{
+            Chol_Fact[i*p + j] = sum/Chol_Fact[j*p + j];
+         }
+      }
+   }
+
+   // forward substitution for -c(i,0), then back substitution
+   for(i=0; i<p; i++){
+      sum = -Cov_Mtx[i+1];
+      for(k=0; k<i; k++){
+         sum -= Chol_Fact[i*p + k] * Rhs_Vec[k];
+      }
+      Rhs_Vec[i] = sum/Chol_Fact[i*p + i];
+   }
+   A_Coeffs[0] = 1.0;
+   for(i=p-1; i>=0; i--){
+      sum = Rhs_Vec[i];
+      for(k=i+1; k<p; k++){
+         sum -= Chol_Fact[k*p + i] * A_Coeffs[k+1];
+      }
+      A_Coeffs[i+1] = sum/Chol_Fact[i*p + i];
+   }
+
+   sum = Cov_Mtx[0];
+   for(j=1; j<=p; j++){
+      sum += A_Coeffs[j] * Cov_Mtx[j];
+   }
+   Drv_Var = sum/(Seg_Len - p);
+   if(Drv_Var <= 0.0) return(1);
+   return(0);
+}
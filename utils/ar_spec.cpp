@@ -5,6 +5,7 @@
 #include <fstream>
 #include "ar_spec.h"
 #include "misdefs.h"
+#include "spect_result.h"
 using namespace std;
 
 //==============================================
@@ -19,6 +20,7 @@ ArSpectrum::ArSpectrum( int ar_order,
 {
   double denom, two_pi_f, psd_val;
   double a_func_real, a_func_imag;
+  double rot_real, rot_imag, phs_real, phs_imag, temp;
   int f_idx, cof_idx;
 
   Samp_Intvl = samp_intvl;
@@ -33,10 +35,20 @@ ArSpectrum::ArSpectrum( int ar_order,
     a_func_real = 0.0;
     a_func_imag = 0.0;
     two_pi_f = TWO_PI * f_idx * Freq_Delt;
+
+    // exp(-j*cof_idx*two_pi_f) is built up by repeated
+    // rotation rather than a cos/sin call per coefficient
+    rot_real = cos(two_pi_f);
+    rot_imag = -sin(two_pi_f);
+    phs_real = 1.0;
+    phs_imag = 0.0;
     for(cof_idx=0; cof_idx<=ar_order; cof_idx++)
       {
-      a_func_real += (ar_coeff[cof_idx]*cos(cof_idx*two_pi_f));
-      a_func_imag -= (ar_coeff[cof_idx]*sin(cof_idx*two_pi_f));
+      a_func_real += ar_coeff[cof_idx]*phs_real;
+      a_func_imag += ar_coeff[cof_idx]*phs_imag;
+      temp = phs_real*rot_real - phs_imag*rot_imag;
+      phs_imag = phs_real*rot_imag + phs_imag*rot_real;
+      phs_real = temp;
       }
     denom = a_func_real*a_func_real + a_func_imag*a_func_imag;
     psd_val = samp_intvl*drv_var/denom;
@@ -48,29 +60,35 @@ ArSpectrum::ArSpectrum( int ar_order,
 //------------------------
 // destructor
 
-ArSpectrum::~ArSpectrum(void){};
+ArSpectrum::~ArSpectrum(void)
+{
+  delete[] Spec_Buf;
+};
 
 void ArSpectrum::DumpSpectrum( char* out_file_nam,
                                   bool db_plot_enab )
 {
   int i;
   double freq, vert_offset;
+  double *out_vals = Spec_Buf;
   ofstream out_file(out_file_nam, ios::out);
 
-  vert_offset = 10.0 * log10(Spec_Buf[0]);
+  if( db_plot_enab) {
+    // convert the whole spectrum before formatting any of it
+    out_vals = new double[Num_Pts];
+    PsdToDecibels(Spec_Buf, out_vals, Num_Pts);
+    vert_offset = out_vals[0];
+    for(i=0; i<Num_Pts; i++)
+      {
+      out_vals[i] -= vert_offset;
+      }
+    }
   for(i=0; i<Num_Pts; i++)
     {
     freq = i*Freq_Delt/Samp_Intvl;
-    if( db_plot_enab) {
-      out_file << freq << ", " 
-               << ((10.0 * log10(Spec_Buf[i]))-vert_offset) 
-               << endl;
-      }
-    else {
-      out_file << freq << ", " << (Spec_Buf[i])
-               << endl;
-      }
+    out_file << freq << ", " << out_vals[i] << endl;
     }
+  if( db_plot_enab) delete[] out_vals;
   out_file.close();
 }
 
@@ -3,30 +3,29 @@
 //
 
 #include <stdlib.h>
+#include <string.h>
 #include <fstream>
-//#include <math.h>
-//#include "parmfile.h"
 #include "aux_sig_buf.h"
-//#include "misdefs.h"
-//extern ParmFile *ParmInput;
 #include "psstream.h"
    
 extern PracSimStream ErrorStream;
 #ifdef _DEBUG
   extern ofstream *DebugFile;
 #endif
-//extern int PassNumber;
-//ofstream PowerDebug("power.txt", ios::out);
 
 //======================================================
-// constructor - parms read from ParmFile
+// constructor
 
 template <class T>
 AuxSignalBuffer<T>::AuxSignalBuffer( T sample, int nominal_block_size )
 {
    Max_Sample_Count = 3*nominal_block_size;
-   Buffer_Start = new T[Max_Sample_Count];
-   Write_Ptr = Buffer_Start;
+   Capacity = Max_Sample_Count;
+
+   // second copy of the ring follows the first
+   Buffer_Start = new T[2*Capacity];
+   Read_Idx = 0;
+   Write_Idx = 0;
    Sample_Count = 0;
 }
 //=============================================
@@ -42,8 +41,7 @@ T* AuxSignalBuffer<T>::Load(  T *in_sig_ptr,
                               int in_sig_block_size,
                               int *in_sig_buf_count)
 {
-   int idx;
-   T *input_ptr = in_sig_ptr;
+   int first_run, second_run;
 
    Sample_Count += in_sig_block_size;
    if(Sample_Count > Max_Sample_Count)
@@ -51,30 +49,47 @@ T* AuxSignalBuffer<T>::Load(  T *in_sig_ptr,
       ErrorStream << "Too many samples in AuxSignalBuffer" << endl;
       exit(-99);
    }
-   for(idx=0; idx<in_sig_block_size; idx++)
+
+   // write up to the end of the ring, then wrap
+   first_run = Capacity - Write_Idx;
+   if(first_run > in_sig_block_size) first_run = in_sig_block_size;
+   second_run = in_sig_block_size - first_run;
+
+   memcpy( Buffer_Start + Write_Idx, in_sig_ptr, first_run*sizeof(T));
+   memcpy( Buffer_Start + Capacity + Write_Idx, in_sig_ptr,
+           first_run*sizeof(T));
+   if(second_run > 0)
+   {
+      memcpy( Buffer_Start, in_sig_ptr + first_run, second_run*sizeof(T));
+      memcpy( Buffer_Start + Capacity, in_sig_ptr + first_run,
+              second_run*sizeof(T));
+      Write_Idx = second_run;
+   }
+   else
    {
-      *Write_Ptr++ = *input_ptr++;
+      Write_Idx += first_run;
+      if(Write_Idx == Capacity) Write_Idx = 0;
    }
+
    *in_sig_buf_count = Sample_Count;
-   return(Buffer_Start);
+   return(Buffer_Start + Read_Idx);
 }
 //===========================================
 template <class T>
 void AuxSignalBuffer<T>::Release(  int num_samps_to_release)
 {
-   T* src_ptr;
-   T* dest_ptr;
-   int idx;
-
-   Sample_Count -= num_samps_to_release;
-   Write_Ptr -= num_samps_to_release;
-   src_ptr = Buffer_Start + num_samps_to_release;
-   dest_ptr = Buffer_Start;
-
-   for(idx=0; idx<Sample_Count; idx++)
+   if(num_samps_to_release > Sample_Count)
    {
-      *dest_ptr++ = *src_ptr++;
+      num_samps_to_release = Sample_Count;
    }
+   Sample_Count -= num_samps_to_release;
+   Read_Idx += num_samps_to_release;
+   if(Read_Idx >= Capacity) Read_Idx -= Capacity;
 }
-template AuxSignalBuffer<float>;
-
+//===========================================
+template <class T>
+T* AuxSignalBuffer<T>::GetView( int offset )
+{
+   return(Buffer_Start + Read_Idx + offset);
+}
+template class AuxSignalBuffer<float>;
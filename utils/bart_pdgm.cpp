@@ -39,6 +39,6 @@ void BartlettPeriodogram<T>::Calculate(  T* time_signal )
    }
    return;
 }
-template BartlettPeriodogram< std::complex<float> >;
-template BartlettPeriodogram<float>;
+template class BartlettPeriodogram< std::complex<float> >;
+template class BartlettPeriodogram<float>;
 
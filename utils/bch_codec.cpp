@@ -0,0 +1,210 @@
+//
+//  File = bch_codec.cpp
+//
+
+#include <stdlib.h>
+#include "bch_codec.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+BchCodec::BchCodec( Gf2mField *field,
+                    int code_len,
+                    int num_corr )
+{
+   vector<unsigned long> min_polys;
+   unsigned long min_poly;
+   int i, j, v, w;
+
+   Field = field;
+   Code_Len = code_len;
+   Max_Corr = num_corr;
+   if(Max_Corr < 1 || Code_Len > Field->GetOrder()){
+      ErrorStream << "Error: BCH code of length " << Code_Len
+                  << " correcting " << Max_Corr
+                  << " errors not possible over GF(2**"
+                  << Field->GetDegree() << ")" << endl;
+      exit(-1);
+   }
+
+   // even powers share the minimal polynomial of an odd
+   // power, so only the odd ones are tried
+   Gen_Poly = PackedPolyOvrGF2(1);
+   for(i=1; i<2*Max_Corr; i+=2){
+      min_poly = Field->MinimalPolyBits(i);
+      for(j=0; j<int(min_polys.size()); j++){
+         if(min_polys[j] == min_poly) break;
+      }
+      if(j < int(min_polys.size())) continue;
+      min_polys.push_back(min_poly);
+      Gen_Poly *= PackedPolyOvrGF2(gf2_word_t(min_poly));
+   }
+   Num_Parity = Gen_Poly.MaxDegree();
+   Msg_Len = Code_Len - Num_Parity;
+   if(Msg_Len < 1){
+      ErrorStream << "Error: BCH generator degree " << Num_Parity
+                  << " leaves no message bits in length "
+                  << Code_Len << endl;
+      exit(-1);
+   }
+
+   Reg_Words = (Num_Parity + GF2_WORD_BITS-1)/GF2_WORD_BITS;
+   Top_Word_Mask = ~gf2_word_t(0);
+   if(Num_Parity % GF2_WORD_BITS){
+      Top_Word_Mask = (gf2_word_t(1) << (Num_Parity % GF2_WORD_BITS)) - 1;
+   }
+   Gen_Low = new gf2_word_t[Reg_Words];
+   for(w=0; w<Reg_Words; w++) Gen_Low[w] = Gen_Poly.GetWords()[w];
+   Gen_Low[Reg_Words-1] &= Top_Word_Mask;
+   Parity_Reg.resize(Reg_Words);
+
+   Byte_Table = NULL;
+   if(Num_Parity >= 8){
+      Byte_Table = new gf2_word_t[256*Reg_Words];
+      for(v=0; v<256; v++){
+         gf2_word_t *entry = Byte_Table + v*Reg_Words;
+         for(w=0; w<Reg_Words; w++) entry[w] = 0;
+         for(i=7; i>=0; i--) FeedBit(entry, (v >> i) & 1);
+      }
+   }
+
+   Synd_Decoder = new GfSyndromeDecoder( Field, Code_Len, 2*Max_Corr, 1 );
+   Locator.resize(Max_Corr+1);
+   Err_Pos.resize(Max_Corr+1);
+}
+//======================================================
+BchCodec::~BchCodec(void)
+{
+   delete[] Gen_Low;
+   delete[] Byte_Table;
+   delete Synd_Decoder;
+}
+//======================================================
+//  reg = (reg * x + bit_val * x**Num_Parity) mod g(x)
+
+void BchCodec::FeedBit( gf2_word_t *reg, int bit_val )
+{
+   int top_pos = Num_Parity-1;
+   int feedback, w;
+
+   feedback = bit_val ^ int((reg[top_pos/GF2_WORD_BITS]
+                              >> (top_pos%GF2_WORD_BITS)) & 1);
+   for(w=Reg_Words-1; w>0; w--){
+      reg[w] = (reg[w] << 1) | (reg[w-1] >> (GF2_WORD_BITS-1));
+   }
+   reg[0] <<= 1;
+   reg[Reg_Words-1] &= Top_Word_Mask;
+   if(feedback){
+      for(w=0; w<Reg_Words; w++) reg[w] ^= Gen_Low[w];
+   }
+}
+//======================================================
+//  eight message bits, first bit in the msb of byte_val;
+//  the top eight register bits combined with them index
+//  the remainder table
+
+void BchCodec::FeedByte( gf2_word_t *reg, int byte_val )
+{
+   int low_pos = Num_Parity-8;
+   int w_idx = low_pos/GF2_WORD_BITS;
+   int b_idx = low_pos%GF2_WORD_BITS;
+   gf2_word_t top_bits;
+   const gf2_word_t *entry;
+   int w;
+
+   top_bits = reg[w_idx] >> b_idx;
+   if(b_idx > GF2_WORD_BITS-8 && w_idx+1 < Reg_Words){
+      top_bits |= reg[w_idx+1] << (GF2_WORD_BITS-b_idx);
+   }
+   entry = Byte_Table + ((int(top_bits) ^ byte_val) & 0xff)*Reg_Words;
+
+   for(w=Reg_Words-1; w>0; w--){
+      reg[w] = (reg[w] << 8) | (reg[w-1] >> (GF2_WORD_BITS-8));
+   }
+   reg[0] <<= 8;
+   reg[Reg_Words-1] &= Top_Word_Mask;
+   for(w=0; w<Reg_Words; w++) reg[w] ^= entry[w];
+}
+//======================================================
+void BchCodec::Encode( const bit_t *msg, bit_t *codeword )
+{
+   gf2_word_t *reg = &Parity_Reg[0];
+   int is, d, pos, byte_val;
+
+   for(d=0; d<Reg_Words; d++) reg[d] = 0;
+   is = 0;
+   if(Byte_Table != NULL){
+      for(; is+8<=Msg_Len; is+=8){
+         byte_val = 0;
+         for(d=0; d<8; d++) byte_val = (byte_val << 1) | int(msg[is+d] & 1);
+         FeedByte(reg, byte_val);
+      }
+   }
+   for(; is<Msg_Len; is++) FeedBit(reg, int(msg[is] & 1));
+
+   for(is=0; is<Msg_Len; is++) codeword[is] = msg[is] & 1;
+   for(d=0; d<Num_Parity; d++){
+      pos = Num_Parity-1-d;
+      codeword[Msg_Len+d] = bit_t((reg[pos/GF2_WORD_BITS] >> (pos%GF2_WORD_BITS)) & 1);
+   }
+}
+//======================================================
+void BchCodec::EncodeBlock( const bit_t *msgs,
+                            bit_t *codewords,
+                            int num_cws )
+{
+   for(int iw=0; iw<num_cws; iw++){
+      Encode(msgs + iw*Msg_Len, codewords + iw*Code_Len);
+   }
+}
+//======================================================
+//  The received bits are treated as field elements so the
+//  batched syndrome stage of the Reed-Solomon decoder can
+//  be shared; no error values are needed, each located
+//  bit is simply inverted.
+
+void BchCodec::DecodeBlock( bit_t *codewords,
+                            int num_cws,
+                            int *num_corr )
+{
+   gf_elem_t *synd;
+   bit_t *cw;
+   int num_synd = 2*Max_Corr;
+   int iw, is, j, num_errs;
+   bool all_zero;
+
+   if(int(Sym_Buf.size()) < num_cws*Code_Len){
+      Sym_Buf.resize(num_cws*Code_Len);
+      Synd_Buf.resize(num_cws*num_synd);
+   }
+   for(is=0; is<num_cws*Code_Len; is++) Sym_Buf[is] = gf_elem_t(codewords[is] & 1);
+   Synd_Decoder->ComputeSyndromes(&Sym_Buf[0], num_cws, &Synd_Buf[0]);
+
+   for(iw=0; iw<num_cws; iw++){
+      synd = &Synd_Buf[iw*num_synd];
+      all_zero = true;
+      for(j=0; j<num_synd; j++){
+         if(synd[j] != 0){
+            all_zero = false;
+            break;
+         }
+      }
+      num_corr[iw] = 0;
+      if(all_zero) continue;
+
+      num_errs = Synd_Decoder->FindErrorLocator(synd, &Locator[0]);
+      if(num_errs > 0){
+         num_errs = Synd_Decoder->FindErrorPositions(&Locator[0], num_errs, &Err_Pos[0]);
+      }
+      if(num_errs <= 0){
+         num_corr[iw] = -1;
+         continue;
+      }
+      cw = codewords + iw*Code_Len;
+      for(j=0; j<num_errs; j++) cw[Code_Len-1-Err_Pos[j]] ^= 1;
+      num_corr[iw] = num_errs;
+   }
+}
@@ -0,0 +1,149 @@
+//
+//  File = binom_conf.cpp
+//
+
+#include <math.h>
+#include "binom_conf.h"
+#include "q_func.h"
+
+#define CONF_BISECT_ITERS 100
+#define BETA_CF_EPS 1.0e-15
+#define BETA_CF_TINY 1.0e-300
+
+//======================================================
+double NormalConfQuantile( double conf_level )
+{
+   double tail = (1.0 - conf_level)/2.0;
+   double z_lo = 0.0;
+   double z_hi = 40.0;
+   double z_mid;
+
+   for(int iter=0; iter<CONF_BISECT_ITERS; iter++){
+      z_mid = 0.5*(z_lo + z_hi);
+      if(q_func(z_mid) > tail) z_lo = z_mid;
+      else z_hi = z_mid;
+   }
+   return(0.5*(z_lo + z_hi));
+}
+//======================================================
+//  continued fraction for I_x(a,b) by the modified Lentz
+//  method; converges quickly for x < (a+1)/(a+b+2), and
+//  allowed more terms for the very large parameters of
+//  long BER runs
+
+static double BetaContFrac( double a, double b, double x )
+{
+   double qab = a + b;
+   double qap = a + 1.0;
+   double qam = a - 1.0;
+   double c = 1.0;
+   double d = 1.0 - qab*x/qap;
+   double h, aa, del, m2;
+   int m, max_iter;
+
+   if(fabs(d) < BETA_CF_TINY) d = BETA_CF_TINY;
+   d = 1.0/d;
+   h = d;
+   max_iter = 200 + int(10.0*sqrt(a < b ? a : b));
+   for(m=1; m<=max_iter; m++){
+      m2 = 2.0*m;
+      aa = m*(b - m)*x/((qam + m2)*(a + m2));
+      d = 1.0 + aa*d;
+      if(fabs(d) < BETA_CF_TINY) d = BETA_CF_TINY;
+      c = 1.0 + aa/c;
+      if(fabs(c) < BETA_CF_TINY) c = BETA_CF_TINY;
+      d = 1.0/d;
+      h *= d*c;
+      aa = -(a + m)*(qab + m)*x/((a + m2)*(qap + m2));
+      d = 1.0 + aa*d;
+      if(fabs(d) < BETA_CF_TINY) d = BETA_CF_TINY;
+      c = 1.0 + aa/c;
+      if(fabs(c) < BETA_CF_TINY) c = BETA_CF_TINY;
+      d = 1.0/d;
+      del = d*c;
+      h *= del;
+      if(fabs(del - 1.0) < BETA_CF_EPS) break;
+   }
+   return(h);
+}
+//======================================================
+double IncompleteBetaRatio( double a, double b, double x )
+{
+   double log_front;
+
+   if(x <= 0.0) return(0.0);
+   if(x >= 1.0) return(1.0);
+   log_front = lgamma(a + b) - lgamma(a) - lgamma(b)
+               + a*log(x) + b*log1p(-x);
+   if(x < (a + 1.0)/(a + b + 2.0)){
+      return(exp(log_front)*BetaContFrac(a, b, x)/a);
+   }
+   return(1.0 - exp(log_front)*BetaContFrac(b, a, 1.0 - x)/b);
+}
+//======================================================
+void WilsonInterval( long long num_events,
+                     long long num_trials,
+                     double conf_level,
+                     double *lower,
+                     double *upper )
+{
+   double z, z_sq, n, p_hat, center, half_width;
+
+   if(num_trials <= 0){
+      *lower = 0.0;
+      *upper = 1.0;
+      return;
+   }
+   z = NormalConfQuantile(conf_level);
+   z_sq = z*z;
+   n = double(num_trials);
+   p_hat = double(num_events)/n;
+   center = (p_hat + z_sq/(2.0*n))/(1.0 + z_sq/n);
+   half_width = z*sqrt(p_hat*(1.0 - p_hat)/n + z_sq/(4.0*n*n))/(1.0 + z_sq/n);
+   *lower = center - half_width;
+   *upper = center + half_width;
+   if(*lower < 0.0 || num_events == 0) *lower = 0.0;
+   if(*upper > 1.0 || num_events == num_trials) *upper = 1.0;
+}
+//======================================================
+//  lower bound p with P(X >= k | p) = alpha/2, upper
+//  bound with P(X <= k | p) = alpha/2, where
+//  P(X >= k | p) = I_p(k, n-k+1)
+
+void ClopperPearsonInterval( long long num_events,
+                             long long num_trials,
+                             double conf_level,
+                             double *lower,
+                             double *upper )
+{
+   double tail = (1.0 - conf_level)/2.0;
+   double k = double(num_events);
+   double n = double(num_trials);
+   double p_lo, p_hi, p_mid;
+   int iter;
+
+   *lower = 0.0;
+   *upper = 1.0;
+   if(num_trials <= 0) return;
+
+   if(num_events > 0){
+      p_lo = 0.0;
+      p_hi = 1.0;
+      for(iter=0; iter<CONF_BISECT_ITERS; iter++){
+         p_mid = 0.5*(p_lo + p_hi);
+         if(IncompleteBetaRatio(k, n - k + 1.0, p_mid) < tail) p_lo = p_mid;
+         else p_hi = p_mid;
+      }
+      *lower = 0.5*(p_lo + p_hi);
+   }
+   if(num_events < num_trials){
+      p_lo = 0.0;
+      p_hi = 1.0;
+      for(iter=0; iter<CONF_BISECT_ITERS; iter++){
+         p_mid = 0.5*(p_lo + p_hi);
+         if(IncompleteBetaRatio(k + 1.0, n - k, p_mid) > 1.0 - tail) p_hi = p_mid;
+         else p_lo = p_mid;
+      }
+      *upper = 0.5*(p_lo + p_hi);
+   }
+}
@@ -0,0 +1,37 @@
+//
+//  File = blk_harr.cpp
+//
+
+#include <math.h>
+#include "blk_harr.h"
+#include "misdefs.h"
+
+//======================================================
+BlackmanHarrisWindow::BlackmanHarrisWindow( int length )
+                     :GenericWindow(length)
+{
+   GenerateWindow( length );
+}
+//=======================================================
+void BlackmanHarrisWindow::GenerateWindow( int length )
+{
+   double theta;
+
+   // a single-tap window is just its center sample
+   if(length == 1){
+      Half_Lag_Win[0] = 1.0;
+      return;
+   }
+   for(int n=0; n<Half_Length; n++){
+      if(length%2) {
+         theta = TWO_PI*n/(length-1);
+      }
+      else{
+         theta = (2*n+1)*PI/(length-1);
+      }
+      Half_Lag_Win[n] = 0.35875 + 0.48829 * cos(theta)
+                        + 0.14128 * cos(2.0*theta)
+                        + 0.01168 * cos(3.0*theta);
+   }
+   return;
+} 
@@ -0,0 +1,680 @@
+//
+//  File = cmpx_kernels.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include "cmpx_kernels.h"
+
+//  The AVX2 and AVX-512 bodies are compiled for their
+//  own targets whatever the baseline flags are, and only
+//  called if the CPU reports support at run time.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define _CMPX_DISPATCH
+  #define CMPX_AVX2_FUNC __attribute__((target("avx2,fma")))
+  #define CMPX_AVX512_FUNC __attribute__((target("avx512f")))
+  #include <immintrin.h>
+#endif
+
+#define CMPX_PI_F 3.14159265358979f
+#define CMPX_HALF_PI_F 1.57079632679490f
+
+//  arctan(t) = t*P(t*t) on [0,1] (Abramowitz & Stegun
+//  4.4.49); evaluated in float, with the octant folding,
+//  the phase is within 4e-7 rad of the exact angle
+#define ATAN_C0 1.0f
+#define ATAN_C1 -0.3333314528f
+#define ATAN_C2 0.1999355085f
+#define ATAN_C3 -0.1420889944f
+#define ATAN_C4 0.1065626393f
+#define ATAN_C5 -0.0752896400f
+#define ATAN_C6 0.0429096138f
+#define ATAN_C7 -0.0161657367f
+#define ATAN_C8 0.0028662257f
+
+typedef struct{
+   void (*multiply)(const float*, const float*, float*, int);
+   void (*conj_multiply)(const float*, const float*, float*, int);
+   void (*scale_rotate)(const float*, float, float, float*, int);
+   void (*interleave)(const float*, const float*, float*, int);
+   void (*deinterleave)(const float*, float*, float*, int);
+   void (*mag_squared)(const float*, float*, int);
+   void (*magnitude)(const float*, float*, int);
+   void (*phase)(const float*, float*, int);
+   void (*real_multiply)(const float*, const float*, float*, int);
+   } cmpx_kernel_set_type;
+
+//======================================================
+//  portable versions; also finish the tails of the
+//  vector versions
+
+static void MultiplyScalar( const float *in_1, const float *in_2,
+                            float *out, int num_samps )
+{
+   float re_1, im_1, re_2, im_2;
+   for(int is=0; is<num_samps; is++){
+      re_1 = in_1[2*is];
+      im_1 = in_1[2*is+1];
+      re_2 = in_2[2*is];
+      im_2 = in_2[2*is+1];
+      out[2*is] = re_1*re_2 - im_1*im_2;
+      out[2*is+1] = re_1*im_2 + im_1*re_2;
+   }
+}
+//------------------------------------------------------
+static void ConjMultiplyScalar( const float *in_1, const float *in_2,
+                                float *out, int num_samps )
+{
+   float re_1, im_1, re_2, im_2;
+   for(int is=0; is<num_samps; is++){
+      re_1 = in_1[2*is];
+      im_1 = in_1[2*is+1];
+      re_2 = in_2[2*is];
+      im_2 = in_2[2*is+1];
+      out[2*is] = re_1*re_2 + im_1*im_2;
+      out[2*is+1] = im_1*re_2 - re_1*im_2;
+   }
+}
+//------------------------------------------------------
+static void ScaleRotateScalar( const float *in, float fact_re, float fact_im,
+                               float *out, int num_samps )
+{
+   float re, im;
+   for(int is=0; is<num_samps; is++){
+      re = in[2*is];
+      im = in[2*is+1];
+      out[2*is] = re*fact_re - im*fact_im;
+      out[2*is+1] = re*fact_im + im*fact_re;
+   }
+}
+//------------------------------------------------------
+static void InterleaveScalar( const float *real_in, const float *imag_in,
+                              float *out, int num_samps )
+{
+   for(int is=0; is<num_samps; is++){
+      out[2*is] = real_in[is];
+      out[2*is+1] = imag_in[is];
+   }
+}
+//------------------------------------------------------
+static void DeinterleaveScalar( const float *in, float *real_out,
+                                float *imag_out, int num_samps )
+{
+   for(int is=0; is<num_samps; is++){
+      real_out[is] = in[2*is];
+      imag_out[is] = in[2*is+1];
+   }
+}
+//------------------------------------------------------
+static void MagSquaredScalar( const float *in, float *out, int num_samps )
+{
+   for(int is=0; is<num_samps; is++){
+      out[is] = in[2*is]*in[2*is] + in[2*is+1]*in[2*is+1];
+   }
+}
+//------------------------------------------------------
+static void MagnitudeScalar( const float *in, float *out, int num_samps )
+{
+   for(int is=0; is<num_samps; is++){
+      out[is] = sqrtf(in[2*is]*in[2*is] + in[2*is+1]*in[2*is+1]);
+   }
+}
+//------------------------------------------------------
+//  octant reduction: t = min/max of |re|, |im| so the
+//  polynomial only sees [0,1]; then reflect by the
+//  octant and take the sign of the imaginary part
+
+static void PhaseScalar( const float *in, float *out, int num_samps )
+{
+   float re, im, abs_re, abs_im, big, small, t, t_sq, ang;
+   for(int is=0; is<num_samps; is++){
+      re = in[2*is];
+      im = in[2*is+1];
+      abs_re = fabsf(re);
+      abs_im = fabsf(im);
+      big = (abs_re > abs_im) ? abs_re : abs_im;
+      small = (abs_re > abs_im) ? abs_im : abs_re;
+      t = small/((big > FLT_MIN) ? big : FLT_MIN);
+      t_sq = t*t;
+      ang = ATAN_C8;
+      ang = ang*t_sq + ATAN_C7;
+      ang = ang*t_sq + ATAN_C6;
+      ang = ang*t_sq + ATAN_C5;
+      ang = ang*t_sq + ATAN_C4;
+      ang = ang*t_sq + ATAN_C3;
+      ang = ang*t_sq + ATAN_C2;
+      ang = ang*t_sq + ATAN_C1;
+      ang = ang*t_sq + ATAN_C0;
+      ang *= t;
+      if(abs_im > abs_re) ang = CMPX_HALF_PI_F - ang;
+      if(signbit(re)) ang = CMPX_PI_F - ang;
+      out[is] = copysignf(ang, im);
+   }
+}
+//------------------------------------------------------
+static void RealMultiplyScalar( const float *in_1, const float *in_2,
+                                float *out, int num_samps )
+{
+   for(int is=0; is<num_samps; is++){
+      out[is] = in_1[is]*in_2[is];
+   }
+}
+
+static const cmpx_kernel_set_type Scalar_Kernels = {
+   MultiplyScalar, ConjMultiplyScalar, ScaleRotateScalar,
+   InterleaveScalar, DeinterleaveScalar, MagSquaredScalar,
+   MagnitudeScalar, PhaseScalar, RealMultiplyScalar };
+
+#ifdef _CMPX_DISPATCH
+//======================================================
+//  AVX2 + FMA: four complex samples per register.  For a
+//  product the second operand is split into duplicated
+//  real and imaginary parts, the first has its pairs
+//  swapped, and fmaddsub forms re*re - im*im in the even
+//  lanes and re*im + im*re in the odd lanes.
+
+CMPX_AVX2_FUNC
+static void MultiplyAvx2( const float *in_1, const float *in_2,
+                          float *out, int num_samps )
+{
+   __m256 v_1, v_2;
+   int is = 0;
+   for(; is+4<=num_samps; is+=4){
+      v_1 = _mm256_loadu_ps(in_1+2*is);
+      v_2 = _mm256_loadu_ps(in_2+2*is);
+      _mm256_storeu_ps( out+2*is,
+            _mm256_fmaddsub_ps( v_1, _mm256_moveldup_ps(v_2),
+                                _mm256_mul_ps( _mm256_permute_ps(v_1, 0xb1),
+                                               _mm256_movehdup_ps(v_2) )));
+   }
+   MultiplyScalar(in_1+2*is, in_2+2*is, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX2_FUNC
+static void ConjMultiplyAvx2( const float *in_1, const float *in_2,
+                              float *out, int num_samps )
+{
+   __m256 v_1, v_2;
+   int is = 0;
+   for(; is+4<=num_samps; is+=4){
+      v_1 = _mm256_loadu_ps(in_1+2*is);
+      v_2 = _mm256_loadu_ps(in_2+2*is);
+      _mm256_storeu_ps( out+2*is,
+            _mm256_fmsubadd_ps( v_1, _mm256_moveldup_ps(v_2),
+                                _mm256_mul_ps( _mm256_permute_ps(v_1, 0xb1),
+                                               _mm256_movehdup_ps(v_2) )));
+   }
+   ConjMultiplyScalar(in_1+2*is, in_2+2*is, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX2_FUNC
+static void ScaleRotateAvx2( const float *in, float fact_re, float fact_im,
+                             float *out, int num_samps )
+{
+   __m256 fact_re_vec = _mm256_set1_ps(fact_re);
+   __m256 fact_im_vec = _mm256_set1_ps(fact_im);
+   __m256 v_in;
+   int is = 0;
+   for(; is+4<=num_samps; is+=4){
+      v_in = _mm256_loadu_ps(in+2*is);
+      _mm256_storeu_ps( out+2*is,
+            _mm256_fmaddsub_ps( v_in, fact_re_vec,
+                                _mm256_mul_ps( _mm256_permute_ps(v_in, 0xb1),
+                                               fact_im_vec )));
+   }
+   ScaleRotateScalar(in+2*is, fact_re, fact_im, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+//  unpack works within 128-bit halves, so the halves are
+//  put back in order with permute2f128
+
+CMPX_AVX2_FUNC
+static void InterleaveAvx2( const float *real_in, const float *imag_in,
+                            float *out, int num_samps )
+{
+   __m256 v_re, v_im, v_lo, v_hi;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      v_re = _mm256_loadu_ps(real_in+is);
+      v_im = _mm256_loadu_ps(imag_in+is);
+      v_lo = _mm256_unpacklo_ps(v_re, v_im);
+      v_hi = _mm256_unpackhi_ps(v_re, v_im);
+      _mm256_storeu_ps(out+2*is, _mm256_permute2f128_ps(v_lo, v_hi, 0x20));
+      _mm256_storeu_ps(out+2*is+8, _mm256_permute2f128_ps(v_lo, v_hi, 0x31));
+   }
+   InterleaveScalar(real_in+is, imag_in+is, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+//  eight samples from two registers into separate real
+//  and imaginary registers
+
+CMPX_AVX2_FUNC
+static inline void SplitAvx2( const float *in, __m256 *v_re, __m256 *v_im )
+{
+   __m256 v_0 = _mm256_loadu_ps(in);
+   __m256 v_1 = _mm256_loadu_ps(in+8);
+   *v_re = _mm256_castpd_ps( _mm256_permute4x64_pd(
+               _mm256_castps_pd(_mm256_shuffle_ps(v_0, v_1, 0x88)), 0xd8 ));
+   *v_im = _mm256_castpd_ps( _mm256_permute4x64_pd(
+               _mm256_castps_pd(_mm256_shuffle_ps(v_0, v_1, 0xdd)), 0xd8 ));
+}
+//------------------------------------------------------
+CMPX_AVX2_FUNC
+static void DeinterleaveAvx2( const float *in, float *real_out,
+                              float *imag_out, int num_samps )
+{
+   __m256 v_re, v_im;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      SplitAvx2(in+2*is, &v_re, &v_im);
+      _mm256_storeu_ps(real_out+is, v_re);
+      _mm256_storeu_ps(imag_out+is, v_im);
+   }
+   DeinterleaveScalar(in+2*is, real_out+is, imag_out+is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX2_FUNC
+static void MagSquaredAvx2( const float *in, float *out, int num_samps )
+{
+   __m256 v_re, v_im;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      SplitAvx2(in+2*is, &v_re, &v_im);
+      _mm256_storeu_ps(out+is, _mm256_fmadd_ps(v_re, v_re, _mm256_mul_ps(v_im, v_im)));
+   }
+   MagSquaredScalar(in+2*is, out+is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX2_FUNC
+static void MagnitudeAvx2( const float *in, float *out, int num_samps )
+{
+   __m256 v_re, v_im;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      SplitAvx2(in+2*is, &v_re, &v_im);
+      _mm256_storeu_ps( out+is, _mm256_sqrt_ps(
+            _mm256_fmadd_ps(v_re, v_re, _mm256_mul_ps(v_im, v_im)) ));
+   }
+   MagnitudeScalar(in+2*is, out+is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX2_FUNC
+static void PhaseAvx2( const float *in, float *out, int num_samps )
+{
+   __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+   __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(int(0x80000000)));
+   __m256 v_re, v_im, abs_re, abs_im, big, small, t, t_sq, ang;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      SplitAvx2(in+2*is, &v_re, &v_im);
+      abs_re = _mm256_and_ps(v_re, abs_mask);
+      abs_im = _mm256_and_ps(v_im, abs_mask);
+      big = _mm256_max_ps(abs_re, abs_im);
+      small = _mm256_min_ps(abs_re, abs_im);
+      t = _mm256_div_ps(small, _mm256_max_ps(big, _mm256_set1_ps(FLT_MIN)));
+      t_sq = _mm256_mul_ps(t, t);
+      ang = _mm256_set1_ps(ATAN_C8);
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C7));
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C6));
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C5));
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C4));
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C3));
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C2));
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C1));
+      ang = _mm256_fmadd_ps(ang, t_sq, _mm256_set1_ps(ATAN_C0));
+      ang = _mm256_mul_ps(ang, t);
+      ang = _mm256_blendv_ps( ang, _mm256_sub_ps(_mm256_set1_ps(CMPX_HALF_PI_F), ang),
+                              _mm256_cmp_ps(abs_im, abs_re, _CMP_GT_OQ) );
+      // blendv keys on the sign bit, so -0.0 counts as negative
+      ang = _mm256_blendv_ps( ang, _mm256_sub_ps(_mm256_set1_ps(CMPX_PI_F), ang), v_re );
+      _mm256_storeu_ps(out+is, _mm256_or_ps(ang, _mm256_and_ps(v_im, sign_mask)));
+   }
+   PhaseScalar(in+2*is, out+is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX2_FUNC
+static void RealMultiplyAvx2( const float *in_1, const float *in_2,
+                              float *out, int num_samps )
+{
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      _mm256_storeu_ps( out+is, _mm256_mul_ps( _mm256_loadu_ps(in_1+is),
+                                               _mm256_loadu_ps(in_2+is) ));
+   }
+   RealMultiplyScalar(in_1+is, in_2+is, out+is, num_samps-is);
+}
+
+static const cmpx_kernel_set_type Avx2_Kernels = {
+   MultiplyAvx2, ConjMultiplyAvx2, ScaleRotateAvx2,
+   InterleaveAvx2, DeinterleaveAvx2, MagSquaredAvx2,
+   MagnitudeAvx2, PhaseAvx2, RealMultiplyAvx2 };
+
+//======================================================
+//  GCC 12's AVX-512 headers pass an undefined vector as
+//  the merge source of the unmasked intrinsics, which
+//  -Wmaybe-uninitialized reports in every caller
+#if defined(__GNUC__) && !defined(__clang__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+//  AVX-512F: same schemes, eight complex samples per
+//  register; interleaving uses two-source permutes
+
+CMPX_AVX512_FUNC
+static void MultiplyAvx512( const float *in_1, const float *in_2,
+                            float *out, int num_samps )
+{
+   __m512 v_1, v_2;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      v_1 = _mm512_loadu_ps(in_1+2*is);
+      v_2 = _mm512_loadu_ps(in_2+2*is);
+      _mm512_storeu_ps( out+2*is,
+            _mm512_fmaddsub_ps( v_1, _mm512_moveldup_ps(v_2),
+                                _mm512_mul_ps( _mm512_permute_ps(v_1, 0xb1),
+                                               _mm512_movehdup_ps(v_2) )));
+   }
+   MultiplyScalar(in_1+2*is, in_2+2*is, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static void ConjMultiplyAvx512( const float *in_1, const float *in_2,
+                                float *out, int num_samps )
+{
+   __m512 v_1, v_2;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      v_1 = _mm512_loadu_ps(in_1+2*is);
+      v_2 = _mm512_loadu_ps(in_2+2*is);
+      _mm512_storeu_ps( out+2*is,
+            _mm512_fmsubadd_ps( v_1, _mm512_moveldup_ps(v_2),
+                                _mm512_mul_ps( _mm512_permute_ps(v_1, 0xb1),
+                                               _mm512_movehdup_ps(v_2) )));
+   }
+   ConjMultiplyScalar(in_1+2*is, in_2+2*is, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static void ScaleRotateAvx512( const float *in, float fact_re, float fact_im,
+                               float *out, int num_samps )
+{
+   __m512 fact_re_vec = _mm512_set1_ps(fact_re);
+   __m512 fact_im_vec = _mm512_set1_ps(fact_im);
+   __m512 v_in;
+   int is = 0;
+   for(; is+8<=num_samps; is+=8){
+      v_in = _mm512_loadu_ps(in+2*is);
+      _mm512_storeu_ps( out+2*is,
+            _mm512_fmaddsub_ps( v_in, fact_re_vec,
+                                _mm512_mul_ps( _mm512_permute_ps(v_in, 0xb1),
+                                               fact_im_vec )));
+   }
+   ScaleRotateScalar(in+2*is, fact_re, fact_im, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static void InterleaveAvx512( const float *real_in, const float *imag_in,
+                              float *out, int num_samps )
+{
+   __m512i idx_lo = _mm512_set_epi32(23,7,22,6,21,5,20,4,19,3,18,2,17,1,16,0);
+   __m512i idx_hi = _mm512_set_epi32(31,15,30,14,29,13,28,12,27,11,26,10,25,9,24,8);
+   __m512 v_re, v_im;
+   int is = 0;
+   for(; is+16<=num_samps; is+=16){
+      v_re = _mm512_loadu_ps(real_in+is);
+      v_im = _mm512_loadu_ps(imag_in+is);
+      _mm512_storeu_ps(out+2*is, _mm512_permutex2var_ps(v_re, idx_lo, v_im));
+      _mm512_storeu_ps(out+2*is+16, _mm512_permutex2var_ps(v_re, idx_hi, v_im));
+   }
+   InterleaveScalar(real_in+is, imag_in+is, out+2*is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static inline void SplitAvx512( const float *in, __m512 *v_re, __m512 *v_im )
+{
+   __m512i idx_even = _mm512_set_epi32(30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0);
+   __m512i idx_odd = _mm512_set_epi32(31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1);
+   __m512 v_0 = _mm512_loadu_ps(in);
+   __m512 v_1 = _mm512_loadu_ps(in+16);
+   *v_re = _mm512_permutex2var_ps(v_0, idx_even, v_1);
+   *v_im = _mm512_permutex2var_ps(v_0, idx_odd, v_1);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static void DeinterleaveAvx512( const float *in, float *real_out,
+                                float *imag_out, int num_samps )
+{
+   __m512 v_re, v_im;
+   int is = 0;
+   for(; is+16<=num_samps; is+=16){
+      SplitAvx512(in+2*is, &v_re, &v_im);
+      _mm512_storeu_ps(real_out+is, v_re);
+      _mm512_storeu_ps(imag_out+is, v_im);
+   }
+   DeinterleaveScalar(in+2*is, real_out+is, imag_out+is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static void MagSquaredAvx512( const float *in, float *out, int num_samps )
+{
+   __m512 v_re, v_im;
+   int is = 0;
+   for(; is+16<=num_samps; is+=16){
+      SplitAvx512(in+2*is, &v_re, &v_im);
+      _mm512_storeu_ps(out+is, _mm512_fmadd_ps(v_re, v_re, _mm512_mul_ps(v_im, v_im)));
+   }
+   MagSquaredScalar(in+2*is, out+is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static void MagnitudeAvx512( const float *in, float *out, int num_samps )
+{
+   __m512 v_re, v_im;
+   int is = 0;
+   for(; is+16<=num_samps; is+=16){
+      SplitAvx512(in+2*is, &v_re, &v_im);
+      _mm512_storeu_ps( out+is, _mm512_sqrt_ps(
+            _mm512_fmadd_ps(v_re, v_re, _mm512_mul_ps(v_im, v_im)) ));
+   }
+   MagnitudeScalar(in+2*is, out+is, num_samps-is);
+}
+//------------------------------------------------------
+//  AVX-512F has no float logic ops, so sign handling is
+//  done on the integer view
+
+CMPX_AVX512_FUNC
+static void PhaseAvx512( const float *in, float *out, int num_samps )
+{
+   __m512i sign_mask = _mm512_set1_epi32(int(0x80000000));
+   __m512 v_re, v_im, abs_re, abs_im, big, small, t, t_sq, ang;
+   __mmask16 swap_mask, neg_re_mask;
+   int is = 0;
+   for(; is+16<=num_samps; is+=16){
+      SplitAvx512(in+2*is, &v_re, &v_im);
+      abs_re = _mm512_abs_ps(v_re);
+      abs_im = _mm512_abs_ps(v_im);
+      big = _mm512_max_ps(abs_re, abs_im);
+      small = _mm512_min_ps(abs_re, abs_im);
+      t = _mm512_div_ps(small, _mm512_max_ps(big, _mm512_set1_ps(FLT_MIN)));
+      t_sq = _mm512_mul_ps(t, t);
+      ang = _mm512_set1_ps(ATAN_C8);
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C7));
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C6));
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C5));
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C4));
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C3));
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C2));
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C1));
+      ang = _mm512_fmadd_ps(ang, t_sq, _mm512_set1_ps(ATAN_C0));
+      ang = _mm512_mul_ps(ang, t);
+      swap_mask = _mm512_cmp_ps_mask(abs_im, abs_re, _CMP_GT_OQ);
+      ang = _mm512_mask_sub_ps(ang, swap_mask, _mm512_set1_ps(CMPX_HALF_PI_F), ang);
+      neg_re_mask = _mm512_test_epi32_mask(_mm512_castps_si512(v_re), sign_mask);
+      ang = _mm512_mask_sub_ps(ang, neg_re_mask, _mm512_set1_ps(CMPX_PI_F), ang);
+      _mm512_storeu_ps( out+is, _mm512_castsi512_ps( _mm512_or_si512(
+            _mm512_castps_si512(ang),
+            _mm512_and_si512(_mm512_castps_si512(v_im), sign_mask) )));
+   }
+   PhaseScalar(in+2*is, out+is, num_samps-is);
+}
+//------------------------------------------------------
+CMPX_AVX512_FUNC
+static void RealMultiplyAvx512( const float *in_1, const float *in_2,
+                                float *out, int num_samps )
+{
+   int is = 0;
+   for(; is+16<=num_samps; is+=16){
+      _mm512_storeu_ps( out+is, _mm512_mul_ps( _mm512_loadu_ps(in_1+is),
+                                               _mm512_loadu_ps(in_2+is) ));
+   }
+   RealMultiplyScalar(in_1+is, in_2+is, out+is, num_samps-is);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+  #pragma GCC diagnostic pop
+#endif
+
+static const cmpx_kernel_set_type Avx512_Kernels = {
+   MultiplyAvx512, ConjMultiplyAvx512, ScaleRotateAvx512,
+   InterleaveAvx512, DeinterleaveAvx512, MagSquaredAvx512,
+   MagnitudeAvx512, PhaseAvx512, RealMultiplyAvx512 };
+#endif
+
+//======================================================
+//  dispatch
+
+static const cmpx_kernel_set_type *Active_Kernels = NULL;
+static CMPX_ISA_T Active_Isa = CMPX_ISA_SCALAR;
+
+static CMPX_ISA_T DetectCmpxIsa(void)
+{
+#ifdef _CMPX_DISPATCH
+   __builtin_cpu_init();
+   if(__builtin_cpu_supports("avx512f")) return(CMPX_ISA_AVX512);
+   if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return(CMPX_ISA_AVX2);
+#endif
+   return(CMPX_ISA_SCALAR);
+}
+//------------------------------------------------------
+void SetCmpxKernelIsa( CMPX_ISA_T max_isa )
+{
+   CMPX_ISA_T isa = DetectCmpxIsa();
+   if(max_isa < isa) isa = max_isa;
+
+   switch(isa){
+#ifdef _CMPX_DISPATCH
+   case CMPX_ISA_AVX512:
+      Active_Kernels = &Avx512_Kernels;
+      break;
+   case CMPX_ISA_AVX2:
+      Active_Kernels = &Avx2_Kernels;
+      break;
+#endif
+   default:
+      isa = CMPX_ISA_SCALAR;
+      Active_Kernels = &Scalar_Kernels;
+      break;
+   }
+   Active_Isa = isa;
+}
+//------------------------------------------------------
+static inline const cmpx_kernel_set_type* CmpxKernels(void)
+{
+   if(Active_Kernels == NULL) SetCmpxKernelIsa(CMPX_ISA_AVX512);
+   return(Active_Kernels);
+}
+//------------------------------------------------------
+CMPX_ISA_T GetCmpxKernelIsa(void)
+{
+   CmpxKernels();
+   return(Active_Isa);
+}
+//------------------------------------------------------
+const char* CmpxIsaName( CMPX_ISA_T isa )
+{
+   switch(isa){
+   case CMPX_ISA_AVX512:
+      return("AVX-512");
+   case CMPX_ISA_AVX2:
+      return("AVX2");
+   default:
+      return("scalar");
+   }
+}
+
+//======================================================
+//  public entry points
+
+void CmpxMultiply( const std::complex<float> *in_1,
+                   const std::complex<float> *in_2,
+                   std::complex<float> *out,
+                   int num_samps )
+{
+   CmpxKernels()->multiply( (const float*)in_1, (const float*)in_2,
+                            (float*)out, num_samps );
+}
+//------------------------------------------------------
+void CmpxConjMultiply( const std::complex<float> *in_1,
+                       const std::complex<float> *in_2,
+                       std::complex<float> *out,
+                       int num_samps )
+{
+   CmpxKernels()->conj_multiply( (const float*)in_1, (const float*)in_2,
+                                 (float*)out, num_samps );
+}
+//------------------------------------------------------
+void CmpxScaleRotate( const std::complex<float> *in,
+                      std::complex<float> factor,
+                      std::complex<float> *out,
+                      int num_samps )
+{
+   CmpxKernels()->scale_rotate( (const float*)in, factor.real(), factor.imag(),
+                                (float*)out, num_samps );
+}
+//------------------------------------------------------
+void CmpxInterleave( const float *real_in,
+                     const float *imag_in,
+                     std::complex<float> *out,
+                     int num_samps )
+{
+   CmpxKernels()->interleave(real_in, imag_in, (float*)out, num_samps);
+}
+//------------------------------------------------------
+void CmpxDeinterleave( const std::complex<float> *in,
+                       float *real_out,
+                       float *imag_out,
+                       int num_samps )
+{
+   CmpxKernels()->deinterleave((const float*)in, real_out, imag_out, num_samps);
+}
+//------------------------------------------------------
+void CmpxMagSquared( const std::complex<float> *in,
+                     float *mag_sq_out,
+                     int num_samps )
+{
+   CmpxKernels()->mag_squared((const float*)in, mag_sq_out, num_samps);
+}
+//------------------------------------------------------
+void CmpxMagnitude( const std::complex<float> *in,
+                    float *mag_out,
+                    int num_samps )
+{
+   CmpxKernels()->magnitude((const float*)in, mag_out, num_samps);
+}
+//------------------------------------------------------
+void CmpxPhase( const std::complex<float> *in,
+                float *phase_out,
+                int num_samps )
+{
+   CmpxKernels()->phase((const float*)in, phase_out, num_samps);
+}
+//------------------------------------------------------
+void FloatMultiply( const float *in_1,
+                    const float *in_2,
+                    float *out,
+                    int num_samps )
+{
+   CmpxKernels()->real_multiply(in_1, in_2, out, num_samps);
+}
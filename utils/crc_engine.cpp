@@ -0,0 +1,100 @@
+//
+//  File = crc_engine.cpp
+//
+
+#include <stdlib.h>
+#include "crc_engine.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+CrcEngine::CrcEngine( int crc_len,
+                      crc_word_t crc_poly,
+                      bool invert )
+{
+   crc_word_t len_mask, reg;
+   int ib, iv, j;
+
+   if(crc_len < 1 || crc_len > CRC_MAX_LEN){
+      ErrorStream << "Error: CRC length must be 1 thru " << CRC_MAX_LEN << endl;
+      exit(-1);
+   }
+   Crc_Len = crc_len;
+   len_mask = (Crc_Len == 64) ? ~crc_word_t(0) : (crc_word_t(1) << Crc_Len) - 1;
+   if((crc_poly & ~len_mask) != 0 || (crc_poly & 1) == 0){
+      ErrorStream << "Error: CRC polynomial must have " << Crc_Len
+                  << " bits and a constant term" << endl;
+      exit(-1);
+   }
+   Poly_Aligned = crc_poly << (64 - Crc_Len);
+   Init_Reg = invert ? (len_mask << (64 - Crc_Len)) : 0;
+   Final_Xor = invert ? len_mask : 0;
+
+   // Slice_Table[j][v] is byte v advanced through 8*(j+1)
+   // register shifts
+   for(iv=0; iv<256; iv++){
+      reg = crc_word_t(iv) << 56;
+      for(ib=0; ib<8; ib++){
+         reg = (reg << 1) ^ ((reg >> 63) ? Poly_Aligned : 0);
+      }
+      Slice_Table[0][iv] = reg;
+   }
+   for(j=1; j<8; j++){
+      for(iv=0; iv<256; iv++){
+         reg = Slice_Table[j-1][iv];
+         Slice_Table[j][iv] = (reg << 8) ^ Slice_Table[0][reg >> 56];
+      }
+   }
+}
+//======================================================
+crc_word_t CrcEngine::Compute( const bit_t *bits_in, int num_bits )
+{
+   crc_word_t reg = Init_Reg;
+   crc_word_t word;
+   int is, ib, byte_val;
+
+   is = 0;
+   for(; is+64<=num_bits; is+=64){
+      word = 0;
+      for(ib=0; ib<64; ib++) word = (word << 1) | crc_word_t(bits_in[is+ib] & 1);
+      reg ^= word;
+      reg = Slice_Table[7][reg >> 56] ^
+            Slice_Table[6][(reg >> 48) & 0xff] ^
+            Slice_Table[5][(reg >> 40) & 0xff] ^
+            Slice_Table[4][(reg >> 32) & 0xff] ^
+            Slice_Table[3][(reg >> 24) & 0xff] ^
+            Slice_Table[2][(reg >> 16) & 0xff] ^
+            Slice_Table[1][(reg >> 8) & 0xff] ^
+            Slice_Table[0][reg & 0xff];
+   }
+   for(; is+8<=num_bits; is+=8){
+      byte_val = 0;
+      for(ib=0; ib<8; ib++) byte_val = (byte_val << 1) | int(bits_in[is+ib] & 1);
+      reg = (reg << 8) ^ Slice_Table[0][(reg >> 56) ^ crc_word_t(byte_val)];
+   }
+   for(; is<num_bits; is++){
+      reg ^= crc_word_t(bits_in[is] & 1) << 63;
+      reg = (reg << 1) ^ ((reg >> 63) ? Poly_Aligned : 0);
+   }
+   return((reg >> (64 - Crc_Len)) ^ Final_Xor);
+}
+//======================================================
+void CrcEngine::Append( bit_t *frame, int num_bits )
+{
+   crc_word_t crc = Compute(frame, num_bits);
+   for(int ib=0; ib<Crc_Len; ib++){
+      frame[num_bits + ib] = bit_t((crc >> (Crc_Len-1-ib)) & 1);
+   }
+}
+//======================================================
+bool CrcEngine::Check( const bit_t *frame, int num_bits )
+{
+   crc_word_t crc = Compute(frame, num_bits);
+   for(int ib=0; ib<Crc_Len; ib++){
+      if(bit_t((crc >> (Crc_Len-1-ib)) & 1) != (frame[num_bits + ib] & 1)) return(false);
+   }
+   return(true);
+}
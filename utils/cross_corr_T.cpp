@@ -0,0 +1,342 @@
+//
+//  File = cross_corr_T.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "misdefs.h"
+#include "sinc.h"
+#include "cross_corr_T.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+template <class T>
+CrossCorrelator<T>::CrossCorrelator( int seg_len )
+{
+   int k;
+
+   if(seg_len < 2){
+      ErrorStream << "Error: correlation segment must have "
+                  << "at least 2 samples" << endl;
+      exit(-1);
+   }
+   Seg_Len = seg_len;
+   Fft_Len = 4;
+   while(Fft_Len < 2*Seg_Len) Fft_Len *= 2;
+   Half_Len = Fft_Len/2;
+   In_Sign = T(1.0);
+
+   Full_Plan = GetFftPlan<T>(Fft_Len);
+   Half_Plan = GetFftPlan<T>(Half_Len);
+
+   Work = new std::complex<T>[Fft_Len];
+   Cross_Spect = new std::complex<T>[Fft_Len];
+   Ref_Spect = new std::complex<T>[Half_Len+1];
+   Corr = new T[Fft_Len];
+   Stream_Buf = new T[Fft_Len];
+
+   for(k=0; k<Fft_Len; k++){
+      Cross_Spect[k] = 0.0;
+      Corr[k] = 0.0;
+      Stream_Buf[k] = 0.0;
+   }
+   for(k=0; k<=Half_Len; k++) Ref_Spect[k] = 0.0;
+}
+//======================================================
+template <class T>
+CrossCorrelator<T>::~CrossCorrelator(void)
+{
+   delete[] Work;
+   delete[] Cross_Spect;
+   delete[] Ref_Spect;
+   delete[] Corr;
+   delete[] Stream_Buf;
+}
+//======================================================
+template <class T>
+void CrossCorrelator<T>::SetInputInversion( bool invert_input )
+{
+   In_Sign = invert_input ? T(-1.0) : T(1.0);
+}
+//======================================================
+//  Bins 0 thru Half_Len of the spectrum of num_samps real
+//  samples (times scale), zero padded to Fft_Len.  The
+//  samples are packed in pairs into a half-length complex
+//  FFT and then split into the real signal's spectrum.
+
+template <class T>
+void CrossCorrelator<T>::RealSpectrum( const T* seg,
+                                       int num_samps,
+                                       T scale,
+                                       std::complex<T>* spect )
+{
+   int k, num_pairs;
+   std::complex<T> z_k, z_conj, even_part, odd_part;
+   std::complex<T> minus_j_half = std::complex<T>(0.0, -0.5);
+   const std::complex<T> *twiddles = Full_Plan->GetTwiddles();
+
+   num_pairs = num_samps/2;
+   for(k=0; k<num_pairs; k++){
+      Work[k] = std::complex<T>(scale*seg[2*k], scale*seg[2*k+1]);
+   }
+   if(num_samps%2){
+      Work[num_pairs++] = std::complex<T>(scale*seg[num_samps-1], 0.0);
+   }
+   for(k=num_pairs; k<Half_Len; k++) Work[k] = 0.0;
+
+   Half_Plan->Forward(Work);
+
+   spect[0] = std::complex<T>(Work[0].real() + Work[0].imag(), 0.0);
+   spect[Half_Len] = std::complex<T>(Work[0].real() - Work[0].imag(), 0.0);
+   for(k=1; k<Half_Len; k++){
+      z_k = Work[k];
+      z_conj = std::conj(Work[Half_Len-k]);
+      even_part = T(0.5) * (z_k + z_conj);
+      odd_part = minus_j_half * (z_k - z_conj);
+      spect[k] = even_part + twiddles[k] * odd_part;
+   }
+}
+//======================================================
+template <class T>
+void CrossCorrelator<T>::MirrorSpectrum(void)
+{
+   std::complex<T> *lo_ptr = Cross_Spect + 1;
+   std::complex<T> *hi_ptr = Cross_Spect + Fft_Len - 1;
+   for(int k=1; k<Half_Len; k++){
+      *hi_ptr-- = std::conj(*lo_ptr++);
+   }
+}
+//======================================================
+template <class T>
+void CrossCorrelator<T>::SetReference( const T* ref_seg )
+{
+   int k;
+   T scale = T(1.0/Fft_Len);
+
+   RealSpectrum(ref_seg, Seg_Len, T(1.0), Ref_Spect);
+   for(k=0; k<=Half_Len; k++){
+      Ref_Spect[k] = scale * std::conj(Ref_Spect[k]);
+   }
+
+   // a new reference starts a new stream
+   for(k=0; k<Seg_Len; k++) Stream_Buf[k] = 0.0;
+}
+//======================================================
+//  Both signals go through one full-length FFT as
+//  z = x + jy, then X(k) = (Z(k) + conj(Z(N-k)))/2 and
+//  Y(k) = (Z(k) - conj(Z(N-k)))/2j.
+
+template <class T>
+void CrossCorrelator<T>::CrossSpectrum( const T* in_seg,
+                                        const T* ref_seg )
+{
+   int k;
+   T scale = T(1.0/Fft_Len);
+   std::complex<T> z_k, z_conj, x_k, y_k;
+   std::complex<T> minus_j_half = std::complex<T>(0.0, -0.5);
+
+   for(k=0; k<Seg_Len; k++){
+      Work[k] = std::complex<T>(In_Sign*in_seg[k], ref_seg[k]);
+   }
+   for(k=Seg_Len; k<Fft_Len; k++) Work[k] = 0.0;
+
+   Full_Plan->Forward(Work);
+
+   for(k=0; k<=Half_Len; k++){
+      z_k = Work[k];
+      z_conj = std::conj(Work[(Fft_Len-k) & (Fft_Len-1)]);
+      x_k = T(0.5) * (z_k + z_conj);
+      y_k = minus_j_half * (z_k - z_conj);
+      Cross_Spect[k] = scale * x_k * std::conj(y_k);
+   }
+   MirrorSpectrum();
+}
+//======================================================
+template <class T>
+void CrossCorrelator<T>::CrossSpectrum( const T* in_seg )
+{
+   RealSpectrum(in_seg, Seg_Len, In_Sign, Cross_Spect);
+   for(int k=0; k<=Half_Len; k++){
+      Cross_Spect[k] *= Ref_Spect[k];
+   }
+   MirrorSpectrum();
+}
+//======================================================
+//  The correlation is real, so its even and odd samples
+//  are recovered together as the real and imaginary parts
+//  of one half-length inverse FFT.  Only bins 0 thru
+//  Half_Len of Cross_Spect are read.
+
+template <class T>
+void CrossCorrelator<T>::InverseToCorrelation(void)
+{
+   int k;
+   std::complex<T> c_lo, c_hi;
+   std::complex<T> j_one = std::complex<T>(0.0, 1.0);
+   const std::complex<T> *twiddles = Full_Plan->GetTwiddles();
+
+   Work[0] = std::complex<T>( Cross_Spect[0].real() + Cross_Spect[Half_Len].real(),
+                              Cross_Spect[0].real() - Cross_Spect[Half_Len].real() );
+   for(k=1; k<Half_Len; k++){
+      c_lo = Cross_Spect[k];
+      c_hi = std::conj(Cross_Spect[Half_Len-k]);
+      Work[k] = (c_lo + c_hi) + j_one * (c_lo - c_hi) * std::conj(twiddles[k]);
+   }
+
+   Half_Plan->Inverse(Work);
+
+   for(k=0; k<Half_Len; k++){
+      Corr[2*k] = Work[k].real();
+      Corr[2*k+1] = Work[k].imag();
+   }
+}
+//======================================================
+template <class T>
+void CrossCorrelator<T>::Correlate( const T* in_seg,
+                                    const T* ref_seg )
+{
+   CrossSpectrum(in_seg, ref_seg);
+   InverseToCorrelation();
+}
+//======================================================
+template <class T>
+void CrossCorrelator<T>::Correlate( const T* in_seg )
+{
+   CrossSpectrum(in_seg);
+   InverseToCorrelation();
+}
+//======================================================
+//  Stream_Buf holds the last Seg_Len-1 input samples
+//  followed by up to Fft_Len-Seg_Len+1 new ones.  Lags 0
+//  thru Fft_Len-Seg_Len of the circular correlation do not
+//  wrap, so each new sample yields one valid output.
+
+template <class T>
+void CrossCorrelator<T>::Filter( const T* in_sig,
+                                 T* out_sig,
+                                 int num_samps )
+{
+   int k, chunk_len;
+   int hist_len = Seg_Len-1;
+   int max_chunk = Fft_Len - Seg_Len + 1;
+
+   while(num_samps > 0){
+      chunk_len = (num_samps < max_chunk) ? num_samps : max_chunk;
+      memcpy(Stream_Buf + hist_len, in_sig, chunk_len*sizeof(T));
+
+      RealSpectrum(Stream_Buf, hist_len + chunk_len, In_Sign, Cross_Spect);
+      for(k=0; k<=Half_Len; k++){
+         Cross_Spect[k] *= Ref_Spect[k];
+      }
+      InverseToCorrelation();
+
+      memcpy(out_sig, Corr, chunk_len*sizeof(T));
+      memmove(Stream_Buf, Stream_Buf + chunk_len, hist_len*sizeof(T));
+
+      in_sig += chunk_len;
+      out_sig += chunk_len;
+      num_samps -= chunk_len;
+   }
+}
+//======================================================
+template <class T>
+int CrossCorrelator<T>::FindPeak( int min_lag,
+                                  int max_lag )
+{
+   int lag, peak_lag;
+   int idx_mask = Fft_Len-1;
+   T peak_val;
+
+   if(min_lag < 1-Half_Len) min_lag = 1-Half_Len;
+   if(max_lag > Half_Len-1) max_lag = Half_Len-1;
+
+   peak_lag = min_lag;
+   peak_val = Corr[min_lag & idx_mask];
+   for(lag=min_lag+1; lag<=max_lag; lag++){
+      if(Corr[lag & idx_mask] > peak_val){
+         peak_val = Corr[lag & idx_mask];
+         peak_lag = lag;
+      }
+   }
+   return(peak_lag);
+}
+//======================================================
+//  band-limited value of the correlation at
+//  peak_lag + offset, from a truncated sinc expansion
+
+template <class T>
+double CrossCorrelator<T>::SincInterp( int peak_lag,
+                                       double offset )
+{
+   int i;
+   int idx_mask = Fft_Len-1;
+   double sum = 0.0;
+
+   for(i=-CORR_SINC_HALF_LEN; i<=CORR_SINC_HALF_LEN; i++){
+      sum += Corr[(peak_lag+i) & idx_mask] * sinc(offset - i);
+   }
+   return(sum);
+}
+//======================================================
+template <class T>
+double CrossCorrelator<T>::InterpolatePeak( int peak_lag,
+                                            PEAK_INTERP_T interp_mode )
+{
+   int idx_mask = Fft_Len-1;
+   double y_prev, y_peak, y_next, curv, offset;
+   double lo, hi, t1, t2, f1, f2;
+   double golden = 0.5*(sqrt(5.0)-1.0);
+   int iter;
+
+   y_prev = Corr[(peak_lag-1) & idx_mask];
+   y_peak = Corr[peak_lag & idx_mask];
+   y_next = Corr[(peak_lag+1) & idx_mask];
+
+   switch(interp_mode){
+   case PEAK_INTERP_PARABOLIC:
+      curv = y_prev - 2.0*y_peak + y_next;
+      if(curv >= 0.0) return(double(peak_lag));
+      offset = 0.5*(y_prev - y_next)/curv;
+      if(offset > 0.5) offset = 0.5;
+      if(offset < -0.5) offset = -0.5;
+      return(peak_lag + offset);
+
+   case PEAK_INTERP_SINC:
+      // golden-section search of the sinc expansion
+      // within half a sample of the integer peak
+      lo = -0.5;
+      hi = 0.5;
+      t1 = hi - golden*(hi-lo);
+      t2 = lo + golden*(hi-lo);
+      f1 = SincInterp(peak_lag, t1);
+      f2 = SincInterp(peak_lag, t2);
+      for(iter=0; iter<24; iter++){
+         if(f1 < f2){
+            lo = t1;
+            t1 = t2;
+            f1 = f2;
+            t2 = lo + golden*(hi-lo);
+            f2 = SincInterp(peak_lag, t2);
+         }
+         else{
+            hi = t2;
+            t2 = t1;
+            f2 = f1;
+            t1 = hi - golden*(hi-lo);
+            f1 = SincInterp(peak_lag, t1);
+         }
+      }
+      return(peak_lag + 0.5*(lo+hi));
+
+   default:
+      return(double(peak_lag));
+   }
+}
+//======================================================
+template class CrossCorrelator<float>;
+template class CrossCorrelator<double>;
@@ -27,6 +27,7 @@ CyclotomicPartition::CyclotomicPartition( int prime_field_base,
    Coset_Start = new int[(Modulus+1)/2];
    Coset_Size = new int[(Modulus+1)/2];
    Element_Vector = new int[Modulus];
+   Coset_Index = new int[Modulus];
    bool* used = new bool[Modulus];
    for(i=0; i<Modulus; i++){
       used[i] = false;
@@ -34,6 +35,7 @@ CyclotomicPartition::CyclotomicPartition( int prime_field_base,
    Coset_Start[0] = 0;
    Coset_Size[0] = 1;
    Element_Vector[0] = 0;
+   Coset_Index[0] = 0;
    Num_Cosets = 1;
    total_count++;
 
@@ -50,6 +52,7 @@ CyclotomicPartition::CyclotomicPartition( int prime_field_base,
 
       do{
          Element_Vector[base + element_count] = element;
+         Coset_Index[element] = Num_Cosets;
          used[element] = true;
          element_count++;
          total_count++;
@@ -58,6 +61,7 @@ CyclotomicPartition::CyclotomicPartition( int prime_field_base,
       Coset_Size[Num_Cosets] = element_count;
       Num_Cosets++;
    }while(total_count <(Modulus-1));
+   delete[] used;
 }
 //=======================================================
 int CyclotomicPartition::GetNumCosets(void)
@@ -74,16 +78,5 @@ CyclotomicCoset *CyclotomicPartition::GetSpecificCoset(int coset_index)
 //===========================================================
 int CyclotomicPartition::GetCosetIndex(int element)
 {
-   int i, j, index;
-   i=-1;
-   do{
-      i++;
-   }while( (i<(Modulus-1)) && (element != Element_Vector[i]));
-   for(j=0; j<Num_Cosets; j++){
-      if( (i>=Coset_Start[j]) && (i<(Coset_Start[j]+Coset_Size[j]))){
-         index = j;
-         break;
-      }
-   }
-   return(index);
+   return(Coset_Index[element % Modulus]);
 }
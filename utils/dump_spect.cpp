@@ -5,11 +5,19 @@
 #include <stdlib.h>
 #include "dump_spect.h"
 #include "math.h"
+#include "spect_result.h"
 
 #ifdef _DEBUG
   extern ofstream *DebugFile;
 #endif
 
+//======================================================
+//  Text adapter for a PSD estimate:  writes "freq, value"
+//  lines for bins 0 thru nsamps_in_psd/2-1 (mirrored to
+//  negative frequencies if plot_two_sided), then zeroes
+//  those bins.  Decibel values are converted in one pass
+//  before any formatting is done.
+
 void DumpSpectrum(  double *psd_est,
                int nsamps_in_psd,
                double delta_f,
@@ -19,73 +27,35 @@ void DumpSpectrum(  double *psd_est,
                ofstream *psd_file)
 {
    int is;
-   //------------------------------------
-   // find peak
+   int num_bins = nsamps_in_psd/2;
+   double *out_vals = psd_est;
+   double freq_step = delta_f * freq_norm_factor;
 
-   double peak_val=0.0;
-   int peak_idx=0;
-   for(is=0; is<nsamps_in_psd/2; is++)
+   if(output_in_decibels)
    {
-      if(psd_est[is] <= peak_val) continue;
-      //else
-      peak_val = psd_est[is];
-      peak_idx = is;
+      out_vals = new double[num_bins];
+      PsdToDecibels(psd_est, out_vals, num_bins);
    }
 
-   if(output_in_decibels)
+   if(plot_two_sided)
    {
-      //double offset = 10.0*log10(Psd_Est[peak_idx]);
-      double offset = 0.0;
-
-      if(plot_two_sided)
-      {
-         for(is=-(nsamps_in_psd/2-1); is<0; is++)
-         {
-            if( psd_est[-is] >0 )
-            {
-               (*psd_file) << is * delta_f * freq_norm_factor << ", " 
-                           << (10.0*log10(psd_est[-is])) << endl;
-                          // << (10.0*log10(Psd_Est[-is])-offset) << endl;
-            }
-            else
-            {
-               (*psd_file) << is * delta_f * freq_norm_factor << ", -200.0" << endl;
-            }
-         }
-      }
-
-      for(is=0; is<nsamps_in_psd/2; is++)
+      for(is=-(num_bins-1); is<0; is++)
       {
-         if( psd_est[is] >0 )
-         {
-            (*psd_file) << is * delta_f * freq_norm_factor << ", " 
-                        << (10.0*log10(psd_est[is])) << endl;
-                       // << (10.0*log10(Psd_Est[is])-offset) << endl;
-            psd_est[is] = 0.0;
-         }
-         else
-         {
-            (*psd_file) << is * delta_f * freq_norm_factor << ", -200.0" << endl;
-         }
+         (*psd_file) << is * freq_step << ", " 
+                     << out_vals[-is] << endl;
       }
    }
-   else
+
+   for(is=0; is<num_bins; is++)
    {
-      // plot as linear ordinate
-      if(plot_two_sided)
-      {
-         for(is=-(nsamps_in_psd/2-1); is<0; is++)
-         {
-            (*psd_file) << is * delta_f * freq_norm_factor << ", " 
-                        << psd_est[-is] << endl;
-         }
-      }
+      (*psd_file) << is * freq_step << ", " 
+                  << out_vals[is] << endl;
+   }
 
-      for(is=0; is<nsamps_in_psd/2; is++)
-      {
-         (*psd_file) << is * delta_f * freq_norm_factor << ", " 
-                     << psd_est[is] << endl;
-         psd_est[is] = 0.0;
-      }
+   if(output_in_decibels) delete[] out_vals;
+   for(is=0; is<num_bins; is++)
+   {
+      psd_est[is] = 0.0;
    }
 }
+//======================================================
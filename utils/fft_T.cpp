@@ -5,6 +5,9 @@
 #include <iostream> 
 #include <fstream>
 #include <complex>
+#include <math.h>
+
+#include "misdefs.h"
 
 #include "dit_pino_T.h"
 #include "fft_T.h"
@@ -157,6 +160,48 @@ void FFT( complex<T>* signal,
  return;
 }
 //======================================================
+template <class T>
+void RealFftTwiddles( complex<T>* twiddles,
+                      int fft_len )
+{
+    int k;
+    for(k=0; k<fft_len/2; k++){
+        twiddles[k] = complex<T>( T(cos(TWO_PI*k/fft_len)),
+                                  T(-sin(TWO_PI*k/fft_len)) );
+    }
+    return;
+}
+//======================================================
+template <class T>
+void RealFFT( complex<T>* packed_signal,
+              complex<T>* twiddles,
+              complex<T>* sample_spectrum,
+              int fft_len )
+{
+    int k;
+    int half_len = fft_len/2;
+    complex<T> z_k, z_conj, even_part, odd_part;
+    complex<T> minus_j_half = complex<T>(0.0, -0.5);
+
+    ComplexBitReverse<T>(packed_signal, half_len);
+    FftDitPino<T>(packed_signal, half_len);
+
+    // bins 0 and fft_len/2 come from bin 0 of the packed FFT
+    sample_spectrum[0] = complex<T>( packed_signal[0].real()
+                                     + packed_signal[0].imag(), 0.0);
+    sample_spectrum[half_len] = complex<T>( packed_signal[0].real()
+                                     - packed_signal[0].imag(), 0.0);
+
+    for(k=1; k<half_len; k++){
+        z_k = packed_signal[k];
+        z_conj = conj(packed_signal[half_len-k]);
+        even_part = T(0.5) * (z_k + z_conj);
+        odd_part = minus_j_half * (z_k - z_conj);
+        sample_spectrum[k] = even_part + twiddles[k] * odd_part;
+    }
+    return;
+}
+//======================================================
 template void IFFT<double>( std::complex<double>* sample_spectrum,
                     std::complex<double>* time_signal,
                     int num_samps );
@@ -175,4 +220,9 @@ template void FFT<double>( float* time_signal,
                             std::complex<double>* sample_spectrum,
                             int num_samps,
                             int fft_len );
-
+template void RealFftTwiddles<double>( std::complex<double>* twiddles,
+                                       int fft_len );
+template void RealFFT<double>( std::complex<double>* packed_signal,
+                               std::complex<double>* twiddles,
+                               std::complex<double>* sample_spectrum,
+                               int fft_len );
@@ -0,0 +1,124 @@
+//
+//  File = fft_plan_T.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <map>
+#include <mutex>
+#include "misdefs.h"
+#include "log2.h"
+#include "fft_plan_T.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+template <class T>
+FftPlan<T>::FftPlan( int fft_len )
+{
+   int k, log2_len, bit, rev;
+
+   Fft_Len = fft_len;
+   log2_len = ilog2(Fft_Len);
+   if(log2_len < 0){
+      ErrorStream << "Error: FFT length " << Fft_Len
+                  << " is not a power of 2" << endl;
+      exit(-1);
+   }
+
+   Twiddles = new std::complex<T>[Fft_Len/2 + 1];
+   for(k=0; k<Fft_Len/2; k++){
+      Twiddles[k] = std::complex<T>( T(cos(TWO_PI*k/Fft_Len)),
+                                     T(-sin(TWO_PI*k/Fft_Len)) );
+   }
+
+   Bit_Rev = new int[Fft_Len];
+   for(k=0; k<Fft_Len; k++){
+      rev = 0;
+      for(bit=0; bit<log2_len; bit++){
+         rev = (rev << 1) | ((k >> bit) & 1);
+      }
+      Bit_Rev[k] = rev;
+   }
+}
+//======================================================
+template <class T>
+FftPlan<T>::~FftPlan(void)
+{
+   delete[] Twiddles;
+   delete[] Bit_Rev;
+}
+//======================================================
+template <class T>
+void FftPlan<T>::Forward( std::complex<T>* array )
+{
+   Transform(array, false);
+}
+//======================================================
+template <class T>
+void FftPlan<T>::Inverse( std::complex<T>* array )
+{
+   Transform(array, true);
+}
+//======================================================
+template <class T>
+void FftPlan<T>::Transform( std::complex<T>* array,
+                            bool inverse )
+{
+   int k, rev;
+   int half_span, span, tw_step;
+   int top_node, bot_node, bfly_pos;
+   std::complex<T> twiddle, temp;
+
+   for(k=0; k<Fft_Len; k++){
+      rev = Bit_Rev[k];
+      if(rev > k){
+         temp = array[k];
+         array[k] = array[rev];
+         array[rev] = temp;
+      }
+   }
+
+   tw_step = Fft_Len/2;
+   for( half_span=1; half_span<Fft_Len; half_span *= 2){
+      span = 2*half_span;
+      for(bfly_pos=0; bfly_pos<half_span; bfly_pos++){
+         twiddle = Twiddles[bfly_pos*tw_step];
+         if(inverse) twiddle = std::conj(twiddle);
+         for( top_node=bfly_pos; top_node<Fft_Len; top_node += span){
+            bot_node = top_node + half_span;
+            temp = array[bot_node] * twiddle;
+            array[bot_node] = array[top_node] - temp;
+            array[top_node] += temp;
+         }
+      }
+      tw_step /= 2;
+   }
+}
+//======================================================
+//  process-wide cache, one per sample type
+
+template <class T>
+FftPlan<T>* GetFftPlan( int fft_len )
+{
+   static std::map<int, FftPlan<T>*> plan_cache;
+   static std::mutex plan_cache_mutex;
+   FftPlan<T> *plan;
+
+   std::lock_guard<std::mutex> lock(plan_cache_mutex);
+   typename std::map<int, FftPlan<T>*>::iterator
+                                 entry = plan_cache.find(fft_len);
+   if(entry != plan_cache.end()) return(entry->second);
+
+   plan = new FftPlan<T>(fft_len);
+   plan_cache[fft_len] = plan;
+   return(plan);
+}
+//======================================================
+template class FftPlan<float>;
+template class FftPlan<double>;
+template FftPlan<float>* GetFftPlan<float>( int fft_len );
+template FftPlan<double>* GetFftPlan<double>( int fft_len );
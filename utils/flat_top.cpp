@@ -0,0 +1,38 @@
+//
+//  File = flat_top.cpp
+//
+
+#include <math.h>
+#include "flat_top.h"
+#include "misdefs.h"
+
+//======================================================
+FlatTopWindow::FlatTopWindow( int length )
+              :GenericWindow(length)
+{
+   GenerateWindow( length );
+}
+//=======================================================
+void FlatTopWindow::GenerateWindow( int length )
+{
+   double theta;
+
+   // a single-tap window is just its center sample
+   if(length == 1){
+      Half_Lag_Win[0] = 1.0;
+      return;
+   }
+   for(int n=0; n<Half_Length; n++){
+      if(length%2) {
+         theta = TWO_PI*n/(length-1);
+      }
+      else{
+         theta = (2*n+1)*PI/(length-1);
+      }
+      Half_Lag_Win[n] = 0.21557895 + 0.41663158 * cos(theta)
+                        + 0.277263158 * cos(2.0*theta)
+                        + 0.083578947 * cos(3.0*theta)
+                        + 0.006947368 * cos(4.0*theta);
+   }
+   return;
+} 
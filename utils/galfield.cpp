@@ -22,6 +22,17 @@ GaloisField::GaloisField( int base,
     Reduc_Poly[term] = PrimeFieldElem(base,0)-(Prim_Poly->Coefficient(term));
     }
 
+  Fast_Field = NULL;
+  if(base == 2 && degree <= GF2M_MAX_DEGREE)
+    {
+    unsigned long poly_bits = 0;
+    for(int term=0; term<=degree; term++)
+      {
+      if(Prim_Poly->Coefficient(term) != 0) poly_bits |= 1UL << term;
+      }
+    Fast_Field = new Gf2mField(degree, poly_bits);
+    }
+
   #ifdef NOT_DEFINED
   if( ValueIsPrime(order) )
     {
@@ -34,6 +45,13 @@ GaloisField::GaloisField( int base,
     }
   #endif
 }
+//  The primitive polynomial belongs to the caller.
+
+GaloisField::~GaloisField( void )
+{
+  delete[] Reduc_Poly;
+  delete Fast_Field;
+}
 int GaloisField::GetDegree(void)
 {
   return Degree;
@@ -48,6 +66,16 @@ ExtenFieldElem GaloisField::GetElement(int expon)
   ExtenFieldElem result(this);
   PrimeFieldElem *work;
   int dgt_idx,elm_idx;
+
+  if(Fast_Field != NULL)
+    {
+    gf_elem_t elem = Fast_Field->Exp(expon);
+    for(dgt_idx=0; dgt_idx<Degree; dgt_idx++)
+      {
+      result.Value[dgt_idx] = PrimeFieldElem(Base, (elem >> dgt_idx) & 1);
+      }
+    return(result);
+    }
   work = new PrimeFieldElem[Degree+1];
   //
   // Initialize working m-tuple to equal 0...01
@@ -0,0 +1,153 @@
+//
+//  File = gap_err_sampler.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include "gap_err_sampler.h"
+#include "uni_rand.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//  stands for a gap too long to ever be reached
+#define GAP_NEVER 0x3fffffffffffffffLL
+
+//======================================================
+//  constructors
+
+GapErrorSampler::GapErrorSampler( double error_prob,
+                                  long seed )
+{
+   Setup(error_prob, error_prob, 0.0, 0.0, false, seed);
+}
+//======================================================
+GapErrorSampler::GapErrorSampler( double good_error_prob,
+                                  double bad_error_prob,
+                                  double good_to_bad_prob,
+                                  double bad_to_good_prob,
+                                  long seed )
+{
+   Setup( good_error_prob, bad_error_prob,
+          good_to_bad_prob, bad_to_good_prob, true, seed );
+}
+//======================================================
+void GapErrorSampler::Setup( double good_error_prob,
+                             double bad_error_prob,
+                             double good_to_bad_prob,
+                             double bad_to_good_prob,
+                             bool two_state,
+                             long seed )
+{
+   int is;
+
+   Error_Prob[0] = good_error_prob;
+   Error_Prob[1] = bad_error_prob;
+   Switch_Prob[0] = good_to_bad_prob;
+   Switch_Prob[1] = bad_to_good_prob;
+   for(is=0; is<2; is++){
+      if( Error_Prob[is] < 0.0 || Error_Prob[is] > 1.0 ||
+          Switch_Prob[is] < 0.0 || Switch_Prob[is] > 1.0 ){
+         ErrorStream << "Error: channel probabilities must be 0 thru 1" << endl;
+         exit(-1);
+      }
+      Log_No_Error[is] = log1p(-Error_Prob[is]);
+      Log_No_Switch[is] = log1p(-Switch_Prob[is]);
+   }
+   Two_State = two_state;
+   In_Bad_State = false;
+   Seed = seed;
+   Error_Count = 0;
+   Bit_Count = 0;
+
+   Gap_To_Error = DrawGap(Log_No_Error[0]);
+   Bits_In_State = Two_State ? 1 + DrawGap(Log_No_Switch[0]) : GAP_NEVER;
+}
+//======================================================
+//  number of failures before the first success of
+//  independent trials, floor(log(u)/log(1-p))
+
+long long GapErrorSampler::DrawGap( double log_keep_prob )
+{
+   double gap;
+
+   if(log_keep_prob == 0.0) return(GAP_NEVER);
+   gap = floor( log(DoubleUniformRandom(&Seed)) / log_keep_prob );
+   if(gap >= double(GAP_NEVER)) return(GAP_NEVER);
+   return((long long)gap);
+}
+//======================================================
+double GapErrorSampler::GetMeanErrorProb(void)
+{
+   double switch_sum;
+
+   if(!Two_State) return(Error_Prob[0]);
+   switch_sum = Switch_Prob[0] + Switch_Prob[1];
+   if(switch_sum <= 0.0) return(Error_Prob[In_Bad_State ? 1 : 0]);
+   return( (Switch_Prob[1]*Error_Prob[0] + Switch_Prob[0]*Error_Prob[1])
+           / switch_sum );
+}
+//======================================================
+//  Steps from error to error or state change to state
+//  change, whichever comes first.  Both gaps are
+//  memoryless, so the error gap is simply redrawn with
+//  the new state's probability at each change.
+
+void GapErrorSampler::FindErrors( int num_bits )
+{
+   long long pos, span;
+   int state;
+
+   Err_Pos.clear();
+   pos = 0;
+   while(pos < num_bits){
+      state = In_Bad_State ? 1 : 0;
+      span = num_bits - pos;
+      if(Bits_In_State < span) span = Bits_In_State;
+
+      if(Gap_To_Error < span){
+         pos += Gap_To_Error;
+         Err_Pos.push_back(int(pos));
+         pos++;
+         if(Two_State) Bits_In_State -= Gap_To_Error + 1;
+         Gap_To_Error = DrawGap(Log_No_Error[state]);
+      }
+      else{
+         pos += span;
+         if(Two_State) Bits_In_State -= span;
+         Gap_To_Error -= span;
+      }
+
+      if(Two_State && Bits_In_State == 0){
+         In_Bad_State = !In_Bad_State;
+         state = In_Bad_State ? 1 : 0;
+         Bits_In_State = 1 + DrawGap(Log_No_Switch[state]);
+         Gap_To_Error = DrawGap(Log_No_Error[state]);
+      }
+   }
+   Error_Count += Err_Pos.size();
+   Bit_Count += num_bits;
+}
+//======================================================
+int GapErrorSampler::Inject( bit_t *bits, int num_bits )
+{
+   int num_errs, ie;
+
+   FindErrors(num_bits);
+   num_errs = int(Err_Pos.size());
+   for(ie=0; ie<num_errs; ie++) bits[Err_Pos[ie]] ^= 1;
+   return(num_errs);
+}
+//======================================================
+int GapErrorSampler::InjectPacked( unsigned long long *words, int num_bits )
+{
+   int num_errs, ie, pos;
+
+   FindErrors(num_bits);
+   num_errs = int(Err_Pos.size());
+   for(ie=0; ie<num_errs; ie++){
+      pos = Err_Pos[ie];
+      words[pos >> 6] ^= 1ULL << (pos & 63);
+   }
+   return(num_errs);
+}
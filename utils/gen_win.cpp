@@ -14,6 +14,13 @@ GenericWindow::GenericWindow( int length )
    Initialize(length);
 }
 //=====================================================
+GenericWindow::~GenericWindow( void )
+{
+   delete[] Half_Lag_Win;
+   delete[] Lag_Win;
+   delete[] Data_Win;
+}
+//=====================================================
 void GenericWindow::Initialize( int length )
 {
    Length = length;
@@ -24,6 +31,7 @@ void GenericWindow::Initialize( int length )
       Half_Length = length/2; 
    }
    Half_Lag_Win = new double[Half_Length];
+   Lag_Win = NULL;
    Data_Win = NULL;
 
    return;
@@ -73,6 +81,21 @@ double* GenericWindow::GetDataWindow( void )
    }
    return(Data_Win);
 }
+//======================================================
+//  equivalent noise bandwidth in bins:
+//  N * sum(w**2) / (sum(w))**2
+
+double GenericWindow::GetEnbw( void )
+{
+   double *data_win = GetDataWindow();
+   double sum = 0.0;
+   double sum_sqrd = 0.0;
+   for(int n=0; n<Length; n++){
+      sum += data_win[n];
+      sum_sqrd += data_win[n]*data_win[n];
+   }
+   return( Length*sum_sqrd/(sum*sum) );
+}
 //======================================================  
 double* GenericWindow::GetHalfLagWindow( void )
 {
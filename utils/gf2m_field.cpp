@@ -0,0 +1,264 @@
+//
+//  File = gf2m_field.cpp
+//
+
+#include <stdlib.h>
+#include "gf2m_field.h"
+#include "packed_gf2.h"
+#include "psstream.h"
+
+#if defined(__SSSE3__) && !defined(_GF_SSSE3)
+  #define _GF_SSSE3
+#endif
+#ifdef _GF_SSSE3
+  #include <tmmintrin.h>
+#endif
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+Gf2mField::Gf2mField( int degree, unsigned long prim_poly_bits )
+{
+   unsigned long elem;
+   int i;
+
+   if(degree < 1 || degree > GF2M_MAX_DEGREE){
+      ErrorStream << "Error: GF(2**m) tables limited to m = 1 thru "
+                  << GF2M_MAX_DEGREE << endl;
+      exit(-1);
+   }
+   Degree = degree;
+   Order = (1 << Degree) - 1;
+   if(prim_poly_bits == 0){
+      prim_poly_bits = (unsigned long)FindSimplestPrimitiveOvrGF2(Degree).LowWord();
+   }
+   Prim_Poly = prim_poly_bits;
+   if((Prim_Poly >> Degree) != 1){
+      ErrorStream << "Error: field polynomial does not have degree "
+                  << Degree << endl;
+      exit(-1);
+   }
+
+   Log_Table = new int[Order+1];
+   Exp_Table = new gf_elem_t[2*Order];
+   Log_Table[0] = 0;
+
+   // successive powers of alpha; alpha must not return to
+   // 1 before all Order nonzero elements are generated
+   elem = 1;
+   for(i=0; i<Order; i++){
+      if(elem == 0 || (i > 0 && elem == 1)){
+         ErrorStream << "Error: field polynomial " << int(Prim_Poly)
+                     << " is not primitive" << endl;
+         exit(-1);
+      }
+      Exp_Table[i] = gf_elem_t(elem);
+      Exp_Table[i+Order] = gf_elem_t(elem);
+      Log_Table[elem] = i;
+      elem <<= 1;
+      if(elem >> Degree) elem ^= Prim_Poly;
+   }
+}
+//======================================================
+Gf2mField::~Gf2mField(void)
+{
+   delete[] Log_Table;
+   delete[] Exp_Table;
+}
+//======================================================
+gf_elem_t Gf2mField::Div( gf_elem_t a, gf_elem_t b )
+{
+   if(b == 0){
+      ErrorStream << "Error: division by zero in GF(2**" << Degree << ")" << endl;
+      exit(-1);
+   }
+   if(a == 0) return(0);
+   return(Exp_Table[Log_Table[a] - Log_Table[b] + Order]);
+}
+//======================================================
+gf_elem_t Gf2mField::Inverse( gf_elem_t a )
+{
+   return(Div(1, a));
+}
+//======================================================
+gf_elem_t Gf2mField::Power( gf_elem_t a, int expon )
+{
+   if(a == 0) return( (expon == 0) ? 1 : 0 );
+   long long log_val = ((long long)Log_Table[a] * expon) % Order;
+   if(log_val < 0) log_val += Order;
+   return(Exp_Table[log_val]);
+}
+//======================================================
+gf_elem_t Gf2mField::Exp( int expon )
+{
+   expon %= Order;
+   if(expon < 0) expon += Order;
+   return(Exp_Table[expon]);
+}
+//======================================================
+void Gf2mField::MulVector( gf_elem_t coeff,
+                           const gf_elem_t *src,
+                           gf_elem_t *dest,
+                           int num_elems )
+{
+   int is, log_coeff;
+
+   if(coeff == 0){
+      for(is=0; is<num_elems; is++) dest[is] = 0;
+      return;
+   }
+#ifdef _GF_SSSE3
+   if(num_elems >= GF2M_SPLIT_MIN_LEN){
+      SplitMulVector(coeff, src, dest, num_elems, false);
+      return;
+   }
+#endif
+   log_coeff = Log_Table[coeff];
+   for(is=0; is<num_elems; is++){
+      dest[is] = (src[is] == 0) ? 0 : Exp_Table[log_coeff + Log_Table[src[is]]];
+   }
+}
+//======================================================
+void Gf2mField::MulAccumVector( gf_elem_t coeff,
+                                const gf_elem_t *src,
+                                gf_elem_t *dest,
+                                int num_elems )
+{
+   int is, log_coeff;
+
+   if(coeff == 0) return;
+#ifdef _GF_SSSE3
+   if(num_elems >= GF2M_SPLIT_MIN_LEN){
+      SplitMulVector(coeff, src, dest, num_elems, true);
+      return;
+   }
+#endif
+   log_coeff = Log_Table[coeff];
+   for(is=0; is<num_elems; is++){
+      if(src[is] != 0) dest[is] ^= Exp_Table[log_coeff + Log_Table[src[is]]];
+   }
+}
+//======================================================
+void Gf2mField::BuildSplitTables( gf_elem_t coeff,
+                                  unsigned char split_lo[4][16],
+                                  unsigned char split_hi[4][16] )
+{
+   int k, d, nib_val;
+   gf_elem_t prod;
+
+   for(k=0; k<4; k++){
+      for(d=0; d<16; d++){
+         nib_val = d << (4*k);
+         prod = (nib_val <= Order) ? Mul(coeff, gf_elem_t(nib_val)) : 0;
+         split_lo[k][d] = (unsigned char)(prod & 0xff);
+         split_hi[k][d] = (unsigned char)(prod >> 8);
+      }
+   }
+}
+//======================================================
+//  Multiplication by a constant is linear over GF(2), so
+//  the product is the sum of the products of the four
+//  nibbles of each element, each looked up in a 16-entry
+//  table.  With PSHUFB sixteen lookups are one
+//  instruction; the scalar loop only finishes the tail.
+
+void Gf2mField::SplitMulVector( gf_elem_t coeff,
+                                const gf_elem_t *src,
+                                gf_elem_t *dest,
+                                int num_elems,
+                                bool accumulate )
+{
+   unsigned char split_lo[4][16];
+   unsigned char split_hi[4][16];
+   gf_elem_t val, prod;
+   int is, k;
+
+   BuildSplitTables(coeff, split_lo, split_hi);
+   is = 0;
+
+#ifdef _GF_SSSE3
+   __m128i tab_lo[4], tab_hi[4];
+   __m128i byte_mask = _mm_set1_epi16(0x00ff);
+   __m128i nib_mask = _mm_set1_epi8(0x0f);
+   __m128i src_0, src_1, lo_bytes, hi_bytes, nib[4];
+   __m128i res_lo, res_hi;
+
+   for(k=0; k<4; k++){
+      tab_lo[k] = _mm_loadu_si128((const __m128i*)split_lo[k]);
+      tab_hi[k] = _mm_loadu_si128((const __m128i*)split_hi[k]);
+   }
+   for(; is+16<=num_elems; is+=16){
+      src_0 = _mm_loadu_si128((const __m128i*)(src+is));
+      src_1 = _mm_loadu_si128((const __m128i*)(src+is+8));
+      lo_bytes = _mm_packus_epi16( _mm_and_si128(src_0, byte_mask),
+                                   _mm_and_si128(src_1, byte_mask) );
+      hi_bytes = _mm_packus_epi16( _mm_srli_epi16(src_0, 8),
+                                   _mm_srli_epi16(src_1, 8) );
+      nib[0] = _mm_and_si128(lo_bytes, nib_mask);
+      nib[1] = _mm_and_si128(_mm_srli_epi16(lo_bytes, 4), nib_mask);
+      nib[2] = _mm_and_si128(hi_bytes, nib_mask);
+      nib[3] = _mm_and_si128(_mm_srli_epi16(hi_bytes, 4), nib_mask);
+
+      res_lo = _mm_shuffle_epi8(tab_lo[0], nib[0]);
+      res_hi = _mm_shuffle_epi8(tab_hi[0], nib[0]);
+      for(k=1; k<4; k++){
+         res_lo = _mm_xor_si128(res_lo, _mm_shuffle_epi8(tab_lo[k], nib[k]));
+         res_hi = _mm_xor_si128(res_hi, _mm_shuffle_epi8(tab_hi[k], nib[k]));
+      }
+      src_0 = _mm_unpacklo_epi8(res_lo, res_hi);
+      src_1 = _mm_unpackhi_epi8(res_lo, res_hi);
+      if(accumulate){
+         src_0 = _mm_xor_si128(src_0, _mm_loadu_si128((const __m128i*)(dest+is)));
+         src_1 = _mm_xor_si128(src_1, _mm_loadu_si128((const __m128i*)(dest+is+8)));
+      }
+      _mm_storeu_si128((__m128i*)(dest+is), src_0);
+      _mm_storeu_si128((__m128i*)(dest+is+8), src_1);
+   }
+#endif
+
+   for(; is<num_elems; is++){
+      val = src[is];
+      prod = 0;
+      for(k=0; k<4; k++){
+         prod ^= gf_elem_t( split_lo[k][val & 15] | (split_hi[k][val & 15] << 8) );
+         val >>= 4;
+      }
+      dest[is] = accumulate ? gf_elem_t(dest[is] ^ prod) : prod;
+   }
+}
+//======================================================
+//  product of (x + beta) over the conjugates beta of
+//  alpha**expon, whose coefficients all lie in GF(2)
+
+unsigned long Gf2mField::MinimalPolyBits( int expon )
+{
+   gf_elem_t coeff[GF2M_MAX_DEGREE+1];
+   gf_elem_t root;
+   unsigned long poly_bits;
+   int conj_expon, deg, j;
+
+   expon %= Order;
+   if(expon < 0) expon += Order;
+
+   coeff[0] = 1;
+   deg = 0;
+   conj_expon = expon;
+   do{
+      root = Exp_Table[conj_expon];
+      coeff[deg+1] = coeff[deg];
+      for(j=deg; j>=1; j--){
+         coeff[j] = coeff[j-1] ^ Mul(root, coeff[j]);
+      }
+      coeff[0] = Mul(root, coeff[0]);
+      deg++;
+      conj_expon = (2*conj_expon) % Order;
+   } while(conj_expon != expon);
+
+   poly_bits = 0;
+   for(j=0; j<=deg; j++){
+      if(coeff[j] != 0) poly_bits |= 1UL << j;
+   }
+   return(poly_bits);
+}
@@ -0,0 +1,164 @@
+//
+//  File = gf_synd_dec.cpp
+//
+
+#include <stdlib.h>
+#include "gf_synd_dec.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+GfSyndromeDecoder::GfSyndromeDecoder( Gf2mField *field,
+                                      int code_len,
+                                      int num_synd,
+                                      int first_root )
+{
+   int j, p;
+
+   Field = field;
+   Code_Len = code_len;
+   Num_Synd = num_synd;
+   Max_Errs = num_synd/2;
+   First_Root = first_root;
+   if(Code_Len < 2 || Code_Len > Field->GetOrder()){
+      ErrorStream << "Error: code length must be 2 thru "
+                  << Field->GetOrder() << endl;
+      exit(-1);
+   }
+
+   Synd_Roots = new gf_elem_t[Num_Synd];
+   for(j=0; j<Num_Synd; j++) Synd_Roots[j] = Field->Exp(First_Root + j);
+
+   Chien_Table = new gf_elem_t[Max_Errs*Code_Len + 1];
+   for(j=1; j<=Max_Errs; j++){
+      for(p=0; p<Code_Len; p++){
+         Chien_Table[(j-1)*Code_Len + p] = Field->Exp(-j*p);
+      }
+   }
+
+   Batch_Syms.resize(Code_Len*GF_SYND_BATCH);
+   Batch_Synd.resize(Num_Synd*GF_SYND_BATCH);
+   Chien_Sum.resize(Code_Len);
+   Prev_Locator.resize(Num_Synd+2);
+   Temp_Locator.resize(Num_Synd+2);
+}
+//======================================================
+GfSyndromeDecoder::~GfSyndromeDecoder(void)
+{
+   delete[] Synd_Roots;
+   delete[] Chien_Table;
+}
+//======================================================
+void GfSyndromeDecoder::ComputeSyndromes( const gf_elem_t *cws,
+                                          int num_cws,
+                                          gf_elem_t *synd )
+{
+   gf_elem_t *syms, *acc;
+   int beg_cw, num_batch, iw, is, j;
+
+   for(beg_cw=0; beg_cw<num_cws; beg_cw+=GF_SYND_BATCH){
+      num_batch = num_cws - beg_cw;
+      if(num_batch > GF_SYND_BATCH) num_batch = GF_SYND_BATCH;
+
+      // symbol-major copy of the batch
+      syms = &Batch_Syms[0];
+      for(iw=0; iw<num_batch; iw++){
+         const gf_elem_t *cw = cws + (beg_cw+iw)*Code_Len;
+         for(is=0; is<Code_Len; is++) syms[is*num_batch + iw] = cw[is];
+      }
+
+      for(j=0; j<Num_Synd; j++){
+         acc = &Batch_Synd[j*num_batch];
+         for(iw=0; iw<num_batch; iw++) acc[iw] = syms[iw];
+         for(is=1; is<Code_Len; is++){
+            Field->MulVector(Synd_Roots[j], acc, acc, num_batch);
+            const gf_elem_t *col = syms + is*num_batch;
+            for(iw=0; iw<num_batch; iw++) acc[iw] ^= col[iw];
+         }
+      }
+
+      for(iw=0; iw<num_batch; iw++){
+         for(j=0; j<Num_Synd; j++){
+            synd[(beg_cw+iw)*Num_Synd + j] = Batch_Synd[j*num_batch + iw];
+         }
+      }
+   }
+}
+//======================================================
+int GfSyndromeDecoder::FindErrorLocator( const gf_elem_t *synd,
+                                         gf_elem_t *locator )
+{
+   gf_elem_t *prev = &Prev_Locator[0];
+   gf_elem_t *temp = &Temp_Locator[0];
+   gf_elem_t discrep, prev_discrep, scale;
+   int lfsr_len, shift, n, i;
+
+   for(i=0; i<=Max_Errs; i++){
+      locator[i] = 0;
+      prev[i] = 0;
+   }
+   locator[0] = 1;
+   prev[0] = 1;
+   lfsr_len = 0;
+   shift = 1;
+   prev_discrep = 1;
+
+   for(n=0; n<Num_Synd; n++){
+      discrep = synd[n];
+      for(i=1; i<=lfsr_len && i<=n; i++){
+         discrep ^= Field->Mul(locator[i], synd[n-i]);
+      }
+      if(discrep == 0){
+         shift++;
+         continue;
+      }
+      scale = Field->Div(discrep, prev_discrep);
+      if(2*lfsr_len <= n){
+         for(i=0; i<=Max_Errs; i++) temp[i] = locator[i];
+         for(i=0; i+shift<=Max_Errs; i++){
+            locator[i+shift] ^= Field->Mul(scale, prev[i]);
+         }
+         lfsr_len = n+1-lfsr_len;
+         if(lfsr_len > Max_Errs) return(-1);
+         for(i=0; i<=Max_Errs; i++) prev[i] = temp[i];
+         prev_discrep = discrep;
+         shift = 1;
+      }
+      else{
+         for(i=0; i+shift<=Max_Errs; i++){
+            locator[i+shift] ^= Field->Mul(scale, prev[i]);
+         }
+         shift++;
+      }
+   }
+   while(lfsr_len > 0 && locator[lfsr_len] == 0) lfsr_len--;
+   return(lfsr_len);
+}
+//======================================================
+//  Every coefficient of the locator scales a whole row of
+//  powers, so the search over all positions is num_errs
+//  vector multiply-accumulates.
+
+int GfSyndromeDecoder::FindErrorPositions( const gf_elem_t *locator,
+                                           int num_errs,
+                                           int *err_pos )
+{
+   gf_elem_t *chien_sum = &Chien_Sum[0];
+   int num_found, j, p;
+
+   for(p=0; p<Code_Len; p++) chien_sum[p] = locator[0];
+   for(j=1; j<=num_errs; j++){
+      Field->MulAccumVector( locator[j], Chien_Table + (j-1)*Code_Len,
+                             chien_sum, Code_Len );
+   }
+   num_found = 0;
+   for(p=0; p<Code_Len; p++){
+      if(chien_sum[p] != 0) continue;
+      if(num_found == num_errs) return(-1);
+      err_pos[num_found++] = p;
+   }
+   return( (num_found == num_errs) ? num_found : -1 );
+}
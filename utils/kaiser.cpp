@@ -0,0 +1,54 @@
+//
+//  File = kaiser.cpp
+//
+
+#include <math.h>
+#include "kaiser.h"
+#include "misdefs.h"
+
+//======================================================
+//  zeroth-order modified Bessel function of the first
+//  kind, summed until the terms stop contributing
+
+static double BesselI0( double x )
+{
+   double sum = 1.0;
+   double term = 1.0;
+   double half_x = x/2.0;
+   for(int k=1; k<100; k++){
+      term *= (half_x/k)*(half_x/k);
+      sum += term;
+      if(term < 1.0e-12*sum) break;
+   }
+   return(sum);
+}
+//======================================================
+KaiserWindow::KaiserWindow( int length,
+                            double beta )
+             :GenericWindow(length)
+{
+   GenerateWindow( length, beta );
+}
+//=======================================================
+void KaiserWindow::GenerateWindow( int length, 
+                                   double beta )
+{
+   double ratio;
+   double denom = BesselI0(beta);
+
+   // a single-tap window is just its center sample
+   if(length == 1){
+      Half_Lag_Win[0] = 1.0;
+      return;
+   }
+   for(int n=0; n<Half_Length; n++){
+      if(length%2) {
+         ratio = 2.0*n/double(length-1);
+      }
+      else{
+         ratio = (2.0*n+1.0)/double(length-1);
+      }
+      Half_Lag_Win[n] = BesselI0(beta*sqrt(1.0 - ratio*ratio))/denom;
+   }
+   return;
+} 
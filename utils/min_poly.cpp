@@ -20,6 +20,20 @@ MinimalPolynomial::MinimalPolynomial( GaloisField* exten_field,
    PolyOvrExtenField** factors;
    ExtenFieldElem* element;
    num_factors = coset->size;
+
+   // the conjugates are just the coset's exponents, so with
+   // field tables the product is formed on plain integers
+   Gf2mField *fast_field = exten_field->GetFastField();
+   if(fast_field != NULL){
+      unsigned long poly_bits = fast_field->MinimalPolyBits(coset->start[0]);
+      Prime_Base = 2;
+      Degree = num_factors;
+      Coeff = new PrimeFieldElem[num_factors+1];
+      for(i=0; i<=num_factors; i++){
+         Coeff[i] = PrimeFieldElem(2, int((poly_bits >> i) & 1));
+      }
+      return;
+   }
    factors = new PolyOvrExtenField*[num_factors];
   
    for(i=0; i<num_factors; i++){
@@ -0,0 +1,488 @@
+//
+//  File = ngram_stats.cpp
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <thread>
+#include "ngram_stats.h"
+#include "q_func.h"
+#include "psstream.h"
+
+#if defined(__SSE2__) && !defined(_NGRAM_SSE2)
+  #define _NGRAM_SSE2
+#endif
+#ifdef _NGRAM_SSE2
+  #include <emmintrin.h>
+#endif
+
+extern PracSimStream BasicResults;
+extern PracSimStream ErrorStream;
+
+//======================================================
+static int IntPower( int base, int expon )
+{
+   int result = 1;
+   for(int i=0; i<expon; i++) result *= base;
+   return(result);
+}
+
+//======================================================
+//  constructor
+
+NgramCounter::NgramCounter( int num_symbs,
+                            int first_symb,
+                            int max_order )
+{
+   int k;
+   double num_entries;
+
+   if(num_symbs < 1 || max_order < 1 || max_order > NGRAM_MAX_ORDER){
+      ErrorStream << "Error: n-gram counter needs at least one symbol and order 1 thru "
+                  << NGRAM_MAX_ORDER << endl;
+      exit(-1);
+   }
+   num_entries = pow(double(num_symbs), double(max_order));
+   if(num_entries > double(NGRAM_MAX_TABLE_ENTRIES)){
+      ErrorStream << "Error: " << num_symbs << " symbols to order " << max_order
+                  << " exceeds the n-gram table limit of "
+                  << NGRAM_MAX_TABLE_ENTRIES << " entries" << endl;
+      exit(-1);
+   }
+   Num_Symbs = num_symbs;
+   First_Symb = first_symb;
+   Max_Order = max_order;
+   Table_Size = IntPower(Num_Symbs, Max_Order);
+   Num_Lanes = (Table_Size <= NGRAM_LANE_MAX_ENTRIES) ? NGRAM_LANES : 1;
+   Num_Slices = (Table_Size + (1<<NGRAM_SLICE_LOG2) - 1) >> NGRAM_SLICE_LOG2;
+
+   Lane_Counts = new unsigned int[Num_Lanes*Table_Size];
+   Total_Counts = new long long[Table_Size];
+   for(k=0; k<Max_Order-1; k++){
+      Lead_Counts[k].resize(IntPower(Num_Symbs, k+1));
+   }
+   if(Num_Slices > 1){
+      Idx_Buf.resize(NGRAM_SLICE_CHUNK);
+      Sorted_Buf.resize(NGRAM_SLICE_CHUNK);
+   }
+   Reset();
+}
+//======================================================
+NgramCounter::~NgramCounter(void)
+{
+   delete[] Lane_Counts;
+   delete[] Total_Counts;
+}
+//======================================================
+void NgramCounter::Reset(void)
+{
+   memset(Lane_Counts, 0, Num_Lanes*Table_Size*sizeof(unsigned int));
+   memset(Total_Counts, 0, Table_Size*sizeof(long long));
+   for(int k=0; k<Max_Order-1; k++){
+      memset(&Lead_Counts[k][0], 0, Lead_Counts[k].size()*sizeof(long long));
+   }
+   Pending_Count = 0;
+}
+//======================================================
+void NgramCounter::Flush(void)
+{
+   unsigned int *lane_ptr;
+   int lane, idx;
+
+   if(Pending_Count == 0) return;
+   for(lane=0; lane<Num_Lanes; lane++){
+      lane_ptr = Lane_Counts + lane*Table_Size;
+      for(idx=0; idx<Table_Size; idx++){
+         Total_Counts[idx] += lane_ptr[idx];
+         lane_ptr[idx] = 0;
+      }
+   }
+   Pending_Count = 0;
+}
+//======================================================
+void NgramCounter::Tally( const byte_t *symbs,
+                          int num_in,
+                          int lead_len )
+{
+   int hist_len = Max_Order - 1;
+   int top_weight = IntPower(Num_Symbs, hist_len);
+   unsigned int *lane_base[NGRAM_LANES];
+   unsigned int lane_idx[NGRAM_LANES];
+   int part_beg[NGRAM_LANES];
+   const byte_t *part_ptr;
+   unsigned int idx;
+   int is, ib, k, lane, part_len, num_now, weight;
+
+   if(Pending_Count + num_in > NGRAM_FLUSH_LIMIT) Flush();
+   Pending_Count += num_in;
+
+   //  grams shorter than Max_Order at a stream start
+   for(is=0; is<num_in && lead_len+is<hist_len; is++){
+      idx = 0;
+      weight = 1;
+      for(k=1; k<=lead_len+is+1; k++){
+         idx += (symbs[is-k+1] - First_Symb)*weight;
+         weight *= Num_Symbs;
+         Lead_Counts[k-1][idx]++;
+      }
+   }
+   if(is >= num_in) return;
+
+   //  The rest is split into NGRAM_LANES contiguous parts,
+   //  each with its own rolling index: the newest symbol
+   //  is added as the low digit and, after counting, the
+   //  oldest is taken off.  The parts are independent, so
+   //  their multiply-add chains overlap instead of running
+   //  one after another.
+   part_len = (num_in - is)/NGRAM_LANES;
+   for(lane=0; lane<NGRAM_LANES; lane++){
+      part_beg[lane] = is + lane*part_len;
+      lane_base[lane] = Lane_Counts + (lane % Num_Lanes)*Table_Size;
+      lane_idx[lane] = 0;
+      for(k=hist_len; k>=1; k--){
+         lane_idx[lane] = lane_idx[lane]*Num_Symbs + (symbs[part_beg[lane]-k] - First_Symb);
+      }
+   }
+   for(ib=0; ib<part_len; ib+=num_now){
+      num_now = part_len - ib;
+      if(Num_Slices == 1){
+         for(k=0; k<num_now; k++){
+            for(lane=0; lane<NGRAM_LANES; lane++){
+               part_ptr = symbs + part_beg[lane] + ib + k;
+               idx = lane_idx[lane]*Num_Symbs + (part_ptr[0] - First_Symb);
+               lane_base[lane][idx]++;
+               lane_idx[lane] = idx - (part_ptr[-hist_len] - First_Symb)*top_weight;
+            }
+         }
+      }
+      else{
+         if(num_now > NGRAM_SLICE_CHUNK/NGRAM_LANES) num_now = NGRAM_SLICE_CHUNK/NGRAM_LANES;
+         for(k=0; k<num_now; k++){
+            for(lane=0; lane<NGRAM_LANES; lane++){
+               part_ptr = symbs + part_beg[lane] + ib + k;
+               idx = lane_idx[lane]*Num_Symbs + (part_ptr[0] - First_Symb);
+               Idx_Buf[NGRAM_LANES*k + lane] = idx;
+               lane_idx[lane] = idx - (part_ptr[-hist_len] - First_Symb)*top_weight;
+            }
+         }
+         PartitionCount(NGRAM_LANES*num_now);
+      }
+   }
+
+   //  the last few symbols that did not fill a part
+   for(is+=NGRAM_LANES*part_len; is<num_in; is++){
+      idx = 0;
+      for(k=hist_len; k>=0; k--) idx = idx*Num_Symbs + (symbs[is-k] - First_Symb);
+      Lane_Counts[idx]++;
+   }
+}
+//======================================================
+//  A table too big for cache would take a miss on almost
+//  every increment.  Instead the indices of a chunk are
+//  bucketed by table slice with a counting sort, and the
+//  slices are then updated one after another so each
+//  stays cache resident while it is being hit.
+
+void NgramCounter::PartitionCount( int num_idx )
+{
+   std::vector<int> slice_pos(Num_Slices+1, 0);
+   int ic, slice;
+
+   for(ic=0; ic<num_idx; ic++){
+      slice_pos[(Idx_Buf[ic] >> NGRAM_SLICE_LOG2) + 1]++;
+   }
+   for(slice=0; slice<Num_Slices; slice++){
+      slice_pos[slice+1] += slice_pos[slice];
+   }
+   for(ic=0; ic<num_idx; ic++){
+      Sorted_Buf[slice_pos[Idx_Buf[ic] >> NGRAM_SLICE_LOG2]++] = Idx_Buf[ic];
+   }
+   for(ic=0; ic<num_idx; ic++){
+      Lane_Counts[Sorted_Buf[ic]]++;
+   }
+}
+//======================================================
+void NgramCounter::Merge( NgramCounter *other )
+{
+   int idx, k;
+
+   if(other->Table_Size != Table_Size || other->Max_Order != Max_Order){
+      ErrorStream << "Error: cannot merge n-gram counters of different shape" << endl;
+      exit(-1);
+   }
+   Flush();
+   other->Flush();
+   for(idx=0; idx<Table_Size; idx++){
+      Total_Counts[idx] += other->Total_Counts[idx];
+   }
+   for(k=0; k<Max_Order-1; k++){
+      for(idx=0; idx<int(Lead_Counts[k].size()); idx++){
+         Lead_Counts[k][idx] += other->Lead_Counts[k][idx];
+      }
+   }
+}
+//======================================================
+void NgramCounter::GetCounts( int order, long long *counts )
+{
+   int order_size = IntPower(Num_Symbs, order);
+   int hi, lo;
+   const long long *tot_ptr;
+
+   Flush();
+   for(lo=0; lo<order_size; lo++){
+      counts[lo] = (order < Max_Order) ? Lead_Counts[order-1][lo] : 0;
+   }
+   //  marginal over the oldest Max_Order-order symbols
+   tot_ptr = Total_Counts;
+   for(hi=0; hi<Table_Size/order_size; hi++){
+      for(lo=0; lo<order_size; lo++){
+         counts[lo] += tot_ptr[lo];
+      }
+      tot_ptr += order_size;
+   }
+}
+
+//======================================================
+//  constructor
+
+NgramStats::NgramStats( int num_symbs,
+                        int first_symb,
+                        int max_order,
+                        bool continuous_run,
+                        int num_threads )
+{
+   if(num_threads < 1){
+      ErrorStream << "Error: n-gram statistics need at least one thread" << endl;
+      exit(-1);
+   }
+   Num_Symbs = num_symbs;
+   First_Symb = first_symb;
+   Max_Order = max_order;
+   Continuous_Run = continuous_run;
+   Num_Threads = num_threads;
+   for(int it=0; it<Num_Threads; it++){
+      Partials.push_back(new NgramCounter(Num_Symbs, First_Symb, Max_Order));
+   }
+   Hist_Len = 0;
+}
+//======================================================
+NgramStats::~NgramStats(void)
+{
+   for(int it=0; it<Num_Threads; it++) delete Partials[it];
+}
+//======================================================
+void NgramStats::Reset(void)
+{
+   for(int it=0; it<Num_Threads; it++) Partials[it]->Reset();
+   Hist_Len = 0;
+}
+//======================================================
+void NgramStats::Tally( const byte_t *symbs, int num_in )
+{
+   std::vector<std::thread*> workers;
+   byte_t bad_symb;
+   int is, it, num_head, num_body, num_slices, slice_len, keep;
+
+   if(num_in <= 0) return;
+
+   bad_symb = 0;
+   is = 0;
+#ifdef _NGRAM_SSE2
+   //  unsigned compare done as signed after flipping the
+   //  sign bits; symbols below First_Symb wrap to large
+   __m128i sign_bit = _mm_set1_epi32(int(0x80000000));
+   __m128i first_vec = _mm_set1_epi32(First_Symb);
+   __m128i limit_vec = _mm_set1_epi32(int((Num_Symbs-1) ^ 0x80000000));
+   __m128i bad_vec = _mm_setzero_si128();
+   __m128i symb_vec;
+   for(; is+4<=num_in; is+=4){
+      symb_vec = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(symbs+is)), first_vec);
+      bad_vec = _mm_or_si128(bad_vec,
+                   _mm_cmpgt_epi32(_mm_xor_si128(symb_vec, sign_bit), limit_vec));
+   }
+   bad_symb = byte_t(_mm_movemask_epi8(bad_vec));
+#endif
+   for(; is<num_in; is++){
+      bad_symb |= (symbs[is] - First_Symb >= byte_t(Num_Symbs));
+   }
+   if(bad_symb){
+      ErrorStream << "Error: symbol outside the range " << First_Symb
+                  << " thru " << (First_Symb + Num_Symbs - 1) << endl;
+      exit(-1);
+   }
+
+   //  grams ending in the first Max_Order-1 symbols reach
+   //  back into the carried history
+   num_head = (num_in < Max_Order-1) ? num_in : Max_Order-1;
+   for(is=0; is<num_head; is++) Stitch[Hist_Len+is] = symbs[is];
+   Partials[0]->Tally(Stitch+Hist_Len, num_head, Hist_Len);
+
+   //  the rest have their full history within the block
+   num_body = num_in - num_head;
+   num_slices = (num_body >= Num_Threads*NGRAM_MIN_THREAD_SYMBS) ? Num_Threads : 1;
+   slice_len = num_body/num_slices;
+   for(it=1; it<num_slices; it++){
+      workers.push_back(
+            new std::thread( &NgramCounter::Tally, Partials[it],
+                             symbs + num_head + it*slice_len,
+                             (it == num_slices-1) ? num_body - it*slice_len : slice_len,
+                             Max_Order-1 ));
+   }
+   if(num_body > 0){
+      Partials[0]->Tally(symbs+num_head, (num_slices == 1) ? num_body : slice_len, Max_Order-1);
+   }
+   for(it=0; it<int(workers.size()); it++){
+      workers[it]->join();
+      delete workers[it];
+   }
+
+   if(!Continuous_Run){
+      Hist_Len = 0;
+   }
+   else if(num_in >= Max_Order-1){
+      Hist_Len = Max_Order-1;
+      for(is=0; is<Hist_Len; is++) Stitch[is] = symbs[num_in-Hist_Len+is];
+   }
+   else{
+      keep = Hist_Len + num_in;
+      if(keep > Max_Order-1) keep = Max_Order-1;
+      memmove(Stitch, Stitch + Hist_Len + num_in - keep, keep*sizeof(byte_t));
+      Hist_Len = keep;
+   }
+}
+//======================================================
+void NgramStats::MergePartials(void)
+{
+   for(int it=1; it<Num_Threads; it++){
+      Partials[0]->Merge(Partials[it]);
+      Partials[it]->Reset();
+   }
+}
+//======================================================
+void NgramStats::GetCounts( int order, long long *counts )
+{
+   if(order < 1 || order > Max_Order){
+      ErrorStream << "Error: n-gram order " << order << " not counted" << endl;
+      exit(-1);
+   }
+   MergePartials();
+   Partials[0]->GetCounts(order, counts);
+}
+//======================================================
+long long NgramStats::GetGramCount( int order )
+{
+   std::vector<long long> counts(IntPower(Num_Symbs, order));
+   long long total = 0;
+
+   GetCounts(order, &counts[0]);
+   for(int idx=0; idx<int(counts.size()); idx++) total += counts[idx];
+   return(total);
+}
+//======================================================
+//  psi2 = (cells/N) * sum(c*c) - N
+
+double NgramStats::PsiSquare( int order )
+{
+   std::vector<long long> counts(IntPower(Num_Symbs, order));
+   double total, sum_sq;
+   int idx;
+
+   GetCounts(order, &counts[0]);
+   total = 0.0;
+   sum_sq = 0.0;
+   for(idx=0; idx<int(counts.size()); idx++){
+      total += double(counts[idx]);
+      sum_sq += double(counts[idx])*double(counts[idx]);
+   }
+   if(total == 0.0) return(0.0);
+   return(double(counts.size())*sum_sq/total - total);
+}
+//======================================================
+double NgramStats::GetChiSquare( int order, int *deg_freedom )
+{
+   if(order == 1){
+      *deg_freedom = Num_Symbs - 1;
+      return(PsiSquare(1));
+   }
+   *deg_freedom = IntPower(Num_Symbs, order) - IntPower(Num_Symbs, order-1);
+   return(PsiSquare(order) - PsiSquare(order-1));
+}
+//======================================================
+double NgramStats::GetChiSquarePValue( int order )
+{
+   double chi_sq, dof, h_term;
+   int deg_freedom;
+
+   chi_sq = GetChiSquare(order, &deg_freedom);
+   if(deg_freedom < 1) return(1.0);
+   dof = double(deg_freedom);
+   h_term = 2.0/(9.0*dof);
+   return(q_func( (cbrt(chi_sq/dof) - (1.0 - h_term))/sqrt(h_term) ));
+}
+//======================================================
+double NgramStats::GetEntropy( int order )
+{
+   std::vector<long long> counts(IntPower(Num_Symbs, order));
+   double total, entropy, prob;
+   int idx;
+
+   GetCounts(order, &counts[0]);
+   total = 0.0;
+   for(idx=0; idx<int(counts.size()); idx++) total += double(counts[idx]);
+   if(total == 0.0) return(0.0);
+   entropy = 0.0;
+   for(idx=0; idx<int(counts.size()); idx++){
+      if(counts[idx] == 0) continue;
+      prob = double(counts[idx])/total;
+      entropy -= prob*log2(prob);
+   }
+   return(entropy);
+}
+//======================================================
+void NgramStats::Report( const char *instance_name,
+                         int pass_number )
+{
+   std::vector<long long> counts(Num_Symbs*Num_Symbs);
+   double total, entropy, prev_entropy, chi_sq;
+   int i, j, order, deg_freedom;
+
+   GetCounts(1, &counts[0]);
+   total = 0.0;
+   for(i=0; i<Num_Symbs; i++) total += double(counts[i]);
+   if(total == 0.0) return;
+
+   BasicResults << instance_name << ": "
+                << pass_number << "  symbol %'s: "
+                << (counts[0]/total);
+   for(i=1; i<Num_Symbs; i++){
+      BasicResults << ", " << (counts[i]/total);
+   }
+   BasicResults << "\n" << endl;
+
+   if(Max_Order >= 2){
+      GetCounts(2, &counts[0]);
+      total = 0.0;
+      for(i=0; i<Num_Symbs*Num_Symbs; i++) total += double(counts[i]);
+      for(i=0; i<Num_Symbs; i++){
+         BasicResults << (counts[i*Num_Symbs]/total);
+         for(j=1; j<Num_Symbs; j++){
+            BasicResults << ", " << (counts[i*Num_Symbs+j]/total);
+         }
+         BasicResults << "\n" << endl;
+      }
+   }
+
+   prev_entropy = 0.0;
+   for(order=1; order<=Max_Order; order++){
+      chi_sq = GetChiSquare(order, &deg_freedom);
+      entropy = GetEntropy(order);
+      BasicResults << "order " << order << ": "
+                   << double(GetGramCount(order)) << " grams  chi-sq = " << chi_sq
+                   << " (" << deg_freedom << " dof, p = "
+                   << GetChiSquarePValue(order) << ")  entropy = "
+                   << (entropy - prev_entropy) << " of "
+                   << log2(double(Num_Symbs)) << " bits/symb" << endl;
+      prev_entropy = entropy;
+   }
+}
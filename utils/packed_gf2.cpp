@@ -0,0 +1,926 @@
+//
+//  File = packed_gf2.cpp
+//
+
+#include <stdlib.h>
+#include "packed_gf2.h"
+#include "psstream.h"
+
+#if defined(__PCLMUL__) && !defined(_GF2_CLMUL)
+  #define _GF2_CLMUL
+#endif
+#ifdef _GF2_CLMUL
+  #include <wmmintrin.h>
+#endif
+
+extern PracSimStream ErrorStream;
+
+#define GF2_MAX_ORDER_FACTORS 32
+
+//======================================================
+void ClMulWord( gf2_word_t a,
+                gf2_word_t b,
+                gf2_word_t *prod_lo,
+                gf2_word_t *prod_hi )
+{
+#ifdef _GF2_CLMUL
+   __m128i prod = _mm_clmulepi64_si128( _mm_cvtsi64_si128((long long)a),
+                                        _mm_cvtsi64_si128((long long)b),
+                                        0 );
+   *prod_lo = (gf2_word_t)_mm_cvtsi128_si64(prod);
+   *prod_hi = (gf2_word_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(prod, prod));
+#else
+   gf2_word_t tab[16];
+   gf2_word_t lo, hi, part;
+   int i;
+
+   // tab[d] = a*d, less the bits shifted out past bit 63
+   tab[0] = 0;
+   tab[1] = a;
+   for(i=2; i<16; i+=2){
+      tab[i] = tab[i/2] << 1;
+      tab[i+1] = tab[i] ^ a;
+   }
+   lo = tab[b & 15];
+   hi = 0;
+   for(i=4; i<GF2_WORD_BITS; i+=4){
+      part = tab[(b >> i) & 15];
+      lo ^= part << i;
+      hi ^= part >> (GF2_WORD_BITS-i);
+   }
+
+   // restore the products of the top 3 bits of a that the
+   // table entries dropped
+   hi ^= ((b & 0xeeeeeeeeeeeeeeeeULL) >> 1) & (0 - ((a >> 63) & 1));
+   hi ^= ((b & 0xccccccccccccccccULL) >> 2) & (0 - ((a >> 62) & 1));
+   hi ^= ((b & 0x8888888888888888ULL) >> 3) & (0 - ((a >> 61) & 1));
+   *prod_lo = lo;
+   *prod_hi = hi;
+#endif
+}
+//======================================================
+static int HighBit( gf2_word_t word )
+{
+   int bit = 0;
+   if(word >> 32){ bit += 32; word >>= 32; }
+   if(word >> 16){ bit += 16; word >>= 16; }
+   if(word >> 8){ bit += 8; word >>= 8; }
+   if(word >> 4){ bit += 4; word >>= 4; }
+   if(word >> 2){ bit += 2; word >>= 2; }
+   if(word >> 1){ bit += 1; }
+   return(bit);
+}
+//======================================================
+static int LowBit( gf2_word_t word )
+{
+   int bit = 0;
+   while((word & 1) == 0){
+      word >>= 1;
+      bit++;
+   }
+   return(bit);
+}
+//======================================================
+static int PopCount( gf2_word_t word )
+{
+   word = word - ((word >> 1) & 0x5555555555555555ULL);
+   word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+   word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+   return(int((word * 0x0101010101010101ULL) >> 56));
+}
+//======================================================
+//  dest ^= src * x**shift; dest must have room for the
+//  shifted source
+
+static void XorShifted( gf2_word_t *dest,
+                        const gf2_word_t *src,
+                        int src_words,
+                        int shift )
+{
+   int word_off = shift / GF2_WORD_BITS;
+   int bit_off = shift % GF2_WORD_BITS;
+   int j;
+
+   dest += word_off;
+   if(bit_off == 0){
+      for(j=0; j<src_words; j++) dest[j] ^= src[j];
+      return;
+   }
+   for(j=0; j<src_words; j++){
+      dest[j] ^= src[j] << bit_off;
+      dest[j+1] ^= src[j] >> (GF2_WORD_BITS-bit_off);
+   }
+}
+
+//======================================================
+//  Single-word modulus arithmetic, used when the modulus
+//  has degree 63 or less.  mod_bits includes the leading
+//  term.
+
+static gf2_word_t MulModWord( gf2_word_t a,
+                              gf2_word_t b,
+                              gf2_word_t mod_bits,
+                              int mod_deg )
+{
+   gf2_word_t lo, hi;
+   int i, shift;
+
+   ClMulWord(a, b, &lo, &hi);
+   for(i=2*mod_deg-2; i>=mod_deg; i--){
+      if( ((i >= GF2_WORD_BITS) ? (hi >> (i-GF2_WORD_BITS)) : (lo >> i)) & 1 ){
+         shift = i - mod_deg;
+         lo ^= mod_bits << shift;
+         if(shift > 0) hi ^= mod_bits >> (GF2_WORD_BITS-shift);
+      }
+   }
+   return(lo);
+}
+//======================================================
+static gf2_word_t TimesXModWord( gf2_word_t a,
+                                 gf2_word_t mod_bits,
+                                 int mod_deg )
+{
+   a <<= 1;
+   if((a >> mod_deg) & 1) a ^= mod_bits;
+   return(a);
+}
+//======================================================
+static gf2_word_t PowerOfXModWord( unsigned long long exponent,
+                                   gf2_word_t mod_bits,
+                                   int mod_deg )
+{
+   gf2_word_t result = 1;
+   int bit;
+
+   if(mod_deg == 0) return(0);
+   if(exponent == 0) return(1);
+   for(bit=HighBit(exponent); bit>=0; bit--){
+      result = MulModWord(result, result, mod_bits, mod_deg);
+      if((exponent >> bit) & 1) result = TimesXModWord(result, mod_bits, mod_deg);
+   }
+   return(result);
+}
+
+//======================================================
+//  constructors
+
+PackedPolyOvrGF2::PackedPolyOvrGF2(void)
+{
+   Degree = -1;
+   Words.assign(1, 0);
+}
+//======================================================
+PackedPolyOvrGF2::PackedPolyOvrGF2( gf2_word_t coeff_bits )
+{
+   Words.assign(1, coeff_bits);
+   Normalize();
+}
+//======================================================
+PackedPolyOvrGF2 PackedPolyOvrGF2::Monomial( int degree )
+{
+   PackedPolyOvrGF2 result;
+   result.Words.assign(degree/GF2_WORD_BITS + 1, 0);
+   result.Words[degree/GF2_WORD_BITS] = 1ULL << (degree%GF2_WORD_BITS);
+   result.Degree = degree;
+   return(result);
+}
+//======================================================
+void PackedPolyOvrGF2::Normalize(void)
+{
+   int num_words = int(Words.size());
+   while(num_words > 1 && Words[num_words-1] == 0) num_words--;
+   Words.resize(num_words);
+   if(Words[num_words-1] == 0)
+      Degree = -1;
+   else
+      Degree = (num_words-1)*GF2_WORD_BITS + HighBit(Words[num_words-1]);
+}
+//======================================================
+int PackedPolyOvrGF2::Coefficient( int degree ) const
+{
+   if(degree < 0 || degree > Degree) return(0);
+   return(int((Words[degree/GF2_WORD_BITS] >> (degree%GF2_WORD_BITS)) & 1));
+}
+//======================================================
+void PackedPolyOvrGF2::SetCoefficient( int degree, int value )
+{
+   int word_idx = degree/GF2_WORD_BITS;
+   gf2_word_t mask = 1ULL << (degree%GF2_WORD_BITS);
+
+   if(word_idx >= int(Words.size())){
+      if((value & 1) == 0) return;
+      Words.resize(word_idx+1, 0);
+   }
+   if(value & 1)
+      Words[word_idx] |= mask;
+   else
+      Words[word_idx] &= ~mask;
+   Normalize();
+}
+//======================================================
+int PackedPolyOvrGF2::NumberOfTerms(void) const
+{
+   int num_terms = 0;
+   for(int i=0; i<int(Words.size()); i++) num_terms += PopCount(Words[i]);
+   return(num_terms);
+}
+//======================================================
+int PackedPolyOvrGF2::PenultimateDegree(void) const
+{
+   int i;
+   gf2_word_t word;
+
+   if(Degree <= 0) return(-1);
+   for(i=int(Words.size())-1; i>=0; i--){
+      word = Words[i];
+      if(i == Degree/GF2_WORD_BITS) word &= ~(1ULL << (Degree%GF2_WORD_BITS));
+      if(word != 0) return(i*GF2_WORD_BITS + HighBit(word));
+   }
+   return(-1);
+}
+//======================================================
+gf2_word_t PackedPolyOvrGF2::LowWord(void) const
+{
+   return(Words[0]);
+}
+//======================================================
+PackedPolyOvrGF2 PackedPolyOvrGF2::operator+ ( const PackedPolyOvrGF2 &right ) const
+{
+   PackedPolyOvrGF2 result = *this;
+   result += right;
+   return(result);
+}
+//======================================================
+PackedPolyOvrGF2& PackedPolyOvrGF2::operator+= ( const PackedPolyOvrGF2 &right )
+{
+   if(right.Words.size() > Words.size()) Words.resize(right.Words.size(), 0);
+   for(int i=0; i<int(right.Words.size()); i++) Words[i] ^= right.Words[i];
+   Normalize();
+   return(*this);
+}
+//======================================================
+PackedPolyOvrGF2 PackedPolyOvrGF2::operator* ( const PackedPolyOvrGF2 &right ) const
+{
+   PackedPolyOvrGF2 result;
+   gf2_word_t lo, hi;
+   int i, j;
+   int num_left = int(Words.size());
+   int num_right = int(right.Words.size());
+
+   if(IsZero() || right.IsZero()) return(result);
+   result.Words.assign(num_left + num_right, 0);
+   for(i=0; i<num_left; i++){
+      if(Words[i] == 0) continue;
+      for(j=0; j<num_right; j++){
+         ClMulWord(Words[i], right.Words[j], &lo, &hi);
+         result.Words[i+j] ^= lo;
+         result.Words[i+j+1] ^= hi;
+      }
+   }
+   result.Normalize();
+   return(result);
+}
+//======================================================
+PackedPolyOvrGF2& PackedPolyOvrGF2::operator*= ( const PackedPolyOvrGF2 &right )
+{
+   *this = (*this) * right;
+   return(*this);
+}
+//======================================================
+PackedPolyOvrGF2 PackedPolyOvrGF2::operator/ ( const PackedPolyOvrGF2 &divisor ) const
+{
+   PackedPolyOvrGF2 quotient;
+   DivMod(divisor, &quotient, NULL);
+   return(quotient);
+}
+//======================================================
+PackedPolyOvrGF2 PackedPolyOvrGF2::operator% ( const PackedPolyOvrGF2 &divisor ) const
+{
+   PackedPolyOvrGF2 remainder;
+   DivMod(divisor, NULL, &remainder);
+   return(remainder);
+}
+//======================================================
+bool PackedPolyOvrGF2::operator== ( const PackedPolyOvrGF2 &right ) const
+{
+   return(Degree == right.Degree && Words == right.Words);
+}
+//======================================================
+bool PackedPolyOvrGF2::operator!= ( const PackedPolyOvrGF2 &right ) const
+{
+   return(!(*this == right));
+}
+//======================================================
+PackedPolyOvrGF2 PackedPolyOvrGF2::ShiftUp( int shift ) const
+{
+   PackedPolyOvrGF2 result;
+   if(IsZero()) return(result);
+   result.Words.assign((Degree+shift)/GF2_WORD_BITS + 2, 0);
+   XorShifted(&result.Words[0], &Words[0], int(Words.size()), shift);
+   result.Normalize();
+   return(result);
+}
+//======================================================
+//  Long division with the divisor subtracted a word at a
+//  time at each surviving leading term.  Single-word
+//  divisors and dividends take a shortcut through the
+//  word arithmetic.
+
+void PackedPolyOvrGF2::DivMod( const PackedPolyOvrGF2 &divisor,
+                               PackedPolyOvrGF2 *quotient,
+                               PackedPolyOvrGF2 *remainder ) const
+{
+   vector<gf2_word_t> rem_words;
+   vector<gf2_word_t> quot_words;
+   int div_deg = divisor.Degree;
+   int div_words = int(divisor.Words.size());
+   int i;
+
+   if(div_deg < 0){
+      ErrorStream << "Error: division by zero polynomial over GF(2)" << endl;
+      exit(-1);
+   }
+   if(Degree < div_deg){
+      if(quotient != NULL) *quotient = PackedPolyOvrGF2();
+      if(remainder != NULL) *remainder = *this;
+      return;
+   }
+   rem_words = Words;
+   rem_words.push_back(0);
+   quot_words.assign((Degree-div_deg)/GF2_WORD_BITS + 1, 0);
+
+   for(i=Degree; i>=div_deg; i--){
+      if((rem_words[i/GF2_WORD_BITS] >> (i%GF2_WORD_BITS)) & 1){
+         XorShifted(&rem_words[0], &divisor.Words[0], div_words, i-div_deg);
+         quot_words[(i-div_deg)/GF2_WORD_BITS] |= 1ULL << ((i-div_deg)%GF2_WORD_BITS);
+      }
+   }
+   if(quotient != NULL){
+      quotient->Words = quot_words;
+      quotient->Normalize();
+   }
+   if(remainder != NULL){
+      remainder->Words = rem_words;
+      remainder->Normalize();
+   }
+}
+//======================================================
+PackedPolyOvrGF2 PackedPolyOvrGF2::Square(void) const
+{
+   PackedPolyOvrGF2 result;
+   int num_words = int(Words.size());
+
+   if(IsZero()) return(result);
+   result.Words.assign(2*num_words, 0);
+   for(int i=0; i<num_words; i++){
+      ClMulWord(Words[i], Words[i], &result.Words[2*i], &result.Words[2*i+1]);
+   }
+   result.Normalize();
+   return(result);
+}
+//======================================================
+//  over GF(2) only the odd-power terms survive
+
+PackedPolyOvrGF2 PackedPolyOvrGF2::Derivative(void) const
+{
+   PackedPolyOvrGF2 result = *this;
+   for(int i=0; i<int(result.Words.size()); i++){
+      result.Words[i] = (result.Words[i] & 0xaaaaaaaaaaaaaaaaULL) >> 1;
+   }
+   result.Normalize();
+   return(result);
+}
+//======================================================
+void PackedPolyOvrGF2::DumpToStream( ostream* output_stream ) const
+{
+   bool first_term = true;
+   int i;
+
+   if(Degree < 0){
+      (*output_stream) << "0" << endl;
+      return;
+   }
+   for(i=Degree; i>=0; i--){
+      if(!Coefficient(i)) continue;
+      if(!first_term) (*output_stream) << " + ";
+      if(i == 0)
+         (*output_stream) << "1";
+      else if(i == 1)
+         (*output_stream) << "x";
+      else
+         (*output_stream) << "x^" << i;
+      first_term = false;
+   }
+   (*output_stream) << endl;
+}
+
+//======================================================
+PackedPolyOvrGF2 GcdOvrGF2( PackedPolyOvrGF2 poly_a,
+                            PackedPolyOvrGF2 poly_b )
+{
+   PackedPolyOvrGF2 rem;
+   while(!poly_b.IsZero()){
+      rem = poly_a % poly_b;
+      poly_a = poly_b;
+      poly_b = rem;
+   }
+   return(poly_a);
+}
+//======================================================
+PackedPolyOvrGF2 MulModOvrGF2( const PackedPolyOvrGF2 &poly_a,
+                               const PackedPolyOvrGF2 &poly_b,
+                               const PackedPolyOvrGF2 &modulus )
+{
+   int mod_deg = modulus.MaxDegree();
+   if(mod_deg > 0 && mod_deg < GF2_WORD_BITS){
+      gf2_word_t a = (poly_a.MaxDegree() < mod_deg) ? poly_a.LowWord()
+                                                   : (poly_a % modulus).LowWord();
+      gf2_word_t b = (poly_b.MaxDegree() < mod_deg) ? poly_b.LowWord()
+                                                   : (poly_b % modulus).LowWord();
+      return(PackedPolyOvrGF2(MulModWord(a, b, modulus.LowWord(), mod_deg)));
+   }
+   return((poly_a * poly_b) % modulus);
+}
+//======================================================
+PackedPolyOvrGF2 PowerOfXModOvrGF2( unsigned long long exponent,
+                                    const PackedPolyOvrGF2 &modulus )
+{
+   PackedPolyOvrGF2 result(1);
+   int mod_deg = modulus.MaxDegree();
+   int bit;
+
+   if(mod_deg > 0 && mod_deg < GF2_WORD_BITS){
+      return(PackedPolyOvrGF2(PowerOfXModWord(exponent, modulus.LowWord(), mod_deg)));
+   }
+   result = result % modulus;
+   if(exponent == 0) return(result);
+   for(bit=HighBit(exponent); bit>=0; bit--){
+      result = result.Square() % modulus;
+      if((exponent >> bit) & 1) result = result.ShiftUp(1) % modulus;
+   }
+   return(result);
+}
+//======================================================
+//  Rabin's test: poly of degree n is irreducible iff
+//  x**(2**n) = x mod poly and, for each prime r dividing
+//  n, x**(2**(n/r)) - x is prime to poly.
+
+bool IsIrreducibleOvrGF2( const PackedPolyOvrGF2 &poly )
+{
+   PackedPolyOvrGF2 x_poly(2);
+   vector<PackedPolyOvrGF2> x_pow_2k;
+   PackedPolyOvrGF2 term;
+   int deg = poly.MaxDegree();
+   int k, r, rest;
+
+   if(deg < 1) return(false);
+   if(deg == 1) return(true);
+   if(poly.Coefficient(0) == 0) return(false);
+
+   //  x**(2**k) mod poly for k = 0 thru deg
+   term = x_poly % poly;
+   x_pow_2k.push_back(term);
+   for(k=1; k<=deg; k++){
+      term = MulModOvrGF2(term, term, poly);
+      x_pow_2k.push_back(term);
+   }
+   if(x_pow_2k[deg] != x_pow_2k[0]) return(false);
+
+   rest = deg;
+   for(r=2; r<=rest; r++){
+      if(rest % r != 0) continue;
+      while(rest % r == 0) rest /= r;
+      term = x_pow_2k[deg/r] + x_pow_2k[0];
+      if(!GcdOvrGF2(poly, term).IsOne()) return(false);
+   }
+   return(true);
+}
+
+//======================================================
+//  Prime factors of 2**degree - 1 by trial division,
+//  stopping as soon as the cofactor passes a Miller-Rabin
+//  test with bases that are conclusive below 2**64.
+
+static unsigned long long MulModInt( unsigned long long a,
+                                     unsigned long long b,
+                                     unsigned long long n )
+{
+   unsigned long long result = 0;
+   a %= n;
+   while(b != 0){
+      if(b & 1){
+         result = (result >= n-a) ? result-(n-a) : result+a;
+      }
+      a = (a >= n-a) ? a-(n-a) : a+a;
+      b >>= 1;
+   }
+   return(result);
+}
+//======================================================
+static unsigned long long PowModInt( unsigned long long base,
+                                     unsigned long long expon,
+                                     unsigned long long n )
+{
+   unsigned long long result = 1;
+   base %= n;
+   while(expon != 0){
+      if(expon & 1) result = MulModInt(result, base, n);
+      base = MulModInt(base, base, n);
+      expon >>= 1;
+   }
+   return(result);
+}
+//======================================================
+static bool IsPrimeInt( unsigned long long n )
+{
+   static const unsigned long long bases[12] = {2,3,5,7,11,13,17,19,23,29,31,37};
+   unsigned long long d, x;
+   int i, r, s;
+
+   if(n < 2) return(false);
+   for(i=0; i<12; i++){
+      if(n == bases[i]) return(true);
+      if(n % bases[i] == 0) return(false);
+   }
+   d = n-1;
+   s = 0;
+   while((d & 1) == 0){
+      d >>= 1;
+      s++;
+   }
+   for(i=0; i<12; i++){
+      x = PowModInt(bases[i], d, n);
+      if(x == 1 || x == n-1) continue;
+      for(r=1; r<s; r++){
+         x = MulModInt(x, x, n);
+         if(x == n-1) break;
+      }
+      if(r == s) return(false);
+   }
+   return(true);
+}
+//======================================================
+static unsigned long long GcdInt( unsigned long long a,
+                                  unsigned long long b )
+{
+   unsigned long long rem;
+   while(b != 0){
+      rem = a % b;
+      a = b;
+      b = rem;
+   }
+   return(a);
+}
+//======================================================
+//  2**degree - 1 is first split into the pieces it shares
+//  with 2**d - 1 for each proper divisor d of degree.  What
+//  is left over is prime to all of those, so its prime
+//  factors q have 2 of order exactly degree, i.e. degree
+//  divides q-1, and only such q need be tried.
+
+static int FactorGroupOrder( int degree,
+                             unsigned long long *prime_factors )
+{
+   vector<unsigned long long> pieces(1, (1ULL << degree) - 1);
+   unsigned long long sub_order, common, rest, q, step;
+   int num_factors = 0;
+   int d, i, j, num_pieces;
+   bool is_new, rest_is_prime;
+
+   for(d=1; d<degree; d++){
+      if(degree % d != 0) continue;
+      sub_order = (1ULL << d) - 1;
+      num_pieces = int(pieces.size());
+      for(i=0; i<num_pieces; i++){
+         common = GcdInt(pieces[i], sub_order);
+         if(common > 1 && common < pieces[i]){
+            pieces.push_back(pieces[i]/common);
+            pieces[i] = common;
+         }
+      }
+   }
+
+   for(i=0; i<int(pieces.size()); i++){
+      rest = pieces[i];
+      step = 2;
+      for(d=1; d<degree; d++){
+         if(degree % d == 0 && GcdInt(rest, (1ULL << d) - 1) != 1) break;
+      }
+      if(d == degree) step = (degree & 1) ? 2*degree : degree;
+
+      rest_is_prime = IsPrimeInt(rest);
+      for(q=(step == 2) ? 3 : step+1; rest > 1 && !rest_is_prime; q+=step){
+         if(rest % q != 0) continue;
+         while(rest % q == 0) rest /= q;
+         rest_is_prime = IsPrimeInt(rest);
+         pieces.push_back(q);
+      }
+      if(!rest_is_prime) continue;
+
+      is_new = true;
+      for(j=0; j<num_factors; j++){
+         if(prime_factors[j] == rest) is_new = false;
+      }
+      if(is_new) prime_factors[num_factors++] = rest;
+   }
+   return(num_factors);
+}
+//======================================================
+static bool IsPrimitiveWord( gf2_word_t mod_bits,
+                             int mod_deg,
+                             unsigned long long group_order,
+                             const unsigned long long *prime_factors,
+                             int num_factors )
+{
+   if((mod_bits & 1) == 0) return(false);
+   if(PowerOfXModWord(group_order, mod_bits, mod_deg) != 1) return(false);
+   for(int i=0; i<num_factors; i++){
+      if(PowerOfXModWord(group_order/prime_factors[i], mod_bits, mod_deg) == 1)
+         return(false);
+   }
+   return(true);
+}
+//======================================================
+//  If x has order exactly 2**n - 1 modulo poly, poly
+//  divides the square-free x**(2**n - 1) - 1 and cannot
+//  split, since any product of smaller factors gives x a
+//  smaller order; so this also establishes irreducibility.
+
+bool IsPrimitiveOvrGF2( const PackedPolyOvrGF2 &poly )
+{
+   unsigned long long prime_factors[GF2_MAX_ORDER_FACTORS];
+   int deg = poly.MaxDegree();
+   int num_factors;
+
+   if(deg < 1) return(false);
+   if(deg >= GF2_WORD_BITS){
+      ErrorStream << "Error: primitivity test limited to degree "
+                  << GF2_WORD_BITS-1 << endl;
+      exit(-1);
+   }
+   num_factors = FactorGroupOrder(deg, prime_factors);
+   return(IsPrimitiveWord( poly.LowWord(), deg, (1ULL << deg) - 1,
+                           prime_factors, num_factors ));
+}
+//======================================================
+void FindPrimitivePolysOvrGF2( int degree,
+                               int max_count,
+                               vector<PackedPolyOvrGF2> *prim_polys )
+{
+   unsigned long long prime_factors[GF2_MAX_ORDER_FACTORS];
+   unsigned long long group_order;
+   gf2_word_t cand, last_cand;
+   int num_factors;
+
+   prim_polys->clear();
+   if(degree < 1 || degree >= GF2_WORD_BITS){
+      ErrorStream << "Error: primitive polynomial search limited to degree 1 thru "
+                  << GF2_WORD_BITS-1 << endl;
+      exit(-1);
+   }
+   group_order = (1ULL << degree) - 1;
+   num_factors = FactorGroupOrder(degree, prime_factors);
+   last_cand = (1ULL << degree) | group_order;
+
+   for(cand=(1ULL << degree) | 1; ; cand+=2){
+      // an even number of terms means x+1 is a factor
+      if(degree == 1 || (PopCount(cand) & 1)){
+         if(IsPrimitiveWord(cand, degree, group_order, prime_factors, num_factors)){
+            prim_polys->push_back(PackedPolyOvrGF2(cand));
+            if(int(prim_polys->size()) >= max_count) return;
+         }
+      }
+      if(cand == last_cand) return;
+   }
+}
+//======================================================
+//  Trinomials are tried first, then pentanomials, each in
+//  order of increasing penultimate degree.
+
+PackedPolyOvrGF2 FindSimplestPrimitiveOvrGF2( int degree )
+{
+   unsigned long long prime_factors[GF2_MAX_ORDER_FACTORS];
+   unsigned long long group_order;
+   vector<PackedPolyOvrGF2> prim_polys;
+   gf2_word_t lead;
+   int num_factors, a, b, c;
+
+   if(degree < 1 || degree >= GF2_WORD_BITS){
+      ErrorStream << "Error: primitive polynomial search limited to degree 1 thru "
+                  << GF2_WORD_BITS-1 << endl;
+      exit(-1);
+   }
+   if(degree == 1) return(PackedPolyOvrGF2(3));
+
+   group_order = (1ULL << degree) - 1;
+   num_factors = FactorGroupOrder(degree, prime_factors);
+   lead = (1ULL << degree) | 1;
+
+   for(a=1; a<degree; a++){
+      if(IsPrimitiveWord( lead | (1ULL << a), degree, group_order,
+                          prime_factors, num_factors ))
+         return(PackedPolyOvrGF2(lead | (1ULL << a)));
+   }
+   for(a=3; a<degree; a++){
+      for(b=2; b<a; b++){
+         for(c=1; c<b; c++){
+            gf2_word_t cand = lead | (1ULL << a) | (1ULL << b) | (1ULL << c);
+            if(IsPrimitiveWord(cand, degree, group_order, prime_factors, num_factors))
+               return(PackedPolyOvrGF2(cand));
+         }
+      }
+   }
+   FindPrimitivePolysOvrGF2(degree, 1, &prim_polys);
+   return(prim_polys[0]);
+}
+
+//======================================================
+//  Bit-sliced elimination shared by the Berlekamp and
+//  minimal polynomial routines.  Each row holds
+//  num_vec_words words of vector followed by the same
+//  number of words recording which input rows were
+//  combined into it.  Rows are added one at a time and
+//  reduced against the pivots found so far; a row whose
+//  vector part vanishes gives a dependency.
+
+class Gf2RowReducer
+{
+public:
+  Gf2RowReducer( int num_vec_words, int max_rows );
+
+  //  returns true if the row is dependent on those before
+  //  it, in which case comb_row holds the combination
+  bool AddRow( const gf2_word_t *vec_row, vector<gf2_word_t> *comb_row );
+
+private:
+  int Num_Vec_Words;
+  int Num_Comb_Words;
+  int Num_Rows;
+  vector< vector<gf2_word_t> > Pivot_Rows;
+  vector<int> Pivot_Cols;
+};
+
+Gf2RowReducer::Gf2RowReducer( int num_vec_words, int max_rows )
+{
+   Num_Vec_Words = num_vec_words;
+   Num_Comb_Words = (max_rows + GF2_WORD_BITS-1)/GF2_WORD_BITS;
+   Num_Rows = 0;
+}
+
+bool Gf2RowReducer::AddRow( const gf2_word_t *vec_row,
+                            vector<gf2_word_t> *comb_row )
+{
+   vector<gf2_word_t> row(Num_Vec_Words + Num_Comb_Words, 0);
+   int i, j, col;
+
+   for(j=0; j<Num_Vec_Words; j++) row[j] = vec_row[j];
+   row[Num_Vec_Words + Num_Rows/GF2_WORD_BITS] = 1ULL << (Num_Rows%GF2_WORD_BITS);
+   Num_Rows++;
+
+   for(i=0; i<int(Pivot_Rows.size()); i++){
+      col = Pivot_Cols[i];
+      if((row[col/GF2_WORD_BITS] >> (col%GF2_WORD_BITS)) & 1){
+         const gf2_word_t *piv = &Pivot_Rows[i][0];
+         for(j=0; j<int(row.size()); j++) row[j] ^= piv[j];
+      }
+   }
+   for(j=0; j<Num_Vec_Words; j++){
+      if(row[j] != 0){
+         Pivot_Cols.push_back(j*GF2_WORD_BITS + LowBit(row[j]));
+         Pivot_Rows.push_back(row);
+         return(false);
+      }
+   }
+   comb_row->assign(row.begin()+Num_Vec_Words, row.end());
+   return(true);
+}
+//======================================================
+static PackedPolyOvrGF2 PolyFromWords( const vector<gf2_word_t> &words )
+{
+   PackedPolyOvrGF2 result;
+   for(int i=0; i<int(words.size()); i++){
+      gf2_word_t word = words[i];
+      while(word != 0){
+         result.SetCoefficient(i*GF2_WORD_BITS + LowBit(word), 1);
+         word &= word-1;
+      }
+   }
+   return(result);
+}
+//======================================================
+//  Berlekamp's method for a square-free poly of degree n:
+//  the polynomials v with v**2 = v mod poly are the left
+//  null space of Q - I, where row i of Q is x**(2i) mod
+//  poly, and gcd(h, v) splits every reducible factor h
+//  for some basis vector v.
+
+static void BerlekampSplit( const PackedPolyOvrGF2 &poly,
+                            vector<PackedPolyOvrGF2> *factors )
+{
+   int deg = poly.MaxDegree();
+   int num_vec_words = (deg + GF2_WORD_BITS-1)/GF2_WORD_BITS;
+   vector<gf2_word_t> vec_row(num_vec_words);
+   vector<gf2_word_t> comb_row;
+   vector<PackedPolyOvrGF2> null_basis;
+   vector<PackedPolyOvrGF2> split;
+   PackedPolyOvrGF2 x_pow, x_sqr, gcd_poly;
+   int i, j, ib, num_before;
+
+   Gf2RowReducer reducer(num_vec_words, deg);
+   x_pow = PackedPolyOvrGF2(1);
+   x_sqr = PackedPolyOvrGF2(4) % poly;
+   for(i=0; i<deg; i++){
+      for(j=0; j<num_vec_words; j++){
+         vec_row[j] = (j < x_pow.GetNumWords()) ? x_pow.GetWords()[j] : 0;
+      }
+      vec_row[i/GF2_WORD_BITS] ^= 1ULL << (i%GF2_WORD_BITS);
+      if(reducer.AddRow(&vec_row[0], &comb_row)){
+         null_basis.push_back(PolyFromWords(comb_row));
+      }
+      x_pow = MulModOvrGF2(x_pow, x_sqr, poly);
+   }
+
+   split.push_back(poly);
+   for(ib=0; ib<int(null_basis.size()) && split.size() < null_basis.size(); ib++){
+      if(null_basis[ib].MaxDegree() < 1) continue;
+      num_before = int(split.size());
+      for(i=0; i<num_before; i++){
+         if(split[i].MaxDegree() < 2) continue;
+         gcd_poly = GcdOvrGF2(split[i], null_basis[ib] % split[i]);
+         if(gcd_poly.MaxDegree() > 0 && gcd_poly.MaxDegree() < split[i].MaxDegree()){
+            split.push_back(split[i] / gcd_poly);
+            split[i] = gcd_poly;
+         }
+      }
+   }
+   for(i=0; i<int(split.size()); i++) factors->push_back(split[i]);
+}
+//======================================================
+//  Repeated factors are stripped off first: a zero
+//  derivative means poly is a perfect square, otherwise
+//  gcd(poly, poly') holds the repeated part.
+
+void FactorOvrGF2( const PackedPolyOvrGF2 &poly,
+                   vector<PackedPolyOvrGF2> *factors )
+{
+   PackedPolyOvrGF2 deriv, root, gcd_poly;
+   vector<PackedPolyOvrGF2> root_factors;
+   int i;
+
+   if(poly.MaxDegree() < 1) return;
+   if(poly.MaxDegree() == 1){
+      factors->push_back(poly);
+      return;
+   }
+   deriv = poly.Derivative();
+   if(deriv.IsZero()){
+      for(i=0; 2*i<=poly.MaxDegree(); i++){
+         if(poly.Coefficient(2*i)) root.SetCoefficient(i, 1);
+      }
+      FactorOvrGF2(root, &root_factors);
+      for(i=0; i<int(root_factors.size()); i++){
+         factors->push_back(root_factors[i]);
+         factors->push_back(root_factors[i]);
+      }
+      return;
+   }
+   gcd_poly = GcdOvrGF2(poly, deriv);
+   if(gcd_poly.MaxDegree() > 0){
+      FactorOvrGF2(gcd_poly, factors);
+      FactorOvrGF2(poly / gcd_poly, factors);
+      return;
+   }
+   BerlekampSplit(poly, factors);
+}
+//======================================================
+//  The first power of beta = alpha**exponent that is a
+//  combination of the lower powers gives the minimal
+//  polynomial's coefficients directly.
+
+PackedPolyOvrGF2 MinimalPolyOvrGF2( const PackedPolyOvrGF2 &prim_poly,
+                                    int exponent )
+{
+   int deg = prim_poly.MaxDegree();
+   int num_vec_words = (deg + GF2_WORD_BITS-1)/GF2_WORD_BITS;
+   vector<gf2_word_t> vec_row(num_vec_words);
+   vector<gf2_word_t> comb_row;
+   PackedPolyOvrGF2 beta, beta_pow;
+   int i, j;
+
+   if(deg < 1){
+      ErrorStream << "Error: minimal polynomial needs a field polynomial of degree 1 or more"
+                  << endl;
+      exit(-1);
+   }
+   Gf2RowReducer reducer(num_vec_words, deg+1);
+   beta = PowerOfXModOvrGF2((unsigned long long)exponent, prim_poly);
+   beta_pow = PackedPolyOvrGF2(1);
+   for(i=0; i<=deg; i++){
+      for(j=0; j<num_vec_words; j++){
+         vec_row[j] = (j < beta_pow.GetNumWords()) ? beta_pow.GetWords()[j] : 0;
+      }
+      if(reducer.AddRow(&vec_row[0], &comb_row)) break;
+      beta_pow = MulModOvrGF2(beta_pow, beta, prim_poly);
+   }
+   return(PolyFromWords(comb_row));
+}
@@ -0,0 +1,357 @@
+//
+//  File = pn_seq.cpp
+//
+
+#include <stdlib.h>
+#include "pn_seq.h"
+#include "packed_gf2.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+static int WordParity( pn_word_t word )
+{
+   word ^= word >> 32;
+   word ^= word >> 16;
+   word ^= word >> 8;
+   word ^= word >> 4;
+   word ^= word >> 2;
+   word ^= word >> 1;
+   return(int(word & 1));
+}
+//======================================================
+static int WordPopCount( pn_word_t word )
+{
+   word = word - ((word >> 1) & 0x5555555555555555ULL);
+   word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+   word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+   return(int((word * 0x0101010101010101ULL) >> 56));
+}
+//======================================================
+pn_word_t PnFeedbackTaps( PN_POLY_T pn_poly, int *degree )
+{
+   PackedPolyOvrGF2 prim_poly;
+   pn_word_t fb_taps;
+   int j;
+
+   switch(pn_poly){
+   case PN_POLY_PRBS7:
+      *degree = 7;
+      return((1ULL<<6) | (1ULL<<5));
+   case PN_POLY_PRBS15:
+      *degree = 15;
+      return((1ULL<<14) | (1ULL<<13));
+   case PN_POLY_PRBS23:
+      *degree = 23;
+      return((1ULL<<22) | (1ULL<<17));
+   case PN_POLY_PRBS31:
+      *degree = 31;
+      return((1ULL<<30) | (1ULL<<27));
+   case PN_POLY_CUSTOM:
+      ErrorStream << "Error: taps for PN_POLY_CUSTOM must be given directly" << endl;
+      exit(-1);
+   default:
+      break;
+   }
+   if(*degree < 2 || *degree > PN_MAX_DEGREE){
+      ErrorStream << "Error: PN polynomial degree must be 2 thru "
+                  << PN_MAX_DEGREE << endl;
+      exit(-1);
+   }
+   prim_poly = FindSimplestPrimitiveOvrGF2(*degree);
+   fb_taps = 0;
+   for(j=1; j<=*degree; j++){
+      if(prim_poly.Coefficient(j)) fb_taps |= 1ULL<<(j-1);
+   }
+   return(fb_taps);
+}
+//======================================================
+pn_word_t PnCustomTaps( pn_word_t fb_taps, int *degree )
+{
+   int deg = 0;
+
+   while(deg < PN_WORD_BITS && (fb_taps >> deg) != 0) deg++;
+   if(deg < 2 || deg > PN_MAX_DEGREE){
+      ErrorStream << "Error: PN feedback taps must give degree 2 thru "
+                  << PN_MAX_DEGREE << endl;
+      exit(-1);
+   }
+   *degree = deg;
+   return(fb_taps);
+}
+
+//======================================================
+//  constructor
+
+PnSequence::PnSequence( int degree, pn_word_t fb_taps )
+{
+   pn_word_t basis_out[PN_MAX_DEGREE];
+   pn_word_t state, word;
+   int i, j, ib, iv, low_bit;
+
+   if(degree < 2 || degree > PN_MAX_DEGREE){
+      ErrorStream << "Error: PN sequence degree must be 2 thru "
+                  << PN_MAX_DEGREE << endl;
+      exit(-1);
+   }
+   Degree = degree;
+   State_Mask = (1ULL<<Degree) - 1;
+   if( (fb_taps & ~State_Mask) != 0 || ((fb_taps >> (Degree-1)) & 1) == 0 ){
+      ErrorStream << "Error: PN feedback taps do not match degree "
+                  << Degree << endl;
+      exit(-1);
+   }
+
+   // tap x**j uses s[n-j], which is state bit Degree-j
+   Fb_Mask = 0;
+   for(j=1; j<=Degree; j++){
+      if((fb_taps >> (j-1)) & 1) Fb_Mask |= 1ULL<<(Degree-j);
+   }
+
+   // output word produced from each single-bit state
+   for(i=0; i<Degree; i++){
+      state = 1ULL<<i;
+      word = 0;
+      for(j=0; j<PN_WORD_BITS; j++){
+         state = StepBit(state);
+         word |= (state >> (Degree-1)) << j;
+      }
+      basis_out[i] = word;
+   }
+
+   // by linearity, each table entry is the sum of the basis
+   // words for the bits set in that state byte
+   Num_State_Bytes = (Degree+7)/8;
+   for(ib=0; ib<Num_State_Bytes; ib++){
+      Out_Table[ib][0] = 0;
+      for(iv=1; iv<256; iv++){
+         low_bit = 0;
+         while(((iv >> low_bit) & 1) == 0) low_bit++;
+         word = 0;
+         if(8*ib + low_bit < Degree) word = basis_out[8*ib + low_bit];
+         Out_Table[ib][iv] = Out_Table[ib][iv & (iv-1)] ^ word;
+      }
+   }
+   SetState(State_Mask);
+}
+//======================================================
+void PnSequence::SetState( pn_word_t state )
+{
+   State = state & State_Mask;
+   if(State == 0){
+      ErrorStream << "Error: PN sequence state must be nonzero" << endl;
+      exit(-1);
+   }
+   Pending_Word = 0;
+   Pending_Bits = 0;
+}
+//======================================================
+pn_word_t PnSequence::StepBit( pn_word_t state )
+{
+   pn_word_t new_bit = WordParity(state & Fb_Mask);
+   return((state >> 1) | (new_bit << (Degree-1)));
+}
+//======================================================
+//  After a full word the state is simply the last Degree
+//  bits of that word.
+
+pn_word_t PnSequence::NextWord(void)
+{
+   pn_word_t state = State;
+   pn_word_t word = Out_Table[0][state & 0xff];
+   for(int ib=1; ib<Num_State_Bytes; ib++){
+      state >>= 8;
+      word ^= Out_Table[ib][state & 0xff];
+   }
+   State = word >> (PN_WORD_BITS-Degree);
+   return(word);
+}
+//======================================================
+void PnSequence::GenerateWords( pn_word_t *words_out,
+                                int num_words )
+{
+   pn_word_t word;
+   int iw;
+
+   if(Pending_Bits == PN_WORD_BITS && num_words > 0){
+      *words_out++ = Pending_Word;
+      Pending_Bits = 0;
+      num_words--;
+   }
+   if(Pending_Bits == 0){
+      for(iw=0; iw<num_words; iw++) words_out[iw] = NextWord();
+      return;
+   }
+   for(iw=0; iw<num_words; iw++){
+      word = NextWord();
+      words_out[iw] = Pending_Word | (word << Pending_Bits);
+      Pending_Word = word >> (PN_WORD_BITS-Pending_Bits);
+   }
+}
+//======================================================
+void PnSequence::GenerateBits( bit_t *bits_out,
+                               int num_bits )
+{
+   pn_word_t word;
+   int is, num_now;
+
+   while(num_bits > 0){
+      if(Pending_Bits == 0){
+         Pending_Word = NextWord();
+         Pending_Bits = PN_WORD_BITS;
+      }
+      num_now = (num_bits < Pending_Bits) ? num_bits : Pending_Bits;
+      word = Pending_Word;
+      for(is=0; is<num_now; is++){
+         bits_out[is] = bit_t(word & 1);
+         word >>= 1;
+      }
+      bits_out += num_now;
+      num_bits -= num_now;
+      Pending_Bits -= num_now;
+      Pending_Word = (Pending_Bits > 0) ? word : 0;
+   }
+}
+//======================================================
+pn_word_t PnSequence::ApplyMatrix( const pn_word_t *mtx,
+                                   pn_word_t vec )
+{
+   pn_word_t result = 0;
+   for(int i=0; vec != 0; i++, vec >>= 1){
+      if(vec & 1) result ^= mtx[i];
+   }
+   return(result);
+}
+//======================================================
+//  Whole words are skipped by raising the one-word state
+//  transition matrix to the required power by repeated
+//  squaring; column i of that matrix is the state that
+//  follows single-bit state i, which is read straight
+//  from the output table.
+
+void PnSequence::SeekAhead( unsigned long long num_bits )
+{
+   pn_word_t jump_mtx[PN_MAX_DEGREE];
+   pn_word_t sqr_mtx[PN_MAX_DEGREE];
+   unsigned long long num_words;
+   pn_word_t state;
+   int i, rem_bits;
+
+   if(num_bits < (unsigned long long)Pending_Bits){
+      Pending_Word >>= num_bits;
+      Pending_Bits -= int(num_bits);
+      return;
+   }
+   num_bits -= Pending_Bits;
+   Pending_Word = 0;
+   Pending_Bits = 0;
+
+   num_bits %= State_Mask;
+   num_words = num_bits / PN_WORD_BITS;
+   rem_bits = int(num_bits % PN_WORD_BITS);
+
+   for(i=0; i<Degree; i++){
+      jump_mtx[i] = Out_Table[i/8][1<<(i%8)] >> (PN_WORD_BITS-Degree);
+   }
+   state = State;
+   while(num_words > 0){
+      if(num_words & 1) state = ApplyMatrix(jump_mtx, state);
+      num_words >>= 1;
+      if(num_words == 0) break;
+      for(i=0; i<Degree; i++) sqr_mtx[i] = ApplyMatrix(jump_mtx, jump_mtx[i]);
+      for(i=0; i<Degree; i++) jump_mtx[i] = sqr_mtx[i];
+   }
+   for(i=0; i<rem_bits; i++) state = StepBit(state);
+   State = state;
+}
+
+//======================================================
+//  constructor
+
+PnSyncChecker::PnSyncChecker( int degree,
+                              pn_word_t fb_taps,
+                              int sync_window_bits,
+                              int max_window_errs )
+             :Ref_Gen(degree, fb_taps)
+{
+   Degree = degree;
+   Sync_Window_Bits = sync_window_bits;
+   Max_Window_Errs = max_window_errs;
+   Reset();
+}
+//======================================================
+void PnSyncChecker::Reset(void)
+{
+   In_Sync = false;
+   Fill_State = 0;
+   Fill_Count = 0;
+   Rcvd_Word = 0;
+   Rcvd_Count = 0;
+   Window_Bits = 0;
+   Window_Errs = 0;
+   Bits_Checked = 0;
+   Error_Count = 0;
+   Num_Sync_Losses = 0;
+}
+//======================================================
+void PnSyncChecker::Check( const bit_t *bits_in,
+                           int num_bits )
+{
+   pn_word_t word;
+   int is, ib, num_now;
+
+   is = 0;
+   while(is < num_bits){
+      if(!In_Sync){
+         // slide received bits into the candidate state
+         Fill_State = (Fill_State >> 1)
+                      | (pn_word_t(bits_in[is] & 1) << (Degree-1));
+         is++;
+         Fill_Count++;
+         if(Fill_Count >= Degree && Fill_State != 0){
+            Ref_Gen.SetState(Fill_State);
+            In_Sync = true;
+            Rcvd_Word = 0;
+            Rcvd_Count = 0;
+            Window_Bits = 0;
+            Window_Errs = 0;
+         }
+         continue;
+      }
+      num_now = num_bits - is;
+      if(num_now > PN_WORD_BITS - Rcvd_Count) num_now = PN_WORD_BITS - Rcvd_Count;
+      word = Rcvd_Word;
+      for(ib=0; ib<num_now; ib++){
+         word |= pn_word_t(bits_in[is+ib] & 1) << (Rcvd_Count+ib);
+      }
+      is += num_now;
+      Rcvd_Count += num_now;
+      Rcvd_Word = word;
+      if(Rcvd_Count == PN_WORD_BITS){
+         CheckWord(Rcvd_Word);
+         Rcvd_Word = 0;
+         Rcvd_Count = 0;
+      }
+   }
+}
+//======================================================
+void PnSyncChecker::CheckWord( pn_word_t rcvd_word )
+{
+   int num_errs = WordPopCount(rcvd_word ^ Ref_Gen.NextWord());
+
+   Window_Bits += PN_WORD_BITS;
+   Window_Errs += num_errs;
+   Bits_Checked += PN_WORD_BITS;
+   Error_Count += num_errs;
+   if(Window_Bits < Sync_Window_Bits) return;
+
+   if(Window_Errs > Max_Window_Errs){
+      Num_Sync_Losses++;
+      In_Sync = false;
+      Fill_State = 0;
+      Fill_Count = 0;
+   }
+   Window_Bits = 0;
+   Window_Errs = 0;
+}
@@ -0,0 +1,167 @@
+//
+//  File = rs_codec.cpp
+//
+
+#include <stdlib.h>
+#include "rs_codec.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+ReedSolomonCodec::ReedSolomonCodec( Gf2mField *field,
+                                    int code_len,
+                                    int msg_len,
+                                    int first_root )
+{
+   gf_elem_t *gen_asc, root;
+   int i, j;
+
+   Field = field;
+   Code_Len = code_len;
+   Msg_Len = msg_len;
+   First_Root = first_root;
+   Num_Parity = Code_Len - Msg_Len;
+   Max_Corr = Num_Parity/2;
+   if(Code_Len > Field->GetOrder() || Msg_Len < 1 || Num_Parity < 2){
+      ErrorStream << "Error: Reed-Solomon code (" << Code_Len << ","
+                  << Msg_Len << ") not possible over GF(2**"
+                  << Field->GetDegree() << ")" << endl;
+      exit(-1);
+   }
+
+   // g(x) = (x + alpha**b0)(x + alpha**(b0+1)) ...
+   gen_asc = new gf_elem_t[Num_Parity+1];
+   gen_asc[0] = 1;
+   for(i=0; i<Num_Parity; i++){
+      root = Field->Exp(First_Root + i);
+      gen_asc[i+1] = gen_asc[i];
+      for(j=i; j>=1; j--){
+         gen_asc[j] = gen_asc[j-1] ^ Field->Mul(root, gen_asc[j]);
+      }
+      gen_asc[0] = Field->Mul(root, gen_asc[0]);
+   }
+   Gen_Desc = new gf_elem_t[Num_Parity];
+   for(i=0; i<Num_Parity; i++) Gen_Desc[i] = gen_asc[Num_Parity-1-i];
+   delete[] gen_asc;
+
+   Synd_Decoder = new GfSyndromeDecoder( Field, Code_Len,
+                                         Num_Parity, First_Root );
+   Parity_Reg.resize(Num_Parity+1);
+   Locator.resize(Max_Corr+1);
+   Evaluator.resize(Num_Parity);
+   Err_Pos.resize(Max_Corr+1);
+   Err_Val.resize(Max_Corr+1);
+}
+//======================================================
+ReedSolomonCodec::~ReedSolomonCodec(void)
+{
+   delete[] Gen_Desc;
+   delete Synd_Decoder;
+}
+//======================================================
+//  Division LFSR: each message symbol is fed back through
+//  the generator as one vector multiply-accumulate.
+
+void ReedSolomonCodec::Encode( const gf_elem_t *msg,
+                               gf_elem_t *codeword )
+{
+   gf_elem_t *reg = &Parity_Reg[0];
+   gf_elem_t feedback;
+   int is, d;
+
+   for(d=0; d<=Num_Parity; d++) reg[d] = 0;
+   for(is=0; is<Msg_Len; is++){
+      feedback = msg[is] ^ reg[0];
+      for(d=0; d<Num_Parity; d++) reg[d] = reg[d+1];
+      Field->MulAccumVector(feedback, Gen_Desc, reg, Num_Parity);
+      codeword[is] = msg[is];
+   }
+   for(d=0; d<Num_Parity; d++) codeword[Msg_Len+d] = reg[d];
+}
+//======================================================
+void ReedSolomonCodec::EncodeBlock( const gf_elem_t *msgs,
+                                    gf_elem_t *codewords,
+                                    int num_cws )
+{
+   for(int iw=0; iw<num_cws; iw++){
+      Encode(msgs + iw*Msg_Len, codewords + iw*Code_Len);
+   }
+}
+//======================================================
+//  Syndromes for the whole block are formed first; only
+//  codewords with a nonzero syndrome go on to the
+//  Berlekamp-Massey, Chien and Forney steps.
+
+void ReedSolomonCodec::DecodeBlock( gf_elem_t *codewords,
+                                    int num_cws,
+                                    int *num_corr )
+{
+   gf_elem_t *synd, *locator, *evaluator, *cw;
+   gf_elem_t x_inv, num, den, x_pow;
+   int iw, num_errs, i, j, k, pos;
+   bool all_zero;
+
+   if(int(Synd_Buf.size()) < num_cws*Num_Parity) Synd_Buf.resize(num_cws*Num_Parity);
+   Synd_Decoder->ComputeSyndromes(codewords, num_cws, &Synd_Buf[0]);
+   locator = &Locator[0];
+   evaluator = &Evaluator[0];
+
+   for(iw=0; iw<num_cws; iw++){
+      synd = &Synd_Buf[iw*Num_Parity];
+      all_zero = true;
+      for(j=0; j<Num_Parity; j++){
+         if(synd[j] != 0){
+            all_zero = false;
+            break;
+         }
+      }
+      num_corr[iw] = 0;
+      if(all_zero) continue;
+
+      num_errs = Synd_Decoder->FindErrorLocator(synd, locator);
+      if(num_errs > 0){
+         num_errs = Synd_Decoder->FindErrorPositions(locator, num_errs, &Err_Pos[0]);
+      }
+      if(num_errs <= 0){
+         num_corr[iw] = -1;
+         continue;
+      }
+
+      // error evaluator S(x)*L(x) mod x**(n-k)
+      for(j=0; j<Num_Parity; j++){
+         evaluator[j] = 0;
+         for(i=0; i<=j && i<=num_errs; i++){
+            evaluator[j] ^= Field->Mul(locator[i], synd[j-i]);
+         }
+      }
+
+      // Forney:  e = X**(1-b0) * Omega(1/X) / L'(1/X)
+      for(k=0; k<num_errs; k++){
+         pos = Err_Pos[k];
+         x_inv = Field->Exp(-pos);
+         num = 0;
+         x_pow = 1;
+         for(j=0; j<Num_Parity; j++){
+            num ^= Field->Mul(evaluator[j], x_pow);
+            x_pow = Field->Mul(x_pow, x_inv);
+         }
+         den = 0;
+         for(j=1; j<=num_errs; j+=2){
+            den ^= Field->Mul(locator[j], Field->Power(x_inv, j-1));
+         }
+         if(den == 0) break;
+         Err_Val[k] = Field->Mul( Field->Div(num, den),
+                                  Field->Exp(pos*(1-First_Root)) );
+      }
+      if(k < num_errs){
+         num_corr[iw] = -1;
+         continue;
+      }
+      cw = codewords + iw*Code_Len;
+      for(k=0; k<num_errs; k++) cw[Code_Len-1-Err_Pos[k]] ^= Err_Val[k];
+      num_corr[iw] = num_errs;
+   }
+}
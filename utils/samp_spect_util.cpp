@@ -39,6 +39,6 @@ void SampleSpectrum<T>::Calculate(  T* time_signal )
    }
    return;
 }
-template SampleSpectrum<float>;
-template SampleSpectrum< std::complex<float> >;
+template class SampleSpectrum<float>;
+template class SampleSpectrum< std::complex<float> >;
 
@@ -0,0 +1,130 @@
+//
+//  File = scrambler_krnl.cpp
+//
+
+#include <stdlib.h>
+#include "scrambler_krnl.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+
+//======================================================
+//  constructor
+
+AdditiveScrambler::AdditiveScrambler( int degree,
+                                      pn_word_t fb_taps,
+                                      pn_word_t init_state )
+                  :Pn_Gen(degree, fb_taps)
+{
+   Pn_Gen.SetState(init_state);
+   Pn_Bits_Left = 0;
+   Pn_Word = 0;
+}
+//======================================================
+void AdditiveScrambler::Process( const bit_t *bits_in,
+                                 bit_t *bits_out,
+                                 int num_bits )
+{
+   for(int is=0; is<num_bits; is++){
+      if(Pn_Bits_Left == 0){
+         Pn_Word = Pn_Gen.NextWord();
+         Pn_Bits_Left = PN_WORD_BITS;
+      }
+      bits_out[is] = (bits_in[is] & 1) ^ bit_t(Pn_Word & 1);
+      Pn_Word >>= 1;
+      Pn_Bits_Left--;
+   }
+}
+
+//======================================================
+//  constructor
+
+MultiplicativeScrambler::MultiplicativeScrambler( int degree,
+                                                  pn_word_t fb_taps,
+                                                  bool descramble )
+{
+   int j;
+
+   if(degree < 2 || degree > PN_MAX_DEGREE ||
+      (fb_taps >> (degree-1)) != 1){
+      ErrorStream << "Error: scrambler taps do not match degree "
+                  << degree << endl;
+      exit(-1);
+   }
+   Degree = degree;
+   Descramble = descramble;
+   for(j=1; j<=Degree; j++){
+      if((fb_taps >> (j-1)) & 1) Tap_Delays.push_back(j);
+   }
+   Chunk_Bits = Descramble ? PN_WORD_BITS : Tap_Delays[0];
+
+   // register starts cleared
+   Packed_Hist.assign(1, 0);
+}
+//======================================================
+//  num_bits (at most 64) bits of the packed stream
+//  starting at bit_pos
+
+pn_word_t MultiplicativeScrambler::ExtractBits( int bit_pos, int num_bits )
+{
+   int w_idx = bit_pos/PN_WORD_BITS;
+   int b_idx = bit_pos%PN_WORD_BITS;
+   pn_word_t bits = Packed_Hist[w_idx] >> b_idx;
+
+   if(b_idx != 0 && b_idx + num_bits > PN_WORD_BITS){
+      bits |= Packed_Hist[w_idx+1] << (PN_WORD_BITS - b_idx);
+   }
+   if(num_bits < PN_WORD_BITS) bits &= (pn_word_t(1) << num_bits) - 1;
+   return(bits);
+}
+//======================================================
+void MultiplicativeScrambler::Process( const bit_t *bits_in,
+                                       bit_t *bits_out,
+                                       int num_bits )
+{
+   int total_bits = Degree + num_bits;
+   int num_words = (total_bits + PN_WORD_BITS-1)/PN_WORD_BITS + 1;
+   int is, ib, it, pos, chunk_len, w_idx, b_idx;
+   pn_word_t chunk, fb;
+
+   // word 0 holds the Degree (< 64) history bits
+   Packed_Hist.resize(num_words);
+   Packed_Hist[0] &= (pn_word_t(1) << Degree) - 1;
+   for(is=1; is<num_words; is++) Packed_Hist[is] = 0;
+
+   // the descrambler's input is the scrambled stream
+   if(Descramble){
+      for(is=0; is<num_bits; is++){
+         pos = Degree + is;
+         Packed_Hist[pos/PN_WORD_BITS] |= pn_word_t(bits_in[is] & 1) << (pos%PN_WORD_BITS);
+      }
+   }
+
+   for(is=0; is<num_bits; is+=chunk_len){
+      chunk_len = num_bits - is;
+      if(chunk_len > Chunk_Bits) chunk_len = Chunk_Bits;
+      pos = Degree + is;
+
+      fb = 0;
+      for(it=0; it<int(Tap_Delays.size()); it++){
+         fb ^= ExtractBits(pos - Tap_Delays[it], chunk_len);
+      }
+      if(Descramble){
+         chunk = ExtractBits(pos, chunk_len) ^ fb;
+      }
+      else{
+         chunk = fb;
+         for(ib=0; ib<chunk_len; ib++) chunk ^= pn_word_t(bits_in[is+ib] & 1) << ib;
+         w_idx = pos/PN_WORD_BITS;
+         b_idx = pos%PN_WORD_BITS;
+         Packed_Hist[w_idx] |= chunk << b_idx;
+         if(b_idx != 0 && b_idx + chunk_len > PN_WORD_BITS){
+            Packed_Hist[w_idx+1] |= chunk >> (PN_WORD_BITS - b_idx);
+         }
+      }
+      for(ib=0; ib<chunk_len; ib++) bits_out[is+ib] = bit_t((chunk >> ib) & 1);
+   }
+
+   // keep the last Degree scrambled bits for the next call
+   Packed_Hist[0] = ExtractBits(num_bits, Degree);
+}
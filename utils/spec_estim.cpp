@@ -33,6 +33,6 @@ void SpectrumEstimator<T>::GetEstimate(  double* psd_estimate )
    }
    return;
 }
-template SpectrumEstimator<std::complex<float> >;
-template SpectrumEstimator<float>;
+template class SpectrumEstimator<std::complex<float> >;
+template class SpectrumEstimator<float>;
 
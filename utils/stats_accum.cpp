@@ -0,0 +1,245 @@
+//
+//  File = stats_accum.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include "stats_accum.h"
+
+//======================================================
+//  constructor
+
+StatsAccumulator::StatsAccumulator( int num_bins,
+                                    double left_edge,
+                                    double bin_width,
+                                    bool higher_moments_enab )
+{
+   Num_Bins = num_bins;
+   Num_Slots = Num_Bins + 2;
+   Left_Edge = left_edge;
+   Bin_Width = bin_width;
+   Inv_Bin_Width = 1.0/bin_width;
+   Higher_Moments_Enab = higher_moments_enab;
+
+   Lane_Counts = new long long[STATS_ACCUM_LANES * Num_Slots];
+   Reset();
+}
+//======================================================
+StatsAccumulator::~StatsAccumulator(void)
+{
+   delete[] Lane_Counts;
+}
+//======================================================
+void StatsAccumulator::Reset(void)
+{
+   for(int i=0; i<STATS_ACCUM_LANES*Num_Slots; i++){
+      Lane_Counts[i] = 0;
+   }
+   Count = 0;
+   Mean = 0.0;
+   M2 = 0.0;
+   M3 = 0.0;
+   M4 = 0.0;
+   Min_Val = DBL_MAX;
+   Max_Val = -DBL_MAX;
+}
+//======================================================
+void StatsAccumulator::Tally( const float *samps,
+                              int num_samps )
+{
+   TallyBlock(samps, num_samps);
+}
+//======================================================
+void StatsAccumulator::Tally( const double *samps,
+                              int num_samps )
+{
+   TallyBlock(samps, num_samps);
+}
+//======================================================
+template <class S>
+void StatsAccumulator::TallyBlock( const S *samps,
+                                   int num_samps )
+{
+   int is, lane;
+   double pos, max_pos, val;
+   double blk_sum, blk_mean, dev, dev_sq;
+   double blk_m2, blk_m3, blk_m4;
+   double blk_min, blk_max;
+   long long *lane_base[STATS_ACCUM_LANES];
+
+   if(num_samps <= 0) return;
+
+   for(lane=0; lane<STATS_ACCUM_LANES; lane++){
+      lane_base[lane] = Lane_Counts + lane*Num_Slots;
+   }
+
+   //  histogram: slot = (x - left)/width + 1, clamped to
+   //  [0, Num_Bins+1]; NaN lands in the below-range slot
+   max_pos = double(Num_Bins + 1);
+   blk_sum = 0.0;
+   for(is=0; is<num_samps; is++){
+      val = samps[is];
+      blk_sum += val;
+      pos = (val - Left_Edge) * Inv_Bin_Width + 1.0;
+      pos = (pos > 0.0) ? pos : 0.0;
+      pos = (pos < max_pos) ? pos : max_pos;
+      lane_base[is & (STATS_ACCUM_LANES-1)][int(pos)]++;
+   }
+
+   //  central moments of this block about its own mean
+   blk_mean = blk_sum/num_samps;
+   blk_m2 = 0.0;
+   blk_m3 = 0.0;
+   blk_m4 = 0.0;
+   blk_min = samps[0];
+   blk_max = samps[0];
+   if(Higher_Moments_Enab){
+      for(is=0; is<num_samps; is++){
+         val = samps[is];
+         dev = val - blk_mean;
+         dev_sq = dev*dev;
+         blk_m2 += dev_sq;
+         blk_m3 += dev_sq*dev;
+         blk_m4 += dev_sq*dev_sq;
+         blk_min = (val < blk_min) ? val : blk_min;
+         blk_max = (val > blk_max) ? val : blk_max;
+      }
+   }
+   else{
+      for(is=0; is<num_samps; is++){
+         val = samps[is];
+         dev = val - blk_mean;
+         blk_m2 += dev*dev;
+         blk_min = (val < blk_min) ? val : blk_min;
+         blk_max = (val > blk_max) ? val : blk_max;
+      }
+   }
+   if(blk_min < Min_Val) Min_Val = blk_min;
+   if(blk_max > Max_Val) Max_Val = blk_max;
+
+   MergeMoments(num_samps, blk_mean, blk_m2, blk_m3, blk_m4);
+}
+//======================================================
+//  pairwise combination of count, mean and central
+//  moment sums (Chan et al. for M2, Pebay for M3, M4)
+
+void StatsAccumulator::MergeMoments( long long count_b,
+                                     double mean_b,
+                                     double m2_b,
+                                     double m3_b,
+                                     double m4_b )
+{
+   double n_a, n_b, n, delta, delta_n, delta_n_sq, term;
+
+   if(count_b == 0) return;
+   if(Count == 0){
+      Count = count_b;
+      Mean = mean_b;
+      M2 = m2_b;
+      M3 = m3_b;
+      M4 = m4_b;
+      return;
+   }
+
+   n_a = double(Count);
+   n_b = double(count_b);
+   n = n_a + n_b;
+   delta = mean_b - Mean;
+   delta_n = delta/n;
+   delta_n_sq = delta_n*delta_n;
+   term = delta*delta_n*n_a*n_b;
+
+   if(Higher_Moments_Enab){
+      M4 += m4_b + term*delta_n_sq*(n_a*n_a - n_a*n_b + n_b*n_b)
+            + 6.0*delta_n_sq*(n_a*n_a*m2_b + n_b*n_b*M2)
+            + 4.0*delta_n*(n_a*m3_b - n_b*M3);
+      M3 += m3_b + term*delta_n*(n_a - n_b)
+            + 3.0*delta_n*(n_a*m2_b - n_b*M2);
+   }
+   M2 += m2_b + term;
+   Mean += delta_n*n_b;
+   Count += count_b;
+}
+//======================================================
+void StatsAccumulator::Merge( StatsAccumulator *other )
+{
+   for(int i=0; i<STATS_ACCUM_LANES*Num_Slots; i++){
+      Lane_Counts[i] += other->Lane_Counts[i];
+   }
+   if(other->Min_Val < Min_Val) Min_Val = other->Min_Val;
+   if(other->Max_Val > Max_Val) Max_Val = other->Max_Val;
+   MergeMoments( other->Count, other->Mean,
+                 other->M2, other->M3, other->M4 );
+}
+//======================================================
+double StatsAccumulator::GetVariance(void)
+{
+   if(Count < 1) return(0.0);
+   return(M2/Count);
+}
+//======================================================
+double StatsAccumulator::GetSkewness(void)
+{
+   if(Count < 1 || M2 <= 0.0) return(0.0);
+   return(sqrt(double(Count)) * M3 / pow(M2, 1.5));
+}
+//======================================================
+double StatsAccumulator::GetKurtosis(void)
+{
+   if(Count < 1 || M2 <= 0.0) return(0.0);
+   return(double(Count) * M4 / (M2*M2) - 3.0);
+}
+//======================================================
+long long StatsAccumulator::SlotTotal( int slot )
+{
+   long long total = 0;
+   for(int lane=0; lane<STATS_ACCUM_LANES; lane++){
+      total += Lane_Counts[lane*Num_Slots + slot];
+   }
+   return(total);
+}
+//======================================================
+void StatsAccumulator::GetHistogram( double *bin_counts )
+{
+   for(int ib=0; ib<Num_Bins; ib++){
+      bin_counts[ib] = double(SlotTotal(ib+1));
+   }
+}
+//======================================================
+long long StatsAccumulator::GetInRangeCount(void)
+{
+   return(Count - GetBelowRangeCount() - GetAboveRangeCount());
+}
+//======================================================
+long long StatsAccumulator::GetBelowRangeCount(void)
+{
+   return(SlotTotal(0));
+}
+//======================================================
+long long StatsAccumulator::GetAboveRangeCount(void)
+{
+   return(SlotTotal(Num_Bins+1));
+}
+//======================================================
+double StatsAccumulator::GetQuantile( double prob )
+{
+   int ib;
+   double target, cum_count, bin_count;
+
+   if(Count < 1) return(0.0);
+   target = prob * double(Count);
+
+   cum_count = double(GetBelowRangeCount());
+   if(target <= cum_count) return(Min_Val);
+
+   for(ib=0; ib<Num_Bins; ib++){
+      bin_count = double(SlotTotal(ib+1));
+      if(cum_count + bin_count >= target && bin_count > 0.0){
+         return( Left_Edge
+                 + (ib + (target - cum_count)/bin_count) * Bin_Width );
+      }
+      cum_count += bin_count;
+   }
+   return(Max_Val);
+}
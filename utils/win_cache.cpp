@@ -0,0 +1,215 @@
+//
+//  File = win_cache.cpp
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <map>
+#include <mutex>
+#include "win_cache.h"
+#include "trianglr.h"
+#include "hamming.h"
+#include "hann.h"
+#include "kaiser.h"
+#include "blk_harr.h"
+#include "flat_top.h"
+#include "psstream.h"
+
+extern PracSimStream ErrorStream;
+#define _NO_ZERO_ENDS 0
+
+//======================================================
+//  constructor
+
+WindowTable::WindowTable( WINDOW_SHAPE_T shape,
+                          int length,
+                          WINDOW_NORM_T win_norm,
+                          double kaiser_beta )
+{
+   GenericWindow *gen_win;
+   double *gen_taps;
+   double scale;
+   size_t addr;
+   int is;
+
+   Length = length;
+
+   // one block holds both tap arrays, each aligned
+   int dbl_bytes = ((Length*int(sizeof(double)) + WINDOW_TAP_ALIGN-1)
+                     / WINDOW_TAP_ALIGN) * WINDOW_TAP_ALIGN;
+   Tap_Storage = new char[ dbl_bytes + Length*sizeof(float)
+                           + WINDOW_TAP_ALIGN ];
+   addr = (size_t)Tap_Storage;
+   addr = (addr + WINDOW_TAP_ALIGN-1) & ~(size_t)(WINDOW_TAP_ALIGN-1);
+   Taps = (double*)addr;
+   Float_Taps = (float*)(addr + dbl_bytes);
+
+   switch(shape){
+   case WINDOW_SHAPE_TRIANGULAR:
+      gen_win = new TriangularWindow( Length, _NO_ZERO_ENDS );
+      break;
+   case WINDOW_SHAPE_HAMMING:
+      gen_win = new HammingWindow( Length );
+      break;
+   case WINDOW_SHAPE_HANN:
+      gen_win = new HannWindow( Length, _NO_ZERO_ENDS );
+      break;
+   case WINDOW_SHAPE_KAISER:
+      gen_win = new KaiserWindow( Length, kaiser_beta );
+      break;
+   case WINDOW_SHAPE_BLACKMAN_HARRIS:
+      gen_win = new BlackmanHarrisWindow( Length );
+      break;
+   case WINDOW_SHAPE_FLAT_TOP:
+      gen_win = new FlatTopWindow( Length );
+      break;
+   default:
+      gen_win = NULL;
+      break;
+   }
+
+   if(gen_win == NULL){
+      for(is=0; is<Length; is++) Taps[is] = 1.0;
+   }
+   else{
+      gen_taps = gen_win->GetDataWindow();
+      for(is=0; is<Length; is++) Taps[is] = gen_taps[is];
+      delete gen_win;
+   }
+
+   Coherent_Gain = 0.0;
+   Window_Power = 0.0;
+   for(is=0; is<Length; is++){
+      Coherent_Gain += Taps[is];
+      Window_Power += Taps[is]*Taps[is];
+   }
+   Coherent_Gain /= Length;
+   Window_Power /= Length;
+
+   switch(win_norm){
+   case WINDOW_NORM_UNIT_POWER:
+      scale = 1.0/sqrt(Window_Power);
+      break;
+   case WINDOW_NORM_UNIT_GAIN:
+      scale = 1.0/Coherent_Gain;
+      break;
+   default:
+      scale = 1.0;
+      break;
+   }
+   for(is=0; is<Length; is++){
+      Taps[is] *= scale;
+      Float_Taps[is] = float(Taps[is]);
+   }
+   Coherent_Gain *= scale;
+   Window_Power *= scale*scale;
+   Enbw = Window_Power/(Coherent_Gain*Coherent_Gain);
+}
+//======================================================
+WindowTable::~WindowTable(void)
+{
+   delete[] Tap_Storage;
+}
+//======================================================
+void WindowTable::Apply( const float *in_seg,
+                         float *out_seg,
+                         int tap_beg,
+                         int num_samps )
+{
+   const float *tap_ptr = Float_Taps + tap_beg;
+   for(int is=0; is<num_samps; is++){
+      out_seg[is] = tap_ptr[is] * in_seg[is];
+   }
+}
+//======================================================
+void WindowTable::Apply( const float *in_seg,
+                         double *out_seg,
+                         int tap_beg,
+                         int num_samps )
+{
+   const double *tap_ptr = Taps + tap_beg;
+   for(int is=0; is<num_samps; is++){
+      out_seg[is] = tap_ptr[is] * in_seg[is];
+   }
+}
+//======================================================
+//  works on the interleaved real/imag parts so the loop
+//  is a plain float multiply
+
+void WindowTable::Apply( const std::complex<float> *in_seg,
+                         std::complex<float> *out_seg,
+                         int tap_beg,
+                         int num_samps )
+{
+   const float *tap_ptr = Float_Taps + tap_beg;
+   const float *in_ptr = (const float*)in_seg;
+   float *out_ptr = (float*)out_seg;
+   for(int is=0; is<num_samps; is++){
+      out_ptr[2*is] = tap_ptr[is] * in_ptr[2*is];
+      out_ptr[2*is+1] = tap_ptr[is] * in_ptr[2*is+1];
+   }
+}
+//======================================================
+void WindowTable::Apply( const float *in_seg,
+                         float *out_seg )
+{
+   Apply(in_seg, out_seg, 0, Length);
+}
+//======================================================
+void WindowTable::Apply( const std::complex<float> *in_seg,
+                         std::complex<float> *out_seg )
+{
+   Apply(in_seg, out_seg, 0, Length);
+}
+
+//======================================================
+//  process-wide cache
+
+typedef struct{
+   int shape;
+   int length;
+   int win_norm;
+   double kaiser_beta;
+   } win_cache_key_type;
+
+struct WinCacheKeyLess
+{
+   bool operator()( const win_cache_key_type& a,
+                    const win_cache_key_type& b ) const
+   {
+      if(a.shape != b.shape) return(a.shape < b.shape);
+      if(a.length != b.length) return(a.length < b.length);
+      if(a.win_norm != b.win_norm) return(a.win_norm < b.win_norm);
+      return(a.kaiser_beta < b.kaiser_beta);
+   }
+};
+
+static std::map<win_cache_key_type, WindowTable*, WinCacheKeyLess> Window_Cache;
+static std::mutex Window_Cache_Mutex;
+
+WindowTable* GetCachedWindow( WINDOW_SHAPE_T shape,
+                              int length,
+                              WINDOW_NORM_T win_norm,
+                              double kaiser_beta )
+{
+   win_cache_key_type key;
+   WindowTable *table;
+
+   if(length < 1){
+      ErrorStream << "Error: window length must be positive" << endl;
+      exit(-1);
+   }
+   key.shape = int(shape);
+   key.length = length;
+   key.win_norm = int(win_norm);
+   key.kaiser_beta = (shape == WINDOW_SHAPE_KAISER) ? kaiser_beta : 0.0;
+
+   std::lock_guard<std::mutex> lock(Window_Cache_Mutex);
+   std::map<win_cache_key_type, WindowTable*, WinCacheKeyLess>::iterator
+                                          entry = Window_Cache.find(key);
+   if(entry != Window_Cache.end()) return(entry->second);
+
+   table = new WindowTable(shape, length, win_norm, kaiser_beta);
+   Window_Cache[key] = table;
+   return(table);
+}
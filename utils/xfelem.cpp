@@ -86,6 +86,23 @@ ExtenFieldElem operator*( const ExtenFieldElem e1,
   result.FieldDegree = field_degree;
   result.Value = new PrimeFieldElem[field_degree];
 
+  Gf2mField *fast_field = (result.Field)->Fast_Field;
+  if(fast_field != NULL)
+    {
+    gf_elem_t elem_1 = 0, elem_2 = 0, prod;
+    for(d1=0; d1<field_degree; d1++)
+      {
+      elem_1 |= gf_elem_t(e1.Value[d1].Value << d1);
+      elem_2 |= gf_elem_t(e2.Value[d1].Value << d1);
+      }
+    prod = fast_field->Mul(elem_1, elem_2);
+    for(d1=0; d1<field_degree; d1++)
+      {
+      result.Value[d1] = PrimeFieldElem(base, (prod >> d1) & 1);
+      }
+    return (result);
+    }
+
   work = new PrimeFieldElem[field_degree+1];
   temp_res = new PrimeFieldElem[field_degree+1];
 